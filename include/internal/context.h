@@ -25,8 +25,33 @@ struct mco_ctx {
 
     /* Variance reduction flags */
     int antithetic_enabled;         /* Antithetic variates */
-    int control_variates_enabled;   /* Control variates (future) */
-    int stratified_enabled;         /* Stratified sampling (future) */
+    uint32_t control_variates;      /* Bitmask of mco_control (0 = off) */
+    int stratified_enabled;         /* Stratified / Latin hypercube sampling */
+    int conditional_mc_enabled;     /* Conditional MC (Heston spot, barrier crossings) */
+    int importance_sampling_enabled; /* Mean-shift IS (digital, knock-in barrier) */
+
+    /* Discretisation */
+    int bridge_extremum_enabled;    /* Exact bridge min/max between steps (lookback) */
+
+    /* LSM regression (American, Bermudan) */
+    int lsm_basis;                  /* mco_lsm_basis_type */
+    uint32_t lsm_degree;            /* Highest basis degree (1..MCO_LSM_MAX_DEGREE) */
+    int lsm_payoff_regressor;       /* Exercise value as an extra regressor */
+    double lsm_ridge;               /* Ridge on the scaled normal matrix */
+    mco_exercise_cache *exercise_cache; /* Shared policy cache (borrowed, NULL = off) */
+
+    /* Early-exercise engine (American, Bermudan) */
+    int american_engine;            /* mco_american_engine */
+    uint32_t lattice_steps;         /* Tree depth for the lattice engines */
+    int lattice_richardson;         /* Richardson extrapolation on the lattice */
+
+    /* Finite differences */
+    uint32_t pde_space_nodes;       /* Spot nodes */
+    uint32_t pde_time_steps;        /* Crank-Nicolson steps */
+
+    /* Vector kernels (see internal/cpu.h) */
+    int cpu_level;                  /* mco_cpu_level, capped to the host */
+    int precision;                  /* mco_precision */
 
     /* Model selection (future) */
     int model;                      /* 0=GBM, 1=Heston, 2=SABR */
@@ -42,6 +67,12 @@ struct mco_ctx {
 
     /* Error state */
     mco_error last_error;
+
+    /* Standard error of the last estimate (0 if the pricer reports none) */
+    double last_std_error;
+
+    /* Workers for mco_submit (owned, started on first use, NULL = none) */
+    struct mco_job_pool *job_pool;
 };
 
 /*
@@ -51,5 +82,10 @@ struct mco_ctx {
 #define MCO_DEFAULT_STEPS        252
 #define MCO_DEFAULT_SEED         0xDEADBEEF
 #define MCO_DEFAULT_THREADS      1
+#define MCO_DEFAULT_LSM_DEGREE   2
+#define MCO_DEFAULT_LSM_RIDGE    1e-10
+#define MCO_DEFAULT_LATTICE_STEPS 500
+#define MCO_DEFAULT_PDE_NODES     400
+#define MCO_DEFAULT_PDE_STEPS     200
 
 #endif /* MCO_INTERNAL_CONTEXT_H */
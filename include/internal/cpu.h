@@ -0,0 +1,46 @@
+/*
+ * CPU Feature Dispatch
+ *
+ * The library is built for the baseline of the target architecture, so
+ * one binary runs on any host of that architecture. The kernels whose
+ * inner loops vectorise (internal/methods/kernels.h) are also compiled
+ * once per x86-64 level from the same source:
+ *
+ *   GENERIC  baseline (SSE2 on x86-64)
+ *   SSE42    SSE4.2, POPCNT
+ *   AVX2     AVX2, FMA
+ *   AVX512   AVX-512 F/DQ/BW/VL
+ *
+ * Each context takes the highest level the host supports when it is
+ * created, capped by MCO_CPU_LEVEL in the environment (generic, sse4.2,
+ * avx2 or avx512, read once per process) and later by mco_set_cpu_level.
+ * Detection checks exactly the features the level is compiled with.
+ *
+ * Results are bitwise identical at every level: the library is built
+ * as ISO C, so the compiler neither contracts a·b + c into an FMA nor
+ * reorders sums, and the kernels differ only in vector width.
+ *
+ * The double-precision path pricers are scalar per path and gain
+ * nothing from the ISA beyond what glibc already dispatches at run
+ * time for exp, log, pow and the trigonometric functions; their Latin
+ * hypercube normals are generated a block at a time through the
+ * kernels.
+ */
+
+#ifndef MCO_INTERNAL_CPU_H
+#define MCO_INTERNAL_CPU_H
+
+#include "mcoptions.h"
+
+/*
+ * Highest level supported by this host, capped by MCO_CPU_LEVEL.
+ * Detected once; thread-safe.
+ */
+mco_cpu_level mco_cpu_default_level(void);
+
+/*
+ * Highest level this host can run, ignoring the environment
+ */
+mco_cpu_level mco_cpu_host_level(void);
+
+#endif /* MCO_INTERNAL_CPU_H */
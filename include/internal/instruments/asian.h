@@ -20,7 +20,9 @@
  *
  * This implementation:
  *   - Fixed strike arithmetic average (most common)
- *   - Discrete averaging at num_obs observation points
+ *   - Discrete averaging at num_obs evenly spaced observation points,
+ *     or at an arbitrary observation schedule (sampled exactly, with
+ *     no intermediate steps)
  */
 
 #ifndef MCO_INTERNAL_INSTRUMENTS_ASIAN_H
@@ -75,6 +77,27 @@ double mco_price_asian(mco_ctx *ctx,
                        mco_asian_strike strike_type,
                        mco_option_type option_type);
 
+/*
+ * Price an Asian option observed on an arbitrary schedule.
+ *
+ * obs_times are the observation dates in years, non-decreasing and
+ * ≥ 0; the payoff is paid at the last one. GBM is sampled exactly at
+ * each date. The geometric control variate is only used when the dates
+ * are evenly spaced (its closed form assumes that).
+ *
+ * Returns 0 with MCO_ERR_INVALID_ARG for an invalid schedule.
+ */
+double mco_price_asian_schedule(mco_ctx *ctx,
+                                double spot,
+                                double strike,
+                                double rate,
+                                double volatility,
+                                const double *obs_times,
+                                size_t num_obs,
+                                mco_asian_type avg_type,
+                                mco_asian_strike strike_type,
+                                mco_option_type option_type);
+
 /*
  * Closed-form geometric Asian option price (for validation)
  *
@@ -0,0 +1,201 @@
+/*
+ * Analytic Barrier Prices
+ *
+ * Reiner-Rubinstein closed forms for continuously monitored barriers,
+ * with the Broadie-Glasserman-Kou shift for discrete monitoring. Inline
+ * so the batch kernel (internal/methods/kernels.h) is compiled at each
+ * instruction-set level from the same code as the scalar prices in
+ * src/instruments/barrier.c.
+ */
+
+#ifndef MCO_INTERNAL_INSTRUMENTS_BARRIER_ANALYTIC_H
+#define MCO_INTERNAL_INSTRUMENTS_BARRIER_ANALYTIC_H
+
+#include "mcoptions.h"
+#include "internal/instruments/barrier.h"
+#include <math.h>
+#include <stddef.h>
+
+/* Standard normal CDF */
+static inline double mco_barrier_norm_cdf(double x)
+{
+    return 0.5 * erfc(-x * 0.7071067811865475);
+}
+
+/*
+ * Broadie-Glasserman-Kou barrier factor e^(β·σ·√Δt)
+ */
+static inline double mco_barrier_bgk_factor(double volatility, double dt)
+{
+    return exp(MCO_BARRIER_BGK_BETA * volatility * sqrt(dt));
+}
+
+static inline int mco_barrier_analytic_valid(double spot, double strike, double barrier,
+                                             double volatility, double time)
+{
+    return spot > 0.0 && strike > 0.0 && barrier > 0.0 && volatility >= 0.0 && time >= 0.0;
+}
+
+/*
+ * Terms shared by every contract with the same (r, σ, T) and schedule
+ */
+typedef struct {
+    double sd;          /* σ√T */
+    double lambda;      /* (1 + μ)·σ√T, μ = (r - ½σ²)/σ² */
+    double two_mu;      /* 2μ */
+    double df;          /* e^(-rT) */
+    double shift;       /* Barrier factor, 1 for continuous monitoring */
+    int diffusive;      /* σ > 0 and T > 0 */
+} mco_rr_market;
+
+static inline void mco_rr_market_init(mco_rr_market *m, double rate, double vol,
+                                      double time, size_t monitor_dates)
+{
+    m->df = exp(-rate * time);
+    m->diffusive = vol > 0.0 && time > 0.0;
+    m->shift = (m->diffusive && monitor_dates > 0)
+             ? mco_barrier_bgk_factor(vol, time / (double)monitor_dates) : 1.0;
+
+    if (m->diffusive) {
+        double mu = (rate - 0.5 * vol * vol) / (vol * vol);
+        m->sd = vol * sqrt(time);
+        m->lambda = (1.0 + mu) * m->sd;
+        m->two_mu = 2.0 * mu;
+    } else {
+        m->sd = m->lambda = m->two_mu = 0.0;
+    }
+}
+
+/*
+ * No diffusion: the path is S·e^(rt), monotone in t
+ */
+static inline void mco_rr_values_deterministic(const mco_rr_market *m, double spot,
+                                               double strike, double barrier,
+                                               double rebate, mco_barrier_values *v)
+{
+    double forward = spot / m->df;
+    double vanilla[2] = { m->df * fmax(forward - strike, 0.0),
+                          m->df * fmax(strike - forward, 0.0) };
+    int hit[2] = { fmin(spot, forward) <= barrier, fmax(spot, forward) >= barrier };
+
+    for (int j = 0; j < 2; ++j) {
+        double *prices = j ? v->put : v->call;
+        for (int up = 0; up < 2; ++up) {
+            prices[up ? MCO_BARRIER_UP_IN : MCO_BARRIER_DOWN_IN] = hit[up] ? vanilla[j] : 0.0;
+            prices[up ? MCO_BARRIER_UP_OUT : MCO_BARRIER_DOWN_OUT] = hit[up] ? m->df * rebate : vanilla[j];
+        }
+    }
+    v->parity = 0.0;
+}
+
+/*
+ * All eight continuously monitored prices, against the barrier moved
+ * by m->shift away from the spot. A spot at or beyond the contractual
+ * barrier is already knocked for that direction.
+ *
+ * Reiner-Rubinstein terms for φ = +1 call / -1 put, η = +1 down / -1 up,
+ * with λ = (1 + μ)·σ√T:
+ *
+ *   A = φS·N(φx₁) - φK·e^(-rT)·N(φ(x₁ - σ√T)),   x₁ = ln(S/K)/σ√T + λ
+ *   B = A with x₂ = ln(S/H)/σ√T + λ
+ *   C = φS·(H/S)^(2μ+2)·N(ηy₁) - φK·e^(-rT)·(H/S)^(2μ)·N(η(y₁ - σ√T)),
+ *       y₁ = ln(H²/SK)/σ√T + λ
+ *   D = C with y₂ = ln(H/S)/σ√T + λ
+ *
+ * A is the vanilla. Only one direction is alive for a given spot, so a
+ * contract costs eight normal CDFs, one power and two logs: the put
+ * terms reuse the call CDFs through N(-x) = 1 - N(x), and ln(H²/SK) and
+ * ln(H/S) come from ln(S/K) and ln(S/H). The probability of never
+ * touching H is N(η(x₂ - σ√T)) - (H/S)^(2μ)·N(η(y₂ - σ√T)), from the
+ * same CDFs.
+ */
+static inline void mco_rr_values(const mco_rr_market *m, double spot, double strike,
+                                 double barrier, double rebate, mco_barrier_values *v)
+{
+    if (!m->diffusive) {
+        mco_rr_values_deterministic(m, spot, strike, barrier, rebate, v);
+        return;
+    }
+
+    double df_strike = strike * m->df;
+    double log_sk = log(spot / strike);
+    double x1 = log_sk / m->sd + m->lambda;
+    double n1 = mco_barrier_norm_cdf(x1);
+    double n1s = mco_barrier_norm_cdf(x1 - m->sd);
+
+    /* A for call and put; A_put = A_call - S + K·e^(-rT) */
+    double a_call = spot * n1 - df_strike * n1s;
+    double a_put = df_strike * (1.0 - n1s) - spot * (1.0 - n1);
+
+    /* The knocked direction: in = vanilla, out = rebate */
+    double knocked_out = m->df * rebate;
+    for (int up = 0; up < 2; ++up) {
+        mco_barrier_style in = up ? MCO_BARRIER_UP_IN : MCO_BARRIER_DOWN_IN;
+        mco_barrier_style out = up ? MCO_BARRIER_UP_OUT : MCO_BARRIER_DOWN_OUT;
+        v->call[in] = a_call;
+        v->put[in] = a_put;
+        v->call[out] = v->put[out] = knocked_out;
+    }
+    v->parity = 0.0;
+
+    int is_up = spot < barrier;
+    if (!is_up && !(spot > barrier)) return;
+
+    double level = is_up ? barrier * m->shift : barrier / m->shift;
+    double log_sh = log(spot / level);
+    double ratio = level / spot;
+    double refl = pow(ratio, m->two_mu);
+    double refl_spot = spot * refl * ratio * ratio;
+    double x2 = log_sh / m->sd + m->lambda;
+    double y1 = (log_sk - 2.0 * log_sh) / m->sd + m->lambda;
+    double y2 = m->lambda - log_sh / m->sd;
+
+    double n2 = mco_barrier_norm_cdf(x2);
+    double n2s = mco_barrier_norm_cdf(x2 - m->sd);
+    double ny1 = mco_barrier_norm_cdf(y1);
+    double ny1s = mco_barrier_norm_cdf(y1 - m->sd);
+    double ny2 = mco_barrier_norm_cdf(y2);
+    double ny2s = mco_barrier_norm_cdf(y2 - m->sd);
+
+    /* η = -1: N(-y) = 1 - N(y) */
+    if (is_up) {
+        ny1 = 1.0 - ny1;
+        ny1s = 1.0 - ny1s;
+        ny2 = 1.0 - ny2;
+        ny2s = 1.0 - ny2s;
+    }
+
+    double b_call = spot * n2 - df_strike * n2s;
+    double b_put = df_strike * (1.0 - n2s) - spot * (1.0 - n2);
+    double c_call = refl_spot * ny1 - df_strike * refl * ny1s;
+    double d_call = refl_spot * ny2 - df_strike * refl * ny2s;
+    double survive = (is_up ? 1.0 - n2s : n2s) - refl * ny2s;
+    double touch_rebate = m->df * rebate * (1.0 - survive);
+
+    /* Haug's table; C and D change sign with φ */
+    int above = strike > level;
+    double in_call, out_call, in_put, out_put;
+    if (is_up) {
+        in_call = above ? a_call : b_call - c_call + d_call;
+        out_call = above ? 0.0 : a_call - b_call + c_call - d_call;
+        in_put = above ? a_put - b_put - d_call : -c_call;
+        out_put = above ? b_put + d_call : a_put + c_call;
+    } else {
+        in_call = above ? c_call : a_call - b_call + d_call;
+        out_call = above ? a_call - c_call : b_call - d_call;
+        in_put = above ? b_put + c_call - d_call : a_put;
+        out_put = above ? a_put - b_put - c_call + d_call : 0.0;
+    }
+
+    mco_barrier_style in = is_up ? MCO_BARRIER_UP_IN : MCO_BARRIER_DOWN_IN;
+    mco_barrier_style out = is_up ? MCO_BARRIER_UP_OUT : MCO_BARRIER_DOWN_OUT;
+    v->call[in] = in_call;
+    v->put[in] = in_put;
+    v->call[out] = out_call + touch_rebate;
+    v->put[out] = out_put + touch_rebate;
+
+    /* The in and out legs come from separate rows of the table */
+    v->parity = fmax(fabs(in_call + out_call - a_call), fabs(in_put + out_put - a_put));
+}
+
+#endif /* MCO_INTERNAL_INSTRUMENTS_BARRIER_ANALYTIC_H */
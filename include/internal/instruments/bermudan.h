@@ -22,6 +22,7 @@
 
 #include "internal/context.h"
 #include "internal/instruments/payoff.h"
+#include "internal/methods/lsm.h"
 #include <stddef.h>
 
 /*
@@ -55,6 +56,21 @@ double mco_price_bermudan(mco_ctx *ctx,
                           size_t num_exercise,
                           mco_option_type type);
 
+/*
+ * Same as mco_price_bermudan, also returning the exercise policy (see
+ * mco_lsm_american_policy for ownership and the exercise cache).
+ */
+double mco_price_bermudan_policy(mco_ctx *ctx,
+                                 double spot,
+                                 double strike,
+                                 double rate,
+                                 double volatility,
+                                 double time_to_maturity,
+                                 const double *exercise_times,
+                                 size_t num_exercise,
+                                 mco_option_type type,
+                                 mco_exercise_policy *policy_out);
+
 /*
  * Price a Bermudan option with evenly spaced exercise dates.
  *
@@ -0,0 +1,194 @@
+/*
+ * Streaming Path Payoff State
+ *
+ * Path-dependent payoffs only need a handful of running statistics of
+ * the path, not the path itself:
+ *
+ *   Asian (arithmetic)  - Σ S(tᵢ)
+ *   Asian (geometric)   - Σ log S(tᵢ)
+ *   Lookback            - min S(tᵢ), max S(tᵢ)
+ *   Barrier             - hit flag
+ *   All                 - S(T)
+ *
+ * The stepper updates the state as each point is generated, so there
+ * is a single pass per path and no (num_steps + 1) buffer:
+ *
+ *   mco_path_state_init(&st, S₀, track);
+ *   for each step: x = log_step(x, z); mco_path_state_observe(&st, x);
+ *   payoff from mco_path_state_spot(&st), st.sum, mco_path_state_min(&st), ...
+ *
+ * Log coordinates:
+ *   The state is fed x = log S. Geometric sums and extrema are kept in
+ *   logs (exp is monotone), so only the arithmetic sum needs exp per
+ *   step; everything else is converted once when the path is done.
+ *
+ * Only the statistics requested in `track` are maintained; log S(T) and
+ * the observation count always are. The sums run over S(t₁)..S(tₙ) (the
+ * initial spot is not an averaging date); the extrema include S(t₀).
+ *
+ * The barrier hit flag is owned by the barrier pricer (it needs the
+ * Brownian bridge between steps) but lives here so a knock-out can stop
+ * stepping as soon as it is set.
+ *
+ * Continuous extrema:
+ *   With MCO_PATH_BRIDGE_MIN / MCO_PATH_BRIDGE_MAX the extremum of the
+ *   log-Brownian bridge between consecutive points is drawn exactly
+ *   (mco_path_state_observe_bridge), so min / max are samples of the
+ *   continuously monitored extrema rather than of the grid points.
+ */
+
+#ifndef MCO_INTERNAL_INSTRUMENTS_PATH_STATE_H
+#define MCO_INTERNAL_INSTRUMENTS_PATH_STATE_H
+
+#include "internal/rng.h"
+#include "internal/specialise.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Statistics to maintain (bitmask)
+ */
+#define MCO_PATH_SUM      (1u << 0)     /* Σ S(tᵢ), i = 1..n */
+#define MCO_PATH_LOG_SUM  (1u << 1)     /* Σ log S(tᵢ), i = 1..n */
+#define MCO_PATH_EXTREMA  (1u << 2)     /* min / max over S(t₀..tₙ) */
+#define MCO_PATH_BRIDGE_MIN (1u << 3)   /* min over [0, T] (bridge sampled) */
+#define MCO_PATH_BRIDGE_MAX (1u << 4)   /* max over [0, T] (bridge sampled) */
+
+/*
+ * Running payoff state for one path
+ */
+typedef struct {
+    uint32_t track;     /* MCO_PATH_* bits */
+    size_t count;       /* Observations after S(t₀) */
+    double log_spot;    /* Latest log S(tᵢ); log S(T) once the path is done */
+    double sum;         /* Σ S(tᵢ) */
+    double log_sum;     /* Σ log S(tᵢ) */
+    double log_min;     /* min log S(tᵢ) */
+    double log_max;     /* max log S(tᵢ) */
+    int hit;            /* Barrier touched */
+} mco_path_state;
+
+static inline void mco_path_state_init(mco_path_state *st, double spot, uint32_t track)
+{
+    st->track = track;
+    st->count = 0;
+    st->log_spot = log(spot);
+    st->sum = 0.0;
+    st->log_sum = 0.0;
+    st->log_min = st->log_spot;
+    st->log_max = st->log_spot;
+    st->hit = 0;
+}
+
+/*
+ * Record the next path value, given as x = log S(tᵢ), maintaining the
+ * statistics in `track` (st->track, or a constant from a specialised
+ * kernel; see internal/specialise.h).
+ */
+MCO_SPECIALISE void mco_path_state_observe_as(mco_path_state *st, double x, uint32_t track)
+{
+    st->log_spot = x;
+    st->count++;
+
+    if (track & MCO_PATH_SUM) {
+        st->sum += exp(x);
+    }
+    if (track & MCO_PATH_LOG_SUM) {
+        st->log_sum += x;
+    }
+    if (track & MCO_PATH_EXTREMA) {
+        if (x < st->log_min) st->log_min = x;
+        if (x > st->log_max) st->log_max = x;
+    }
+}
+
+static inline void mco_path_state_observe(mco_path_state *st, double x)
+{
+    mco_path_state_observe_as(st, x, st->track);
+}
+
+/*
+ * Record the next path value x = log S(tᵢ) and draw the extremum of the
+ * bridge from the previous value, for the sides requested in `track`.
+ *
+ * Given endpoints x₀, x₁ and bridge variance v = σ²·Δt, the maximum M
+ * has P(M ≥ m) = exp(-2(m - x₀)(m - x₁)/v) for m ≥ max(x₀, x₁); solving
+ * for a uniform U gives
+ *
+ *   M = ½·(x₀ + x₁ + √((x₁ - x₀)² - 2v·log U))
+ *   m = ½·(x₀ + x₁ - √((x₁ - x₀)² - 2v·log U))   (minimum)
+ *
+ * One uniform per requested side per step.
+ */
+MCO_SPECIALISE void mco_path_state_observe_bridge_as(mco_path_state *st,
+                                                     double x,
+                                                     double variance,
+                                                     mco_rng *rng,
+                                                     uint32_t track)
+{
+    double x0 = st->log_spot;
+    double mid = 0.5 * (x0 + x);
+    double dx = x - x0;
+
+    mco_path_state_observe_as(st, x, track);
+
+    if (track & MCO_PATH_BRIDGE_MIN) {
+        double u = 1.0 - mco_rng_uniform(rng);  /* (0, 1] */
+        double m = mid - 0.5 * sqrt(dx * dx - 2.0 * variance * log(u));
+        if (m < st->log_min) st->log_min = m;
+    }
+    if (track & MCO_PATH_BRIDGE_MAX) {
+        double u = 1.0 - mco_rng_uniform(rng);
+        double m = mid + 0.5 * sqrt(dx * dx - 2.0 * variance * log(u));
+        if (m > st->log_max) st->log_max = m;
+    }
+}
+
+static inline void mco_path_state_observe_bridge(mco_path_state *st,
+                                                 double x,
+                                                 double variance,
+                                                 mco_rng *rng)
+{
+    mco_path_state_observe_bridge_as(st, x, variance, rng, st->track);
+}
+
+/*
+ * Latest (terminal, once the path is done) spot S(tᵢ).
+ */
+static inline double mco_path_state_spot(const mco_path_state *st)
+{
+    return exp(st->log_spot);
+}
+
+/*
+ * Path minimum / maximum. Require MCO_PATH_EXTREMA or the matching
+ * MCO_PATH_BRIDGE_* bit.
+ */
+static inline double mco_path_state_min(const mco_path_state *st)
+{
+    return exp(st->log_min);
+}
+
+static inline double mco_path_state_max(const mco_path_state *st)
+{
+    return exp(st->log_max);
+}
+
+/*
+ * Arithmetic average (1/n)·Σ S(tᵢ). Requires MCO_PATH_SUM.
+ */
+static inline double mco_path_state_arith_avg(const mco_path_state *st)
+{
+    return st->sum / (double)st->count;
+}
+
+/*
+ * Geometric average (∏ S(tᵢ))^(1/n). Requires MCO_PATH_LOG_SUM.
+ */
+static inline double mco_path_state_geom_avg(const mco_path_state *st)
+{
+    return exp(st->log_sum / (double)st->count);
+}
+
+#endif /* MCO_INTERNAL_INSTRUMENTS_PATH_STATE_H */
@@ -0,0 +1,121 @@
+/*
+ * Exercise Policy Cache
+ *
+ * The expensive part of LSM is the backward regression; what it
+ * produces is an exercise policy - per date, coefficients β such that
+ * early exercise happens where
+ *
+ *   exercise value > β·φ(S)
+ *
+ * A contract repriced after a small market move has (almost) the same
+ * policy, so the policy is kept and reused. Repricing is then a single
+ * forward pass: simulate each path date by date, stop at the first
+ * date where the policy says exercise, discount. No paths are stored
+ * and no regression is run. With the policy fitted on independent paths
+ * the forward price is a low-biased estimate (a sub-optimal policy can
+ * only lose value), the usual LSM out-of-sample bound.
+ *
+ * Normalisation:
+ *   GBM is scale free, so a policy is stored per unit strike and in
+ *   moneyness S/K. The cache key is
+ *
+ *     (type, basis, exercise dates as fractions of T,
+ *      log-moneyness, T, σ and r each rounded to a bucket)
+ *
+ *   and any contract falling in the same buckets reuses the entry.
+ *
+ * Sharing:
+ *   A cache may be attached to several contexts (mco_set_exercise_cache),
+ *   including ones used from different threads; lookups copy the policy
+ *   out under a lock. Entries are evicted least recently used.
+ */
+
+#ifndef MCO_INTERNAL_METHODS_EXERCISE_CACHE_H
+#define MCO_INTERNAL_METHODS_EXERCISE_CACHE_H
+
+#include "internal/context.h"
+#include "internal/methods/lsm.h"
+#include "internal/models/gbm_schedule.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Bucket widths for the cache key
+ */
+#define MCO_EXERCISE_BUCKET_MONEYNESS 0.01     /* log(S/K) */
+#define MCO_EXERCISE_BUCKET_MATURITY  (1.0 / 52.0)
+#define MCO_EXERCISE_BUCKET_VOL       0.005
+#define MCO_EXERCISE_BUCKET_RATE      0.0025
+
+/*
+ * Cache lookup key
+ */
+typedef struct {
+    int type;                /* mco_option_type */
+    int basis_kind;          /* mco_lsm_basis_type */
+    size_t degree;
+    int payoff;
+    int64_t moneyness;       /* Bucket indices */
+    int64_t maturity;
+    int64_t volatility;
+    int64_t rate;
+    size_t num_dates;
+    const double *times;     /* Schedule dates (borrowed) */
+    double maturity_time;    /* times are compared as times[i] / maturity_time */
+} mco_exercise_key;
+
+/*
+ * Key for a contract on a schedule.
+ */
+void mco_exercise_key_init(mco_exercise_key *key,
+                           const mco_gbm_schedule *sched,
+                           double strike,
+                           double volatility,
+                           mco_option_type type,
+                           const mco_lsm_basis *basis);
+
+/*
+ * Copy the cached policy for key into policy (initialised for the same
+ * number of dates). Returns 1 on a hit, 0 on a miss.
+ */
+int mco_exercise_cache_get(mco_exercise_cache *cache,
+                           const mco_exercise_key *key,
+                           mco_exercise_policy *policy);
+
+/*
+ * Store a copy of policy under key, replacing an existing entry or the
+ * least recently used one. Best effort: dropped on allocation failure.
+ */
+void mco_exercise_cache_put(mco_exercise_cache *cache,
+                            const mco_exercise_key *key,
+                            const mco_exercise_policy *policy);
+
+/*
+ * Forward-only price under a fixed policy.
+ *
+ * Streams each path through the schedule and stops at the first date
+ * where the exercise value beats the policy's continuation estimate.
+ * With controls (pc non-NULL and pc->k > 0) an exercised path is still
+ * walked on to S(T), the controls are evaluated there as in
+ * mco_lsm_price, and the regression-adjusted mean is returned. Sets
+ * ctx->last_std_error.
+ */
+double mco_exercise_forward_price(mco_ctx *ctx,
+                                  const mco_gbm_schedule *sched,
+                                  const mco_exercise_policy *policy,
+                                  double strike,
+                                  mco_option_type type,
+                                  const mco_path_controls *pc,
+                                  mco_mcv_stats *cv_stats);
+
+/*
+ * Critical spot per date implied by the policy: exercise below it for
+ * a put, above it for a call. Dates with no exercise region get 0
+ * (put) or +∞ (call); maturity gets the strike.
+ */
+void mco_exercise_policy_boundary(const mco_exercise_policy *policy,
+                                  double strike,
+                                  mco_option_type type,
+                                  double *boundary);
+
+#endif /* MCO_INTERNAL_METHODS_EXERCISE_CACHE_H */
@@ -0,0 +1,312 @@
+/*
+ * Single-Precision Screening Mode
+ *
+ * With mco_set_precision(ctx, MCO_PRECISION_FAST) the European, Asian,
+ * barrier, lookback and digital pricers simulate in float32 lanes: the
+ * paths of a block of MCO_FAST_LANES advance together, one array
+ * element per path, so every per-step loop runs across the lanes and
+ * vectorises at twice the width of double. The kernel is one of the
+ * run-time dispatched vector kernels (internal/methods/kernels.h).
+ *
+ * Random numbers:
+ *   Each lane has its own xoshiro256** stream (state in structure-of-
+ *   arrays layout, seeded by SplitMix64 from the thread's RNG), so the
+ *   generator itself is a lane loop. A normal takes the top 23 bits of
+ *   one draw, u = (k + ½)·2⁻²³, and z = √2·erfinv(2u - 1) with Giles'
+ *   single-precision erfinv: two polynomials in w = -log(1 - x²), both
+ *   evaluated and one selected, so there is no branch.
+ *
+ * Elementary functions:
+ *   exp and log are inlined polynomials (Cody-Waite reduction by ln 2,
+ *   degree-6 exp; atanh series for log on [√½, √2)) that the compiler
+ *   can vectorise, where a libm call would stop it.
+ *
+ * Paths:
+ *   Log-spot is carried relative to S(0), x = log(S/S₀), so it starts
+ *   at 0 with the finest float spacing. Running sums, log sums, extrema
+ *   and barrier survival are lane arrays; the barrier is monitored with
+ *   the same Brownian-bridge crossing draw as the double pricer, and a
+ *   knock-out block stops once every lane is knocked.
+ *
+ * Accumulation:
+ *   Payoffs are float per path, then added a lane block at a time in
+ *   double into blocked pairwise sums (internal/sum.h); thread sums are
+ *   merged in thread order and the discount applied last.
+ *
+ * Error bounds (measured over the whole sampler grid and float range):
+ *   - Normals are within 1.5e-6 absolute (3e-7 relative) of Φ⁻¹(u) at
+ *     the same u, and are truncated at |z| ≤ 5.295 (mass 1.2e-7).
+ *   - exp is within 3e-7 relative, log within 1.5e-7 relative (or
+ *     absolute below 1).
+ *   - Log-spot rounds by about 3e-8 per step, so over n steps it drifts
+ *     by about √n·3e-8 - 1e-6 for n = 1000 - without bias.
+ *   - Summation adds nothing measurable: the sums are double and
+ *     pairwise.
+ *   Together the bias is of order 1e-6 relative, well inside the 1e-4
+ *   target; what remains is sampling error, of the same size as in
+ *   double but on a different random stream, so a fast price agrees
+ *   with the double one within their combined standard errors.
+ *
+ * Scope:
+ *   Fast mode covers plain sampling. A pricer runs in double whenever
+ *   one of its variance-reduction settings (antithetic, stratification,
+ *   control variates, importance sampling, conditional survival, bridge
+ *   extrema) is on.
+ *
+ * Reference:
+ *   Giles, M. (2010). "Approximating the erfinv function", GPU Computing
+ *   Gems Jade Edition.
+ */
+
+#ifndef MCO_INTERNAL_METHODS_FAST_MC_H
+#define MCO_INTERNAL_METHODS_FAST_MC_H
+
+#include "internal/context.h"
+#include "internal/rng.h"
+#include "internal/specialise.h"
+#include "internal/sum.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Paths per lane block */
+#define MCO_FAST_LANES 16
+
+/*============================================================================
+ * Lane Streams
+ *============================================================================*/
+
+/*
+ * MCO_FAST_LANES xoshiro256** streams, s[k][lane]
+ */
+typedef struct {
+    uint64_t s[4][MCO_FAST_LANES];
+} mco_fast_rng;
+
+/*
+ * Seed every lane from successive draws of rng.
+ */
+void mco_fast_rng_init(mco_fast_rng *lanes, mco_rng *rng);
+
+/*
+ * Next draw of every lane into out.
+ */
+MCO_SPECIALISE void mco_fast_rng_next(mco_fast_rng *lanes, uint64_t *out)
+{
+    for (int l = 0; l < MCO_FAST_LANES; ++l) {
+        uint64_t s0 = lanes->s[0][l], s1 = lanes->s[1][l];
+        uint64_t s2 = lanes->s[2][l], s3 = lanes->s[3][l];
+        uint64_t x = s1 + (s1 << 2);                    /* s1·5 */
+        x = (x << 7) | (x >> 57);
+        out[l] = x + (x << 3);                          /* ·9 */
+
+        uint64_t t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = (s3 << 45) | (s3 >> 19);
+
+        lanes->s[0][l] = s0;
+        lanes->s[1][l] = s1;
+        lanes->s[2][l] = s2;
+        lanes->s[3][l] = s3;
+    }
+}
+
+/*============================================================================
+ * Float Elementary Functions
+ *============================================================================*/
+
+MCO_SPECIALISE float mco_fast_bits_to_float(uint32_t bits)
+{
+    float f;
+    memcpy(&f, &bits, sizeof f);
+    return f;
+}
+
+MCO_SPECIALISE uint32_t mco_fast_float_to_bits(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof bits);
+    return bits;
+}
+
+/*
+ * e^x, clamped to the normal float range
+ */
+MCO_SPECIALISE float mco_fast_expf(float x)
+{
+    /* NaN takes the lower clamp */
+    x = (x > -87.0f) ? x : -87.0f;
+    x = (x < 88.0f) ? x : 88.0f;
+
+    /* x = n·ln 2 + r, |r| ≤ ½·ln 2; n rounded by the 1.5·2²³ shift */
+    float n = (x * 1.44269504f + 12582912.0f) - 12582912.0f;
+    float r = x - n * 0.693145752f;             /* ln 2, high bits */
+    r = r - n * 1.42860677e-06f;                /* ln 2, low bits */
+
+    float p = 1.0f + r * (1.0f + r * (0.5f + r * (1.66666672e-01f
+            + r * (4.16666679e-02f + r * (8.33333377e-03f + r * 1.38888892e-03f)))));
+
+    return p * mco_fast_bits_to_float((uint32_t)((int32_t)n + 127) << 23);
+}
+
+/*
+ * log x for positive normal x
+ */
+MCO_SPECIALISE float mco_fast_logf(float x)
+{
+    uint32_t bits = mco_fast_float_to_bits(x);
+    float e = (float)((int32_t)(bits >> 23) - 127);
+    float m = mco_fast_bits_to_float((bits & 0x007fffffu) | 0x3f800000u);  /* [1, 2) */
+
+    /* Fold into [√½, √2) */
+    int high = m > 1.41421356f;
+    float m_half = 0.5f * m;
+    float e_next = e + 1.0f;
+    m = high ? m_half : m;
+    e = high ? e_next : e;
+
+    /* log m = 2·atanh(t), t = (m - 1)/(m + 1), |t| ≤ 0.172 */
+    float t = (m - 1.0f) / (m + 1.0f);
+    float t2 = t * t;
+    float p = 2.0f * t * (1.0f + t2 * (3.33333343e-01f + t2 * (2.00000003e-01f
+            + t2 * (1.42857149e-01f + t2 * 1.11111112e-01f))));
+
+    return e * 0.693147182f + p;
+}
+
+/*
+ * Standard normal from a raw draw: u = (k + ½)·2⁻²³ for the top 23 bits
+ * k, z = √2·erfinv(2u - 1) (Giles 2010, single precision).
+ */
+MCO_SPECIALISE float mco_fast_normal(uint64_t draw)
+{
+    float k = (float)(int32_t)(draw >> 41);
+    float x = (2.0f * k + 1.0f) * 1.1920929e-07f - 1.0f;   /* 2u - 1, exact */
+    float w = -mco_fast_logf((1.0f - x) * (1.0f + x));
+
+    /* Central branch, w < 5 */
+    float wc = w - 2.5f;
+    float pc = 2.81022636e-08f;
+    pc = 3.43273939e-07f + pc * wc;
+    pc = -3.5233877e-06f + pc * wc;
+    pc = -4.39150654e-06f + pc * wc;
+    pc = 0.00021858087f + pc * wc;
+    pc = -0.00125372503f + pc * wc;
+    pc = -0.00417768164f + pc * wc;
+    pc = 0.246640727f + pc * wc;
+    pc = 1.50140941f + pc * wc;
+
+    /* Tail branch */
+    float wt = sqrtf(w) - 3.0f;
+    float pt = -0.000200214257f;
+    pt = 0.000100950558f + pt * wt;
+    pt = 0.00134934322f + pt * wt;
+    pt = -0.00367342844f + pt * wt;
+    pt = 0.00573950773f + pt * wt;
+    pt = -0.0076224613f + pt * wt;
+    pt = 0.00943887047f + pt * wt;
+    pt = 1.00167406f + pt * wt;
+    pt = 2.83297682f + pt * wt;
+
+    float p = (w < 5.0f) ? pc : pt;
+    return 1.41421356f * p * x;
+}
+
+/*
+ * Uniform in (0, 1) from the top 24 bits of a raw draw
+ */
+MCO_SPECIALISE float mco_fast_uniform(uint64_t draw)
+{
+    return ((float)(int32_t)(draw >> 40) + 0.5f) * 5.96046448e-08f;
+}
+
+/*============================================================================
+ * Contracts
+ *============================================================================*/
+
+/*
+ * Statistics a walk keeps per lane
+ */
+typedef enum {
+    MCO_FAST_WALK_TERMINAL = 0,     /* S(T) only */
+    MCO_FAST_WALK_SUM,              /* Σ S(tᵢ), i = 1..n */
+    MCO_FAST_WALK_LOG_SUM,          /* Σ log S(tᵢ) */
+    MCO_FAST_WALK_EXTREMA,          /* min / max over S(t₀..tₙ) */
+    MCO_FAST_WALK_BARRIER_DOWN,     /* Bridge-monitored barrier below S₀ */
+    MCO_FAST_WALK_BARRIER_UP        /* ... above S₀ */
+} mco_fast_walk;
+
+/*
+ * Payoff operands, per lane
+ */
+typedef enum {
+    MCO_FAST_SPOT = 0,              /* S(T) */
+    MCO_FAST_AVERAGE,               /* Arithmetic or geometric average */
+    MCO_FAST_MIN,
+    MCO_FAST_MAX,
+    MCO_FAST_STRIKE
+} mco_fast_operand;
+
+/*
+ * Paid when φ·(X - Y) > 0: the difference itself, the payout, or X
+ */
+typedef enum {
+    MCO_FAST_PAY_DIFF = 0,
+    MCO_FAST_PAY_CASH,
+    MCO_FAST_PAY_ASSET
+} mco_fast_pay;
+
+typedef struct {
+    /* Model, on a uniform grid of num_steps steps */
+    double spot;
+    double drift_dt;        /* (r - ½σ²)·Δt */
+    double diffusion_dt;    /* σ·√Δt */
+    double discount;        /* Applied to the mean */
+    size_t num_steps;
+
+    /* Path statistics and payoff */
+    mco_fast_walk walk;
+    mco_fast_operand x;
+    mco_fast_operand y;
+    mco_fast_pay pay;
+    double phi;             /* +1 call, -1 put */
+    double strike;
+    double payout;          /* MCO_FAST_PAY_CASH */
+
+    /* Barrier walks */
+    double barrier;
+    double rebate;          /* Knock-out rebate, paid at maturity */
+    int knock_in;
+} mco_fast_spec;
+
+/*
+ * Model fields of a spec on a uniform grid (num_steps = 1 for the
+ * terminal walk); the payoff fields are zeroed.
+ */
+void mco_fast_spec_init(mco_fast_spec *spec, double spot, double rate,
+                        double volatility, double time, size_t num_steps,
+                        mco_fast_walk walk);
+
+/*
+ * Sums of the payoff and its square
+ */
+typedef struct {
+    mco_sum sum;
+    mco_sum sq;
+} mco_fast_sums;
+
+/*
+ * Price a spec in fast mode over ctx->num_simulations paths (on
+ * ctx->num_threads threads); writes the standard error of the estimate
+ * to *std_error if non-NULL.
+ *
+ * Returns the discounted mean, or 0 with ctx->last_error set.
+ */
+double mco_fast_price(mco_ctx *ctx, const mco_fast_spec *spec, double *std_error);
+
+#endif /* MCO_INTERNAL_METHODS_FAST_MC_H */
@@ -0,0 +1,41 @@
+/*
+ * Persistent Job Pool
+ *
+ * Backs the asynchronous job API (mco_submit and friends). A context
+ * owns at most one pool: its workers start on the first submission and
+ * block on a FIFO queue of jobs until the context is freed.
+ *
+ * Jobs:
+ *   A job holds a copy of the context, taken at submission, with one
+ *   thread and no pool, and runs the synchronous pricer on that copy.
+ *   Jobs in flight therefore share nothing with each other or with the
+ *   context except the borrowed exercise cache, which locks. The queue
+ *   is intrusive (a next pointer in each job), so submitting allocates
+ *   only the job itself.
+ *
+ * Completion:
+ *   A job moves QUEUED -> RUNNING -> DONE -> FINISHED under its own
+ *   lock. DONE means the result is set and the callback is running;
+ *   mco_job_wait returns from DONE, mco_job_free waits for FINISHED. A
+ *   callback that frees its own job only marks it, and the worker frees
+ *   it once the callback returns.
+ *
+ * Shutdown:
+ *   mco_job_pool_free stops the workers after the queue drains, so every
+ *   submitted job completes and its callback runs.
+ */
+
+#ifndef MCO_INTERNAL_METHODS_JOB_POOL_H
+#define MCO_INTERNAL_METHODS_JOB_POOL_H
+
+#include "internal/context.h"
+#include <stdint.h>
+
+typedef struct mco_job_pool mco_job_pool;
+
+/*
+ * Run the queued jobs, stop the workers and release the pool.
+ */
+void mco_job_pool_free(mco_job_pool *pool);
+
+#endif /* MCO_INTERNAL_METHODS_JOB_POOL_H */
@@ -0,0 +1,149 @@
+/*
+ * Vector Kernels
+ *
+ * The inner loops that vectorise, gathered behind one table so they can
+ * be compiled for several instruction-set levels and chosen at run
+ * time (see internal/cpu.h):
+ *
+ *   binomial_sweep   - Leisen-Reimer backward induction for one strike
+ *   trinomial_sweep  - trinomial backward induction for one strike
+ *   pde_step         - one Crank-Nicolson / implicit step of a full
+ *                      MCO_PDE_BLOCK block (Thomas sweeps across lanes)
+ *   pde_step_lane    - the same for a single contract
+ *   fast_paths       - float32 Monte Carlo lanes (internal/methods/fast_mc.h):
+ *                      normal generation, stepping and payoff reduction
+ *                      of MCO_FAST_LANES paths at a time
+ *   inv_normal       - Moro inverse normal CDF of a block of uniforms
+ *                      (Latin hypercube blocks, Sobol normals)
+ *   sobol_next       - one Gray-code Sobol point
+ *   barrier_values   - Reiner-Rubinstein values of a batch of barriers
+ *
+ * Contexts pick their table by level; context-free entry points (Sobol,
+ * the analytic batches) use the process default, mco_cpu_default_level.
+ *
+ * src/methods/kernels.c is compiled once per level; each object
+ * defines one table.
+ */
+
+#ifndef MCO_INTERNAL_METHODS_KERNELS_H
+#define MCO_INTERNAL_METHODS_KERNELS_H
+
+#include "mcoptions.h"
+#include "internal/methods/pde.h"
+#include "internal/methods/fast_mc.h"
+#include "internal/methods/sobol.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Price of one strike on an n-step binomial tree. values holds the n + 1
+ * terminal payoffs and spots the terminal node spots; both are
+ * overwritten. Node (i, j) = node (i + 1, j) / d, continuation
+ * pu·V[j + 1] + pd·V[j], exercise on levels with flags[i] set.
+ */
+typedef double (*mco_binomial_sweep_fn)(size_t n,
+                                        const unsigned char *flags,
+                                        double strike,
+                                        mco_option_type type,
+                                        double inv_d,
+                                        double pu,
+                                        double pd,
+                                        double *values,
+                                        double *spots);
+
+/*
+ * Backward sweep for one strike on an n-step trinomial tree. values
+ * holds the 2n + 1 terminal payoffs on entry and the price in values[0]
+ * on exit; level i node j has spot spots[n - i + j].
+ */
+typedef void (*mco_trinomial_sweep_fn)(size_t n,
+                                       const unsigned char *flags,
+                                       const double *spots,
+                                       double strike,
+                                       mco_option_type type,
+                                       double wd,
+                                       double wm,
+                                       double wu,
+                                       double *values);
+
+/*
+ * One step of an n-node block to τ: Crank-Nicolson (explicit = 1) or an
+ * implicit half-step (explicit = 0), with Brennan-Schwartz projection
+ * when project is set. lower_bv and upper_bv are the edge values at τ.
+ */
+typedef void (*mco_pde_step_fn)(mco_pde_block *blk,
+                                size_t n,
+                                int downward,
+                                double explicit,
+                                int project,
+                                const double *lower_bv,
+                                const int *lower_fixed,
+                                const double *upper_bv);
+
+/*
+ * Simulate n_paths paths of a fast-mode spec, in blocks of
+ * MCO_FAST_LANES, adding the undiscounted payoffs to sums.
+ */
+typedef void (*mco_fast_paths_fn)(const mco_fast_spec *spec,
+                                  mco_fast_rng *rng,
+                                  uint64_t n_paths,
+                                  mco_fast_sums *sums);
+
+/*
+ * Replace each of the n uniforms in (0, 1) with its standard normal
+ * quantile, bitwise equal to mco_sobol_inv_normal.
+ */
+typedef void (*mco_inv_normal_fn)(double *u, size_t n);
+
+/*
+ * Advance a Sobol point by direction c: x[d] ^= v[d·MCO_SOBOL_BITS + c],
+ * point[d] = x[d]·2⁻³², for d < dim.
+ */
+typedef void (*mco_sobol_next_fn)(uint32_t dim,
+                                  const uint32_t *v,
+                                  int c,
+                                  uint32_t *x,
+                                  double *point);
+
+/*
+ * All eight analytic values of n contracts (structure of arrays);
+ * rebate may be NULL. As mco_barrier_analytic_values_batch.
+ */
+typedef void (*mco_barrier_values_fn)(const double *spot,
+                                      const double *strike,
+                                      const double *barrier,
+                                      const double *rebate,
+                                      const double *rate,
+                                      const double *volatility,
+                                      const double *time,
+                                      size_t n,
+                                      size_t monitor_dates,
+                                      mco_barrier_values *out);
+
+typedef struct {
+    mco_cpu_level level;
+    mco_binomial_sweep_fn binomial_sweep;
+    mco_trinomial_sweep_fn trinomial_sweep;
+    mco_pde_step_fn pde_step;           /* Width MCO_PDE_BLOCK */
+    mco_pde_step_fn pde_step_lane;      /* Width 1 */
+    mco_fast_paths_fn fast_paths;
+    mco_inv_normal_fn inv_normal;
+    mco_sobol_next_fn sobol_next;
+    mco_barrier_values_fn barrier_values;
+} mco_kernels;
+
+/* One table per compiled level */
+extern const mco_kernels mco_kernels_generic;
+#if defined(__x86_64__)
+extern const mco_kernels mco_kernels_sse42;
+extern const mco_kernels mco_kernels_avx2;
+extern const mco_kernels mco_kernels_avx512;
+#endif
+
+/*
+ * Kernels for a level, falling back to the highest compiled level
+ * below it.
+ */
+const mco_kernels *mco_kernels_get(mco_cpu_level level);
+
+#endif /* MCO_INTERNAL_METHODS_KERNELS_H */
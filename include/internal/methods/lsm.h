@@ -14,13 +14,21 @@
  *   4. Discount the optimal exercise payoffs to time 0
  *
  * Regression:
- *   Uses weighted Laguerre polynomials as basis functions:
+ *   Continuation values of in-the-money paths are regressed on a basis
+ *   chosen on the context (mco_set_lsm_basis), by default the
+ *   Laguerre polynomials of Longstaff-Schwartz (unweighted):
  *     L0(x) = 1
  *     L1(x) = 1 - x
  *     L2(x) = 1 - 2x + x²/2
- *   
+ *
  *   Regression: E[V|S] ≈ β0·L0(S/K) + β1·L1(S/K) + β2·L2(S/K)
  *
+ *   The normal equations A'A·β = A'y are accumulated path by path in
+ *   the same pass that finds the in-the-money paths, so the design
+ *   matrix A is never stored. They are solved by Cholesky after scaling
+ *   A'A to unit diagonal and adding a small ridge, which keeps
+ *   high-degree polynomial fits well conditioned.
+ *
  * Reference:
  *   Longstaff, F.A. and Schwartz, E.S. (2001)
  *   "Valuing American Options by Simulation: A Simple Least-Squares Approach"
@@ -32,13 +40,50 @@
 
 #include "internal/context.h"
 #include "internal/instruments/payoff.h"
+#include "internal/variance_reduction/control_variates.h"
 #include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Largest basis: constant, degree MCO_LSM_MAX_DEGREE terms, payoff.
+ */
+#define MCO_LSM_MAX_BASIS (MCO_LSM_MAX_DEGREE + 2)
+
+/*
+ * Regression basis resolved from the context settings for one contract
+ */
+typedef struct {
+    int kind;              /* mco_lsm_basis_type */
+    size_t degree;         /* Highest polynomial degree */
+    int payoff;            /* Exercise value as a regressor */
+    size_t num_basis;      /* degree + 1 (+ 1 with payoff) */
+    double inv_strike;     /* 1/K */
+    double inv_scale;      /* 1/(σ√T), POLYNOMIAL and HERMITE */
+    double ridge;          /* Ridge on the scaled normal matrix */
+} mco_lsm_basis;
 
 /*
- * Number of basis functions for regression.
- * Using 3 Laguerre polynomials (constant, linear, quadratic).
+ * Normal equations A'A·β = A'y, accumulated without storing A
  */
-#define MCO_LSM_NUM_BASIS 3
+typedef struct {
+    size_t num_basis;
+    uint64_t count;                                    /* Rows added */
+    double ata[MCO_LSM_MAX_BASIS * MCO_LSM_MAX_BASIS]; /* Row stride MCO_LSM_MAX_BASIS */
+    double atb[MCO_LSM_MAX_BASIS];
+} mco_lsm_normal;
+
+/*
+ * Exercise policy: the regression fitted at each date of a schedule
+ * (the last date is maturity). Exercise where the exercise value beats
+ * K·β·φ(S); coefficients are stored per unit strike so the policy can
+ * be reused for any strike at the same moneyness.
+ */
+typedef struct {
+    mco_lsm_basis basis;     /* Basis of the fit (inv_strike set per use) */
+    size_t num_dates;
+    double *coeffs;          /* num_dates × MCO_LSM_MAX_BASIS, per unit strike */
+    unsigned char *fitted;   /* 0: no regression at the date, never exercise */
+} mco_exercise_policy;
 
 /*
  * Price an American option using Least Squares Monte Carlo.
@@ -70,44 +115,232 @@ double mco_lsm_american(mco_ctx *ctx,
                         mco_option_type type);
 
 /*
- * Laguerre polynomial basis functions (normalized by strike).
+ * mco_lsm_american for a strip of strikes on one underlying.
+ *
+ * The paths are simulated and stored once, and the basis is evaluated
+ * in S/S₀ once per date for all strikes: polynomials in S/K and in S/S₀
+ * span the same space, so each strike's fit is unchanged (only the
+ * payoff regressor, when enabled, is per strike). One backward pass
+ * then runs every strike's regression and exercise update at each
+ * date, leaving only that work per strike. Uses the same paths as
+ * mco_lsm_american, so prices agree with one-at-a-time pricing up to
+ * rounding in the fit. Does not read or fill the exercise cache.
+ *
+ * Sets MCO_ERR_NOMEM (out untouched) on allocation failure.
+ */
+void mco_lsm_american_strip(mco_ctx *ctx,
+                            double spot,
+                            const double *strikes,
+                            size_t num_strikes,
+                            double rate,
+                            double volatility,
+                            double time_to_maturity,
+                            size_t num_steps,
+                            mco_option_type type,
+                            double *out);
+
+/*
+ * Same as mco_lsm_american, also returning the exercise policy.
  *
- * L0(x) = exp(-x/2)
- * L1(x) = exp(-x/2) * (1 - x)
- * L2(x) = exp(-x/2) * (1 - 2x + x²/2)
+ * policy_out (may be NULL) is allocated here; on any failure it comes
+ * back with coeffs == NULL. Release it with mco_exercise_policy_free
+ * either way. With an exercise cache on the context a cached policy is
+ * reused (forward pass only) and a freshly fitted one is stored.
+ */
+double mco_lsm_american_policy(mco_ctx *ctx,
+                               double spot,
+                               double strike,
+                               double rate,
+                               double volatility,
+                               double time_to_maturity,
+                               size_t num_steps,
+                               mco_option_type type,
+                               mco_exercise_policy *policy_out);
+
+/*
+ * Resolve the context's basis settings for a contract.
+ */
+void mco_lsm_basis_init(mco_lsm_basis *basis,
+                        const mco_ctx *ctx,
+                        double strike,
+                        double volatility,
+                        double time_to_maturity);
+
+/*
+ * Evaluate the basis at spot (exercise = immediate exercise value).
  *
- * We use the simpler non-exponential form for numerical stability:
- * L0(x) = 1
- * L1(x) = 1 - x
- * L2(x) = 1 - 2x + x²/2
+ *   LAGUERRE:   Lₖ(x), x = S/K, via (k+1)·Lₖ₊₁ = (2k+1-x)·Lₖ - k·Lₖ₋₁
+ *   POLYNOMIAL: uᵏ, u = (x - 1)/(σ√T)
+ *   HERMITE:    Heₖ(u), via Heₖ₊₁ = u·Heₖ - k·Heₖ₋₁
+ *   payoff:     exercise/K in the last slot
  */
-static inline void mco_lsm_basis(double x, double *basis)
+static inline void mco_lsm_basis_eval(const mco_lsm_basis *basis,
+                                      double spot,
+                                      double exercise,
+                                      double *phi)
 {
-    basis[0] = 1.0;
-    basis[1] = 1.0 - x;
-    basis[2] = 1.0 - 2.0 * x + 0.5 * x * x;
+    double x = spot * basis->inv_strike;
+    size_t degree = basis->degree;
+
+    phi[0] = 1.0;
+
+    if (basis->kind == MCO_LSM_LAGUERRE) {
+        phi[1] = 1.0 - x;
+        for (size_t k = 1; k < degree; ++k) {
+            double dk = (double)k;
+            phi[k + 1] = ((2.0 * dk + 1.0 - x) * phi[k] - dk * phi[k - 1]) / (dk + 1.0);
+        }
+    } else if (basis->kind == MCO_LSM_POLYNOMIAL) {
+        double u = (x - 1.0) * basis->inv_scale;
+        for (size_t k = 1; k <= degree; ++k) {
+            phi[k] = phi[k - 1] * u;
+        }
+    } else {
+        double u = (x - 1.0) * basis->inv_scale;
+        phi[1] = u;
+        for (size_t k = 1; k < degree; ++k) {
+            phi[k + 1] = u * phi[k] - (double)k * phi[k - 1];
+        }
+    }
+
+    if (basis->payoff) {
+        phi[degree + 1] = exercise * basis->inv_strike;
+    }
+}
+
+static inline void mco_lsm_normal_reset(mco_lsm_normal *ne, size_t num_basis)
+{
+    ne->num_basis = num_basis;
+    ne->count = 0;
+    for (size_t j = 0; j < num_basis; ++j) {
+        ne->atb[j] = 0.0;
+        for (size_t k = 0; k < num_basis; ++k) {
+            ne->ata[j * MCO_LSM_MAX_BASIS + k] = 0.0;
+        }
+    }
 }
 
 /*
- * Solve least squares regression: minimize ||Ax - b||²
+ * Add one regression row: A'A += φφ', A'y += φ·y.
  *
- * Uses normal equations: (A'A)x = A'b
- * Solved via Cholesky-like decomposition for small systems.
+ * Full rows rather than the upper triangle: the inner loop is a
+ * contiguous multiply-add the compiler vectorises.
+ */
+static inline void mco_lsm_normal_add(mco_lsm_normal *ne, const double *phi, double y)
+{
+    size_t n = ne->num_basis;
+
+    for (size_t j = 0; j < n; ++j) {
+        double pj = phi[j];
+        double *row = ne->ata + j * MCO_LSM_MAX_BASIS;
+
+        ne->atb[j] += pj * y;
+        for (size_t k = 0; k < n; ++k) {
+            row[k] += pj * phi[k];
+        }
+    }
+    ne->count++;
+}
+
+/*
+ * Solve the normal equations for the regression coefficients.
+ *
+ * A'A is scaled to unit diagonal (D·A'A·D, D = diag(A'A)^(-1/2)), λ is
+ * added to the diagonal, and the system is solved by Cholesky.
+ *
+ * Returns:
+ *   0 on success, -1 if there are fewer rows than basis functions or
+ *   the scaled matrix is not positive definite (coeffs are zeroed)
+ */
+int mco_lsm_solve(const mco_lsm_normal *ne, double ridge, double *coeffs);
+
+/*
+ * Fitted continuation value β·φ.
+ */
+static inline double mco_lsm_continuation(const double *coeffs,
+                                          const double *phi,
+                                          size_t num_basis)
+{
+    double continuation = 0.0;
+    for (size_t k = 0; k < num_basis; ++k) {
+        continuation += coeffs[k] * phi[k];
+    }
+    return continuation;
+}
+
+/*
+ * One backward LSM step at an exercise date.
+ *
+ * Regresses the (already discounted) cash flows of the in-the-money
+ * paths on the basis, then exercises where immediate value exceeds the
+ * fitted continuation, overwriting cashflow[i].
  *
  * Parameters:
- *   A      - Design matrix (n_samples × n_basis), row-major
- *   b      - Target vector (n_samples)
- *   coeffs - Output coefficients (n_basis)
- *   n_samples - Number of samples
- *   n_basis   - Number of basis functions
+ *   basis    - Resolved regression basis
+ *   spots    - spots[i * stride] = S(t) of path i at this date
+ *   stride   - Distance between consecutive paths in spots
+ *   cashflow - Per-path cash flow, discounted to this date
+ *   n_paths  - Number of paths
+ *   strike   - Strike price
+ *   type     - MCO_CALL or MCO_PUT
+ *   coeffs   - Output coefficients (basis->num_basis)
  *
  * Returns:
- *   0 on success, -1 if matrix is singular
+ *   0 if the regression was fitted, -1 if the step was skipped (too few
+ *   in-the-money paths or a singular system; no path is exercised)
+ */
+int mco_lsm_exercise_step(const mco_lsm_basis *basis,
+                          const double *spots,
+                          size_t stride,
+                          double *cashflow,
+                          uint64_t n_paths,
+                          double strike,
+                          mco_option_type type,
+                          double *coeffs);
+
+/*
+ * Time-0 price from the fitted cash flows.
+ *
+ * cashflow[i] is discounted to the first exercise date; discount takes
+ * it to time 0. With controls (pc non-NULL and pc->k > 0) each path's
+ * controls are evaluated on its terminal spot terminal[i * stride] and
+ * the regression-adjusted mean is returned; otherwise the plain mean.
+ * std_error, when non-NULL, receives the matching standard error.
+ */
+double mco_lsm_price(const double *cashflow,
+                     double discount,
+                     const double *terminal,
+                     size_t stride,
+                     uint64_t n_paths,
+                     const mco_path_controls *pc,
+                     mco_mcv_stats *stats,
+                     double *std_error);
+
+/*
+ * Allocate a policy for num_dates dates fitted in `basis`.
+ * Returns 0 on success, -1 on allocation failure.
  */
-int mco_lsm_regress(const double *A,
-                    const double *b,
-                    double *coeffs,
-                    size_t n_samples,
-                    size_t n_basis);
+int mco_exercise_policy_init(mco_exercise_policy *policy,
+                             const mco_lsm_basis *basis,
+                             size_t num_dates);
+
+void mco_exercise_policy_free(mco_exercise_policy *policy);
+
+/*
+ * Record the regression at a date (coeffs in cash units for `strike`;
+ * NULL marks the date as not fitted).
+ */
+static inline void mco_exercise_policy_record(mco_exercise_policy *policy,
+                                              size_t date,
+                                              const double *coeffs,
+                                              double strike)
+{
+    double *dst = policy->coeffs + date * MCO_LSM_MAX_BASIS;
+
+    policy->fitted[date] = coeffs ? 1 : 0;
+    for (size_t k = 0; k < policy->basis.num_basis; ++k) {
+        dst[k] = coeffs ? coeffs[k] / strike : 0.0;
+    }
+}
 
 #endif /* MCO_INTERNAL_METHODS_LSM_H */
@@ -0,0 +1,116 @@
+/*
+ * Multilevel Monte Carlo (MLMC)
+ *
+ * Single-level Monte Carlo to RMSE ε needs O(ε⁻²) paths of O(ε⁻¹) steps
+ * each (for a first-order scheme), so cost grows like ε⁻³. MLMC spreads
+ * the work over a hierarchy of step sizes.
+ *
+ * Telescoping sum:
+ *   Let P_l be the payoff computed with n_l = n₀·2ˡ steps. Then
+ *
+ *     E[P_L] = E[P_0] + Σ_{l=1}^{L} E[P_l - P_{l-1}]
+ *
+ *   and each term is estimated independently: Y_0 = P_0, and for l ≥ 1
+ *   Y_l = P_l - P_{l-1} computed on the SAME Brownian path at step
+ *   sizes h and 2h. The coarse increment over [t, t+2h] is the sum of
+ *   the two fine increments, i.e. its normal is (Z₂ᵢ + Z₂ᵢ₊₁)/√2.
+ *
+ *   Because fine and coarse paths are coupled, V_l = Var[Y_l] shrinks
+ *   like 2^{-βl} and most paths can be spent on the cheap levels.
+ *
+ * Optimal allocation (Giles 2008):
+ *   With per-path cost C_l, minimising total cost for variance ε²/2
+ *   gives
+ *
+ *     N_l = ⌈ 2ε⁻² · √(V_l / C_l) · Σ_k √(V_k C_k) ⌉
+ *
+ * Adding levels:
+ *   The weak error is estimated from the last level means assuming
+ *   |E[Y_l]| ∝ 2^{-αl}:
+ *
+ *     bias ≈ max(|Ŷ_L|, |Ŷ_{L-1}|/2^α) / (2^α - 1)
+ *
+ *   and a level is added while bias > ε/√2. α and β are fitted to the
+ *   sampled levels by least squares on log₂|Ŷ_l| and log₂ V_l. At
+ *   MCO_MLMC_MAX_LEVELS no level is added: the run still meets the
+ *   variance target, and result->bias keeps the weak error estimate,
+ *   which may then exceed ε/√2.
+ *
+ * Complexity:
+ *   O(ε⁻²) when β > 1 (cost grows like 2ˡ), O(ε⁻²(log ε)²) when β = 1.
+ *
+ * Reference:
+ *   Giles, M.B. (2008). Multilevel Monte Carlo path simulation.
+ *   Operations Research, 56(3), 607-617.
+ */
+
+#ifndef MCO_INTERNAL_METHODS_MLMC_H
+#define MCO_INTERNAL_METHODS_MLMC_H
+
+#include "internal/context.h"
+#include "internal/rng.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Steps at level 0 */
+#define MCO_MLMC_BASE_STEPS 4
+
+/* Levels sampled before the bias test (0 .. MIN - 1) */
+#define MCO_MLMC_MIN_LEVELS 3
+
+/* Hard cap: finest level uses BASE_STEPS · 2^(MAX - 1) steps */
+#define MCO_MLMC_MAX_LEVELS 12
+
+/* Initial paths per level for the variance estimates */
+#define MCO_MLMC_WARMUP 1000
+
+/*
+ * One coupled sample at a level.
+ *
+ * Returns Y_0 = P_0 for level 0 and Y_l = P_l - P_{l-1} otherwise.
+ * scratch holds scratch_per_step · (base_steps · 2^level) + 2 doubles.
+ */
+typedef double (*mco_mlmc_sample_fn)(const void *problem,
+                                     size_t level,
+                                     mco_rng *rng,
+                                     double *scratch);
+
+/*
+ * Problem description for the MLMC driver
+ */
+typedef struct {
+    mco_mlmc_sample_fn sample;  /* Coupled level sampler */
+    const void *problem;        /* Passed through to sample */
+    size_t base_steps;          /* Steps at level 0 */
+    size_t scratch_per_step;    /* Scratch doubles per fine step */
+} mco_mlmc_problem;
+
+/*
+ * Per-level diagnostics from a run
+ */
+typedef struct {
+    size_t num_levels;                      /* Levels used (L + 1) */
+    uint64_t paths[MCO_MLMC_MAX_LEVELS];    /* N_l */
+    double mean[MCO_MLMC_MAX_LEVELS];       /* Ŷ_l */
+    double variance[MCO_MLMC_MAX_LEVELS];   /* V_l (sample variance, n - 1) */
+    double cost[MCO_MLMC_MAX_LEVELS];       /* C_l (steps per path) */
+    double estimate;                        /* Σ Ŷ_l */
+    double std_error;                       /* √(Σ V_l / N_l) */
+    double bias;                            /* Weak error estimate */
+    double total_cost;                      /* Σ N_l C_l */
+} mco_mlmc_result;
+
+/*
+ * Run MLMC to the target RMSE.
+ *
+ * Levels are sampled in parallel batches (ctx->num_threads) with RNG
+ * streams derived from ctx->rng. Sets ctx->last_std_error.
+ *
+ * Returns 0 on success, -1 on failure with ctx->last_error set.
+ */
+int mco_mlmc_run(mco_ctx *ctx,
+                 const mco_mlmc_problem *problem,
+                 double target_rmse,
+                 mco_mlmc_result *result);
+
+#endif /* MCO_INTERNAL_METHODS_MLMC_H */
@@ -0,0 +1,170 @@
+/*
+ * Crank-Nicolson Finite Differences
+ *
+ * Solves the Black-Scholes PDE in time to maturity τ on a spot grid,
+ *
+ *   V_τ = ½σ²S²·V_SS + rS·V_S - rV
+ *
+ * with the three-point non-uniform differences for V_S and V_SS, so
+ * every step is one tridiagonal solve
+ *
+ *   (I - ½Δτ·L)·Vⁿ⁺¹ = (I + ½Δτ·L)·Vⁿ
+ *
+ * Rannacher start-up:
+ *   Crank-Nicolson does not damp the high-frequency error from a kinked
+ *   or discontinuous payoff, which then rings in gamma. The first
+ *   MCO_PDE_RANNACHER_STEPS steps are each replaced by two implicit
+ *   Euler half-steps. An implicit half-step solves (I - ½Δτ·L)·V = V,
+ *   the same matrix as Crank-Nicolson, so one factorisation serves both.
+ *
+ * Grid:
+ *   Nodes are uniform in ξ(S) = Σₖ asinh((S - Bₖ)/αₖ) (Tavella-Randall),
+ *   which concentrates them around each Bₖ - the strike and any
+ *   barrier - with width αₖ. The strike is moved onto its nearest node.
+ *   A knock-out barrier is the grid edge with a Dirichlet rebate; the
+ *   far edge is the asymptotic value and S = 0 is the degenerate row
+ *   V_τ = -rV.
+ *
+ * Batching:
+ *   Contracts are solved MCO_PDE_BLOCK at a time in structure-of-arrays
+ *   layout, element [i·MCO_PDE_BLOCK + j] for node i of contract j.
+ *   Each contract has its own grid and coefficients but the same node
+ *   and step counts, so the Thomas sweeps run node by node with a
+ *   vector loop across the block. The forward sweep is a dependence
+ *   chain down the nodes, so a lone contract is latency-bound; a block
+ *   runs its lanes through the same chain at about four times the
+ *   throughput. Small remainders are solved one contract at a time.
+ *   The matrix does not change in time; its elimination factors are
+ *   computed once per block.
+ *
+ * Early exercise:
+ *   Projection after each step, V = max(V, payoff), at every step
+ *   (American) or at the step nearest each exercise date (Bermudan).
+ *
+ * Greeks:
+ *   Price, delta and gamma come from the quadratic through the three
+ *   nodes around the spot, theta from the last time step.
+ *
+ * References:
+ *   Rannacher, R. (1984). "Finite element solution of diffusion problems
+ *   with irregular data", Numerische Mathematik 43.
+ *   Tavella, D. & Randall, C. (2000). "Pricing Financial Instruments:
+ *   The Finite Difference Method", Wiley.
+ */
+
+#ifndef MCO_INTERNAL_METHODS_PDE_H
+#define MCO_INTERNAL_METHODS_PDE_H
+
+#include "internal/context.h"
+#include "internal/instruments/payoff.h"
+#include <stddef.h>
+
+/* Contracts per structure-of-arrays block */
+#define MCO_PDE_BLOCK 16
+
+/* Crank-Nicolson steps replaced by implicit half-steps */
+#define MCO_PDE_RANNACHER_STEPS 2
+
+/* Far edge of the grid, in standard deviations of log-spot */
+#define MCO_PDE_STDDEVS 6.0
+
+/*
+ * Terminal payoff
+ */
+typedef enum {
+    MCO_PDE_VANILLA = 0,
+    MCO_PDE_CASH    = 1,   /* Cash-or-nothing, pays the contract payout */
+    MCO_PDE_ASSET   = 2    /* Asset-or-nothing */
+} mco_pde_payoff;
+
+/*
+ * Settings shared by every contract in a solve
+ */
+typedef struct {
+    mco_pde_payoff payoff;
+    mco_option_type type;
+    int american;                   /* Exercise at every step */
+    const double *exercise_times;   /* Bermudan dates in years (borrowed), overrides american */
+    size_t num_exercise;
+    size_t space_nodes;
+    size_t time_steps;
+    mco_cpu_level cpu_level;        /* Kernel level (from the context) */
+} mco_pde_spec;
+
+/*
+ * One contract
+ */
+typedef struct {
+    double spot;
+    double strike;
+    double rate;
+    double volatility;
+    double time;
+    double payout;          /* Cash-or-nothing amount */
+    double lower_barrier;   /* Knock-out levels, 0 = none */
+    double upper_barrier;
+    double rebate;          /* Paid at maturity when knocked out */
+} mco_pde_contract;
+
+/*
+ * Structure-of-arrays state for one block, every array n × width
+ */
+typedef struct {
+    double *nodes;
+    double *ha;         /* ½Δτ × sub-, main and super-diagonal of L */
+    double *hb;
+    double *hc;
+    double *cp;         /* Thomas: eliminated super-diagonal */
+    double *w;          /* Thomas: inverse pivots */
+    double *values;
+    double *work;
+    double *exercise;
+} mco_pde_block;
+
+/*
+ * Spec from the context's grid settings: European, no exercise dates.
+ */
+void mco_pde_spec_init(mco_pde_spec *spec,
+                       const mco_ctx *ctx,
+                       mco_pde_payoff payoff,
+                       mco_option_type type);
+
+/*
+ * Solvable contract: positive spot, strike, volatility and time, spot
+ * strictly between the barriers.
+ */
+int mco_pde_contract_valid(const mco_pde_contract *contract);
+
+/*
+ * Solve n contracts. Contracts that are not valid get a zero result.
+ *
+ * Returns 0, or -1 on allocation failure.
+ */
+int mco_pde_solve(const mco_pde_spec *spec,
+                  const mco_pde_contract *contracts,
+                  size_t n,
+                  mco_pde_result *out);
+
+/*
+ * n contracts without barriers from parallel arrays, for the batch
+ * pricers. Returns NULL on allocation failure; free with mco_free.
+ */
+mco_pde_contract *mco_pde_contracts_new(const double *spot,
+                                        const double *strike,
+                                        const double *rate,
+                                        const double *volatility,
+                                        const double *time,
+                                        size_t n);
+
+/*
+ * mco_pde_solve for a public batch pricer: MCO_ERR_INVALID_ARG if any
+ * contract has a non-positive spot, strike, volatility or time,
+ * MCO_ERR_NOMEM (and zero results) on allocation failure.
+ */
+void mco_pde_run(mco_ctx *ctx,
+                 const mco_pde_spec *spec,
+                 const mco_pde_contract *contracts,
+                 size_t n,
+                 mco_pde_result *out);
+
+#endif /* MCO_INTERNAL_METHODS_PDE_H */
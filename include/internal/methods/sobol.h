@@ -32,6 +32,7 @@
 #ifndef MCO_INTERNAL_METHODS_SOBOL_H
 #define MCO_INTERNAL_METHODS_SOBOL_H
 
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -41,6 +42,33 @@
 /* Bits for precision (32-bit) */
 #define MCO_SOBOL_BITS 32
 
+/*
+ * Moro's inverse normal CDF in two pieces, x = u - 0.5: a rational
+ * central region for |x| < MCO_MORO_CENTRAL and a log-log tail. The
+ * central piece has no libm call, so a block of uniforms can take it
+ * across vector lanes and patch the tails afterwards.
+ */
+#define MCO_MORO_CENTRAL 0.42
+
+static inline double mco_moro_central(double x)
+{
+    double r = x * x;
+    return x * (((-25.44106049637 * r + 41.39119773534) * r - 18.61500062529) * r
+                + 2.50662823884)
+         / ((((3.13082909833 * r - 21.06224101826) * r + 23.08336743743) * r
+             - 8.47351093090) * r + 1.0);
+}
+
+static inline double mco_moro_tail(double u, double x)
+{
+    double r = log(-log((x > 0.0) ? 1.0 - u : u));
+    r = 0.3374754822726147 + r * (0.9761690190917186 + r * (0.1607979714918209
+        + r * (0.0276438810333863 + r * (0.0038405729373609 + r * (0.0003951896511919
+        + r * (0.0000321767881768 + r * (0.0000002888167364
+        + r * 0.0000003960315187)))))));
+    return (x < 0.0) ? -r : r;
+}
+
 /*
  * Sobol sequence state
  */
@@ -5,6 +5,7 @@
  *   - Each thread gets its own RNG state (via jump() for reproducibility)
  *   - Work is divided into chunks, one per thread
  *   - Results are accumulated without locks (each thread writes to its own slot)
+ *     and reduced in thread order with mco_sum_merge (internal/sum.h)
  *
  * Threading model:
  *   - Single-threaded (num_threads=1): No pthread overhead, direct execution
@@ -20,6 +21,7 @@
 
 #include "internal/context.h"
 #include "internal/rng.h"
+#include "internal/sum.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -30,7 +32,7 @@ typedef struct {
     mco_rng rng;              /* Thread-local RNG state */
     uint64_t start_sim;       /* First simulation index (inclusive) */
     uint64_t end_sim;         /* Last simulation index (exclusive) */
-    double partial_sum;       /* Accumulated payoff sum */
+    mco_sum partial_sum;      /* Accumulated payoff sum */
     double partial_sum_sq;    /* Accumulated payoff^2 (for variance) */
 
     /* Option parameters (copied for cache locality) */
@@ -41,6 +43,8 @@ typedef struct {
     double time_to_maturity;
     int option_type;          /* MCO_CALL or MCO_PUT */
     int antithetic;           /* Use antithetic variates */
+    int stratified;           /* Stratify terminal normal by global path index */
+    uint64_t num_strata;      /* Total strata (= total simulations) */
 } mco_thread_work;
 
 /*
@@ -58,7 +62,7 @@ typedef struct {
  * After this call, each work[i] has:
  *   - Unique RNG state (jumped i times from base)
  *   - start_sim and end_sim defining its chunk
- *   - partial_sum = 0
+ *   - partial_sum empty
  */
 void mco_thread_work_init(mco_thread_work *work,
                           uint32_t num_threads,
@@ -84,4 +88,48 @@ double mco_parallel_european(mco_ctx *ctx,
                              double time_to_maturity,
                              int type);
 
+/*============================================================================
+ * Generic Parallel Loop
+ *============================================================================*/
+
+/*
+ * Per-thread body for mco_parallel_for.
+ *
+ * Called once per thread with that thread's RNG and its [start, end)
+ * slice of the simulation range. thread_id indexes any per-thread
+ * result slots the caller keeps in arg.
+ */
+typedef void (*mco_parallel_fn)(void *arg,
+                                uint32_t thread_id,
+                                mco_rng *rng,
+                                uint64_t start,
+                                uint64_t end);
+
+/*
+ * Run fn over total_sims simulations using ctx->num_threads threads.
+ *
+ * RNG streams follow mco_thread_work_init (thread i = jump^i of ctx->rng),
+ * so results match the other parallel pricers for the same seed and
+ * thread count. With one thread fn runs inline on a copy of ctx->rng.
+ *
+ * Returns:
+ *   Number of threads used (slots 0..n-1 were written), or 0 on failure
+ *   with ctx->last_error set.
+ */
+uint32_t mco_parallel_for(mco_ctx *ctx,
+                          uint64_t total_sims,
+                          mco_parallel_fn fn,
+                          void *arg);
+
+/*
+ * As mco_parallel_for, but the thread streams are derived from base_rng
+ * instead of ctx->rng. Drivers that run several batches (MLMC) advance
+ * their own stream between batches so no batch reuses random numbers.
+ */
+uint32_t mco_parallel_for_rng(mco_ctx *ctx,
+                              const mco_rng *base_rng,
+                              uint64_t total_sims,
+                              mco_parallel_fn fn,
+                              void *arg);
+
 #endif /* MCO_INTERNAL_METHODS_THREAD_POOL_H */
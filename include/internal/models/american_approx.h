@@ -0,0 +1,88 @@
+/*
+ * Analytic American Option Approximations
+ *
+ * Closed-form (or near closed-form) approximations to the American
+ * price under GBM with cost of carry b (b = r for a non-dividend stock,
+ * b = r - q with a dividend yield q, b = 0 for a futures option).
+ *
+ * Barone-Adesi-Whaley (1987):
+ *   The early-exercise premium solves the Black-Scholes PDE with the
+ *   time derivative scaled away, giving a quadratic in the exponent.
+ *   Call, for S < S*:
+ *
+ *     C = c(S) + A₂·(S/S*)^q₂
+ *
+ *   with the critical price S* found by Newton iteration on the
+ *   smooth-pasting condition. The put is symmetric with q₁ < 0.
+ *
+ * Bjerksund-Stensland (2002):
+ *   Exercise against a two-piece flat boundary: I₂ until t₁, then the
+ *   lower I₁ to maturity, t₁ = (√5 - 1)/2·T. Every term is explicit -
+ *   univariate and bivariate normal CDFs, no iteration. As the exact
+ *   value of one (sub-optimal) exercise rule it is a lower bound on the
+ *   true price. The put follows from the put-call transformation
+ *
+ *     P(S, K, T, r, b, σ) = C(K, S, T, r - b, -b, σ)
+ *
+ * Both reduce to the European price when early exercise is never
+ * optimal (call with b ≥ r, put with r ≤ 0).
+ *
+ * References:
+ *   Barone-Adesi, G. & Whaley, R. (1987). "Efficient Analytic
+ *   Approximation of American Option Values", Journal of Finance 42.
+ *   Bjerksund, P. & Stensland, G. (2002). "Closed Form Valuation of
+ *   American Options", NHH discussion paper.
+ */
+
+#ifndef MCO_INTERNAL_MODELS_AMERICAN_APPROX_H
+#define MCO_INTERNAL_MODELS_AMERICAN_APPROX_H
+
+#include "internal/instruments/payoff.h"
+#include <stddef.h>
+
+/*
+ * Approximation method
+ */
+typedef enum {
+    MCO_AMERICAN_BAW    = 0,   /* Barone-Adesi-Whaley */
+    MCO_AMERICAN_BJS2002 = 1   /* Bjerksund-Stensland 2002 */
+} mco_american_approx;
+
+/*
+ * Generalised Black-Scholes with cost of carry b
+ *
+ *   Call = S·e^((b-r)T)·N(d₁) - K·e^(-rT)·N(d₂)
+ */
+double mco_gbs_price(double spot, double strike, double rate, double carry,
+                     double volatility, double time, mco_option_type type);
+
+/*
+ * Barone-Adesi-Whaley American price with cost of carry b
+ */
+double mco_baw_price(double spot, double strike, double rate, double carry,
+                     double volatility, double time, mco_option_type type);
+
+/*
+ * Bjerksund-Stensland 2002 American price with cost of carry b
+ */
+double mco_bjs2002_price(double spot, double strike, double rate, double carry,
+                         double volatility, double time, mco_option_type type);
+
+/*
+ * Price n contracts (structure of arrays, cost of carry = rate).
+ *
+ * The exercise boundary depends on (r, σ, T) only and scales with the
+ * strike, so it is solved once per run of equal (r, σ, T) and reused;
+ * a strike or spot ladder costs one boundary solve.
+ */
+void mco_american_approx_batch(mco_american_approx method,
+                               const double *spot,
+                               const double *strike,
+                               const double *rate,
+                               const double *volatility,
+                               const double *time,
+                               size_t n,
+                               mco_option_type type,
+                               double *out);
+
+#endif /* MCO_INTERNAL_MODELS_AMERICAN_APPROX_H */
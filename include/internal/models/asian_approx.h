@@ -0,0 +1,110 @@
+/*
+ * Analytic Arithmetic Asian Approximations
+ *
+ * Fixed-strike arithmetic-average options under GBM, averaging over
+ * the same dates as the path pricers, tᵢ = i·T/n for i = 1..n, paid
+ * at T:
+ *
+ *   A = (1/n)·Σ S(tᵢ),   call = e^(-rT)·E[(A - K)⁺]
+ *
+ * The first two moments of the discrete average are exact,
+ *
+ *   M₁ = (S/n)·Σᵢ e^(r·tᵢ)
+ *   M₂ = (S²/n²)·Σᵢ Σⱼ e^(r·(tᵢ + tⱼ) + σ²·min(tᵢ, tⱼ))
+ *
+ * and are summed in O(n) multiplications (powers by recurrence).
+ *
+ * Turnbull-Wakeman (1991):
+ *   A is replaced by the lognormal with the same M₁ and M₂, priced by
+ *   Black-76 on forward M₁ with total variance v = ln(M₂/M₁²).
+ *
+ * Levy (1992):
+ *   The same lognormal fit to the continuously sampled average, whose
+ *   moments are closed form: O(1) whatever the number of fixings and
+ *   the n → ∞ limit of Turnbull-Wakeman, for daily-fixing books.
+ *
+ * Curran (1994):
+ *   Conditions on the geometric average G, which is lognormal and
+ *   jointly normal in log with every S(tᵢ). Above K, A ≥ G ≥ K is in
+ *   the money for sure and that part is exact; below K the conditional
+ *   expectation is approximated through a shifted strike
+ *
+ *     K̂ = 2K - (1/n)·Σᵢ exp(μᵢ + cᵢ·(ln K - μ_G)/v_G + ½·(vᵢ - cᵢ²/v_G))
+ *
+ *   with μᵢ, vᵢ the mean and variance of ln S(tᵢ), μ_G, v_G those of
+ *   ln G and cᵢ = Cov(ln S(tᵢ), ln G). The most accurate of the three,
+ *   at n normal CDFs per price. When K̂ ≤ 0 (deep in the money) it
+ *   falls back to Turnbull-Wakeman.
+ *
+ * Puts follow from put-call parity, P = C - e^(-rT)·(M₁ - K), which
+ * holds exactly since M₁ is exact.
+ *
+ * References:
+ *   Turnbull, S. & Wakeman, L. (1991). "A Quick Algorithm for Pricing
+ *   European Average Options", JFQA 26.
+ *   Levy, E. (1992). "Pricing European Average Rate Currency Options",
+ *   Journal of International Money and Finance 11.
+ *   Curran, M. (1994). "Valuing Asian and Portfolio Options by
+ *   Conditioning on the Geometric Mean Price", Management Science 40.
+ */
+
+#ifndef MCO_INTERNAL_MODELS_ASIAN_APPROX_H
+#define MCO_INTERNAL_MODELS_ASIAN_APPROX_H
+
+#include "mcoptions.h"
+#include <stddef.h>
+
+/*
+ * First two moments of the discrete average per unit spot:
+ * M₁ = spot·m1, M₂ = spot²·m2.
+ */
+void mco_asian_moments(double rate, double volatility, double time,
+                       size_t num_obs, double *m1, double *m2);
+
+/*
+ * Approximate fixed-strike arithmetic Asian price. Invalid inputs
+ * (non-positive spot or strike, negative volatility or time, no
+ * observations) give 0.
+ */
+double mco_asian_approx_price(mco_asian_approx method,
+                              double spot,
+                              double strike,
+                              double rate,
+                              double volatility,
+                              double time,
+                              size_t num_obs,
+                              mco_option_type type);
+
+/*
+ * Mean of the Curran control for Monte Carlo,
+ *
+ *   Z = e^(-rT)·φ·(A - K)·1{φ·(G - K) > 0},   φ = +1 call, -1 put
+ *
+ * the exact part of Curran's decomposition. Z equals the payoff on
+ * every path except those with G and A on opposite sides of K, so it
+ * tracks the arithmetic payoff far more closely than the geometric
+ * option does.
+ */
+double mco_asian_curran_control_mean(double spot, double strike, double rate,
+                                     double volatility, double time,
+                                     size_t num_obs, mco_option_type type);
+
+/*
+ * Price n contracts (structure of arrays) sharing num_obs.
+ *
+ * The moments scale with spot, so they are computed once per run of
+ * identical (r, σ, T) and reused: a strike or spot ladder costs one
+ * O(n) moment sum.
+ */
+void mco_asian_approx_price_batch(mco_asian_approx method,
+                                  const double *spot,
+                                  const double *strike,
+                                  const double *rate,
+                                  const double *volatility,
+                                  const double *time,
+                                  size_t n,
+                                  size_t num_obs,
+                                  mco_option_type type,
+                                  double *out);
+
+#endif /* MCO_INTERNAL_MODELS_ASIAN_APPROX_H */
@@ -110,9 +110,11 @@ static inline double mco_gbm_simulate_antithetic(const mco_gbm *model,
  */
 typedef struct {
     double spot;           /* Initial spot price S(0) */
+    double log_spot;       /* log S(0) */
     double dt;             /* Time step size: T / num_steps */
     double drift_dt;       /* (r - 0.5·σ²)·dt */
     double diffusion_dt;   /* σ·√dt */
+    double variance_dt;    /* σ²·dt (Brownian-bridge extremum) */
     double discount;       /* exp(-r·T) */
     size_t num_steps;      /* Number of time steps */
 } mco_gbm_path;
@@ -130,9 +132,11 @@ static inline void mco_gbm_path_init(mco_gbm_path *model,
     double dt = time / (double)num_steps;
 
     model->spot         = spot;
+    model->log_spot     = log(spot);
     model->dt           = dt;
     model->drift_dt     = (rate - 0.5 * volatility * volatility) * dt;
     model->diffusion_dt = volatility * sqrt(dt);
+    model->variance_dt  = volatility * volatility * dt;
     model->discount     = exp(-rate * time);
     model->num_steps    = num_steps;
 }
@@ -149,6 +153,23 @@ static inline double mco_gbm_step(const mco_gbm_path *model,
     return current_spot * exp(model->drift_dt + model->diffusion_dt * z);
 }
 
+/*
+ * Advance log-spot by one time step.
+ *
+ * x(t+dt) = x(t) + drift_dt + diffusion_dt · Z,   x = log S
+ *
+ * A path in log coordinates is a cumulative sum - no transcendental
+ * call per step. Payoffs that only compare, extremise or average logs
+ * (barriers, lookbacks, geometric averages) never need exp until the
+ * final payoff.
+ */
+static inline double mco_gbm_log_step(const mco_gbm_path *model,
+                                      double log_spot,
+                                      double z)
+{
+    return log_spot + model->drift_dt + model->diffusion_dt * z;
+}
+
 /*
  * Simulate a full path, storing all intermediate prices.
  *
@@ -173,6 +194,23 @@ static inline void mco_gbm_simulate_path(const mco_gbm_path *model,
     }
 }
 
+/*
+ * Build a path from caller-supplied normals (one per step).
+ *
+ * Used when the normals come from a structured sampler (LHS) rather
+ * than straight from the RNG.
+ */
+static inline void mco_gbm_path_from_normals(const mco_gbm_path *model,
+                                             const double *z,
+                                             double *path)
+{
+    path[0] = model->spot;
+
+    for (size_t i = 0; i < model->num_steps; ++i) {
+        path[i + 1] = mco_gbm_step(model, path[i], z[i]);
+    }
+}
+
 /*
  * Black-Scholes closed-form solution (for validation & control variates)
  *
@@ -0,0 +1,105 @@
+/*
+ * GBM on an Arbitrary Date Schedule
+ *
+ * GBM has an exact transition over any interval, so a path is only ever
+ * needed at the dates a payoff looks at - observation, monitoring or
+ * exercise dates - not on a fine uniform grid:
+ *
+ *   x(tᵢ) = x(tᵢ₋₁) + (r - ½σ²)·Δtᵢ + σ·√Δtᵢ · Zᵢ,   x = log S, t₀ = 0
+ *
+ * The per-interval drift and diffusion are precomputed once, so a step
+ * costs one multiply-add whatever the spacing. Dates are taken as given
+ * (no rounding to a grid), and an uneven schedule (month ends, coupon
+ * dates) costs no more than an even one.
+ *
+ * The uniform schedule tᵢ = i·T/n reproduces mco_gbm_path exactly.
+ */
+
+#ifndef MCO_INTERNAL_MODELS_GBM_SCHEDULE_H
+#define MCO_INTERNAL_MODELS_GBM_SCHEDULE_H
+
+#include "internal/rng.h"
+#include <math.h>
+#include <stddef.h>
+
+/*
+ * GBM sampled at dates t₁ ≤ t₂ ≤ ... ≤ tₙ
+ */
+typedef struct {
+    double spot;           /* Initial spot price S(0) */
+    double log_spot;       /* log S(0) */
+    double rate;           /* Risk-free rate r */
+    double maturity;       /* Last date tₙ */
+    double discount;       /* exp(-r·tₙ) */
+    size_t num_dates;      /* n */
+    int uniform;           /* tᵢ = i·tₙ/n (to rounding) */
+    double *times;         /* tᵢ (n) */
+    double *drift;         /* (r - ½σ²)·Δtᵢ (n) */
+    double *diffusion;     /* σ·√Δtᵢ (n) */
+} mco_gbm_schedule;
+
+/*
+ * Build the schedule from dates in years.
+ *
+ * times must be non-decreasing with times[0] ≥ 0 (check with
+ * mco_gbm_schedule_valid). Repeated dates are allowed and give a
+ * zero-length step.
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+int mco_gbm_schedule_init(mco_gbm_schedule *sched,
+                          double spot,
+                          double rate,
+                          double volatility,
+                          const double *times,
+                          size_t num_dates);
+
+/*
+ * Build the uniform schedule tᵢ = i·T/n, i = 1..n.
+ */
+int mco_gbm_schedule_init_uniform(mco_gbm_schedule *sched,
+                                  double spot,
+                                  double rate,
+                                  double volatility,
+                                  double time,
+                                  size_t num_dates);
+
+/*
+ * Release the schedule arrays.
+ */
+void mco_gbm_schedule_free(mco_gbm_schedule *sched);
+
+/*
+ * 1 if times is a usable schedule: non-empty, finite, non-decreasing,
+ * starting at or after 0.
+ */
+int mco_gbm_schedule_valid(const double *times, size_t num_dates);
+
+/*
+ * Advance log-spot from date i-1 to date i (i is 0-based: step i ends
+ * at times[i]).
+ */
+static inline double mco_gbm_schedule_log_step(const mco_gbm_schedule *sched,
+                                               size_t i,
+                                               double log_spot,
+                                               double z)
+{
+    return log_spot + sched->drift[i] + sched->diffusion[i] * z;
+}
+
+/*
+ * Simulate spot at every date: out[i] = S(tᵢ), i = 0..n-1.
+ */
+static inline void mco_gbm_schedule_simulate(const mco_gbm_schedule *sched,
+                                             mco_rng *rng,
+                                             double *out)
+{
+    double x = sched->log_spot;
+
+    for (size_t i = 0; i < sched->num_dates; ++i) {
+        x = mco_gbm_schedule_log_step(sched, i, x, mco_rng_normal(rng));
+        out[i] = exp(x);
+    }
+}
+
+#endif /* MCO_INTERNAL_MODELS_GBM_SCHEDULE_H */
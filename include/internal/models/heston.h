@@ -192,17 +192,17 @@ static inline void mco_heston_step_euler(const mco_heston_path *model,
 }
 
 /*
- * QE (Quadratic Exponential) scheme - more accurate for variance
+ * QE (Quadratic Exponential) variance update
  *
- * Andersen (2008) scheme that better preserves variance distribution
+ * Andersen (2008) scheme that better preserves variance distribution.
+ * Advances v(t) -> v(t+dt) only; the spot is left to the caller.
+ * The conditional Monte Carlo pricer uses this on its own, since it
+ * never simulates the spot noise.
  */
-static inline void mco_heston_step_qe(const mco_heston_path *model,
-                                       double *spot,
-                                       double *var,
-                                       mco_rng *rng)
+static inline double mco_heston_qe_variance(const mco_heston_path *model,
+                                            double v,
+                                            mco_rng *rng)
 {
-    double s = *spot;
-    double v = *var;
     double dt = model->dt;
 
     /* Ensure positive variance */
@@ -238,6 +238,26 @@ static inline void mco_heston_step_qe(const mco_heston_path *model,
         }
     }
 
+    return v_next;
+}
+
+/*
+ * QE (Quadratic Exponential) scheme - more accurate for variance
+ *
+ * Variance via mco_heston_qe_variance, then a log-spot update that
+ * uses the trapezoidal integrated variance over the step.
+ */
+static inline void mco_heston_step_qe(const mco_heston_path *model,
+                                       double *spot,
+                                       double *var,
+                                       mco_rng *rng)
+{
+    double s = *spot;
+    double v = fmax(*var, 0.0);
+    double dt = model->dt;
+
+    double v_next = mco_heston_qe_variance(model, v, rng);
+
     /* Spot update using integrated variance (approximation) */
     double v_avg = 0.5 * (v + v_next);
     double sqrt_v_avg = sqrt(fmax(v_avg, 0.0));
@@ -160,19 +160,17 @@ static inline int mco_poisson(mco_rng *rng, double lambda_dt)
 }
 
 /*
- * Simulate one step of Merton dynamics
- *
- * Using Euler discretization:
- *   S(t+dt) = S(t) · exp((r - λk - σ²/2)dt + σ√dt·Z + Σⱼ log(Jⱼ))
+ * Simulate one step of Merton dynamics given the diffusion normal z
  *
- * Where the sum is over N ~ Poisson(λdt) jumps
+ * Jumps are still drawn from rng. Shadow-path control variates use this
+ * to reuse z for a pure-diffusion GBM driven in lockstep.
  */
-static inline void mco_merton_step(const mco_merton_path *model,
-                                    double *spot,
-                                    mco_rng *rng)
+static inline void mco_merton_step_z(const mco_merton_path *model,
+                                      double *spot,
+                                      double z,
+                                      mco_rng *rng)
 {
     double s = *spot;
-    double z = mco_rng_normal(rng);
 
     /* Diffusion part */
     double drift = (model->rate - model->lambda * model->k
@@ -191,6 +189,22 @@ static inline void mco_merton_step(const mco_merton_path *model,
     *spot = s * exp(drift + diffusion + jump_sum);
 }
 
+/*
+ * Simulate one step of Merton dynamics
+ *
+ * Using Euler discretization:
+ *   S(t+dt) = S(t) · exp((r - λk - σ²/2)dt + σ√dt·Z + Σⱼ log(Jⱼ))
+ *
+ * Where the sum is over N ~ Poisson(λdt) jumps
+ */
+static inline void mco_merton_step(const mco_merton_path *model,
+                                    double *spot,
+                                    mco_rng *rng)
+{
+    double z = mco_rng_normal(rng);
+    mco_merton_step_z(model, spot, z, rng);
+}
+
 /*
  * Simulate Merton path
  */
@@ -0,0 +1,62 @@
+/*
+ * Compile-Time Kernel Specialisation
+ *
+ * The Monte Carlo pricers take a handful of run-time switches - option
+ * type, payoff style, barrier direction, sampler, controls - that are
+ * fixed for the whole call but were tested on every path and, inside
+ * the stepper, on every step. Each pricer now writes its path loop once
+ * as a template,
+ *
+ *   MCO_SPECIALISE double foo_paths(const foo_run *run, unsigned variant)
+ *   {
+ *       ... if (variant & FOO_CALL) ... (variant & FOO_LHS) ? ... : ...
+ *   }
+ *
+ * where variant is a bitmask of the pricer's flags, and instantiates it
+ * for every combination with constant variants:
+ *
+ *   #define FOO_KERNEL(v) \
+ *       static double foo_paths_##v(const foo_run *run) { return foo_paths(run, v); }
+ *   MCO_VARIANTS_16(FOO_KERNEL)
+ *
+ *   #define FOO_ENTRY(v) foo_paths_##v,
+ *   static double (*const foo_kernels[16])(const foo_run *) = { MCO_VARIANTS_16(FOO_ENTRY) };
+ *
+ * The template is always inlined, so every flag test folds and each
+ * instance holds only its own branch of every switch; the pricer builds
+ * the variant once per call and makes one indirect call through the
+ * table. Instances consume the RNG in the same order as the generic
+ * loop and do the same arithmetic, so results do not change.
+ *
+ * Helpers called from a template with constant flags (the streaming
+ * path state, the LHS stepper) are MCO_SPECIALISE too, so the constants
+ * reach their inner loops.
+ */
+
+#ifndef MCO_INTERNAL_SPECIALISE_H
+#define MCO_INTERNAL_SPECIALISE_H
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MCO_SPECIALISE static inline __attribute__((always_inline))
+#else
+#define MCO_SPECIALISE static inline
+#endif
+
+/*
+ * M(v) for v = 0 .. 2ⁿ - 1
+ */
+#define MCO_VARIANTS_2(M)  M(0) M(1)
+#define MCO_VARIANTS_4(M)  MCO_VARIANTS_2(M) M(2) M(3)
+#define MCO_VARIANTS_8(M)  MCO_VARIANTS_4(M) M(4) M(5) M(6) M(7)
+#define MCO_VARIANTS_16(M) MCO_VARIANTS_8(M) \
+    M(8) M(9) M(10) M(11) M(12) M(13) M(14) M(15)
+#define MCO_VARIANTS_32(M) MCO_VARIANTS_16(M) \
+    M(16) M(17) M(18) M(19) M(20) M(21) M(22) M(23) \
+    M(24) M(25) M(26) M(27) M(28) M(29) M(30) M(31)
+#define MCO_VARIANTS_64(M) MCO_VARIANTS_32(M) \
+    M(32) M(33) M(34) M(35) M(36) M(37) M(38) M(39) \
+    M(40) M(41) M(42) M(43) M(44) M(45) M(46) M(47) \
+    M(48) M(49) M(50) M(51) M(52) M(53) M(54) M(55) \
+    M(56) M(57) M(58) M(59) M(60) M(61) M(62) M(63)
+
+#endif /* MCO_INTERNAL_SPECIALISE_H */
@@ -0,0 +1,122 @@
+/*
+ * Blocked Pairwise Summation
+ *
+ * Every Monte Carlo estimate ends in a sum over paths. A running
+ * sum += x over N values has an error bound of N·ε·Σ|x| (typically
+ * √N·ε) and is one serial chain of dependent adds. mco_sum replaces it
+ * in every pricer, in the thread-pool reductions and in the float-lane
+ * kernels.
+ *
+ * Blocks:
+ *   Values fill blocks of MCO_SUM_BLOCK. Value i of a block goes to lane
+ *   i mod MCO_SUM_LANES, so consecutive adds are independent chains, and
+ *   a bulk add of a lane-aligned array is one vector add per
+ *   MCO_SUM_LANES values.
+ *
+ * Pairwise cascade:
+ *   A full block's total joins a binary counter of partial sums: level k
+ *   holds the sum of 2ᵏ blocks, and a new block carries up through the
+ *   occupied levels like an increment, merging equal-sized sums - the
+ *   pairwise tree, built online in O(log N) space. Levels are kept as
+ *   unevaluated hi + lo pairs and merged with Knuth's TwoSum, so the
+ *   merges add no rounding error of their own.
+ *
+ * The error is that of one block lane, about (MCO_SUM_BLOCK /
+ * MCO_SUM_LANES)·ε·Σ|x| = 64ε relative for positive payoffs, whatever
+ * N is. Adding costs one lane add per value plus a cascade step per
+ * block.
+ *
+ * Determinism:
+ *   The result depends only on the sequence of values: mco_sum_add and
+ *   mco_sum_add_n put value i in the same lane and block. mco_sum_merge
+ *   folds in another accumulator's compensated total; merging thread
+ *   slots in thread order gives the same result for the same thread
+ *   count.
+ *
+ * Reference:
+ *   Higham, N.J. (1993). "The Accuracy of Floating Point Summation",
+ *   SIAM J. Sci. Comput. 14(4).
+ */
+
+#ifndef MCO_INTERNAL_SUM_H
+#define MCO_INTERNAL_SUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Independent accumulators within a block */
+#define MCO_SUM_LANES 4
+
+/* Values per block (a multiple of MCO_SUM_LANES) */
+#define MCO_SUM_BLOCK 256
+
+/* Cascade levels: 2⁴⁸ blocks of MCO_SUM_BLOCK values */
+#define MCO_SUM_LEVELS 48
+
+typedef struct {
+    double lane[MCO_SUM_LANES];     /* Current block */
+    uint32_t fill;                  /* Values in the current block */
+    uint64_t blocks;                /* Completed blocks: bit k = level k held */
+    double hi[MCO_SUM_LEVELS];      /* Level k: sum of 2ᵏ blocks, hi + lo */
+    double lo[MCO_SUM_LEVELS];
+    double merged_hi;               /* Totals folded in by mco_sum_merge */
+    double merged_lo;
+} mco_sum;
+
+/*
+ * Push the full current block into the cascade.
+ */
+void mco_sum_flush(mco_sum *s);
+
+/*
+ * Fold src's total into dst.
+ */
+void mco_sum_merge(mco_sum *dst, const mco_sum *src);
+
+/*
+ * Compensated total of everything added and merged so far.
+ */
+double mco_sum_value(const mco_sum *s);
+
+static inline void mco_sum_init(mco_sum *s)
+{
+    for (int l = 0; l < MCO_SUM_LANES; ++l) s->lane[l] = 0.0;
+    s->fill = 0;
+    s->blocks = 0;
+    s->merged_hi = 0.0;
+    s->merged_lo = 0.0;
+}
+
+static inline void mco_sum_add(mco_sum *s, double x)
+{
+    s->lane[s->fill % MCO_SUM_LANES] += x;
+    if (++s->fill == MCO_SUM_BLOCK) mco_sum_flush(s);
+}
+
+/*
+ * Add n values; the same result as n calls of mco_sum_add.
+ */
+static inline void mco_sum_add_n(mco_sum *s, const double *x, size_t n)
+{
+    /* Up to a lane boundary */
+    while (n > 0 && s->fill % MCO_SUM_LANES != 0) {
+        mco_sum_add(s, *x++);
+        --n;
+    }
+
+    /* Whole lane rows */
+    while (n >= MCO_SUM_LANES) {
+        for (int l = 0; l < MCO_SUM_LANES; ++l) s->lane[l] += x[l];
+        x += MCO_SUM_LANES;
+        n -= MCO_SUM_LANES;
+        s->fill += MCO_SUM_LANES;
+        if (s->fill == MCO_SUM_BLOCK) mco_sum_flush(s);
+    }
+
+    while (n > 0) {
+        mco_sum_add(s, *x++);
+        --n;
+    }
+}
+
+#endif /* MCO_INTERNAL_SUM_H */
@@ -41,13 +41,14 @@
 #include "internal/models/gbm.h"
 #include "internal/instruments/payoff.h"
 #include "internal/rng.h"
+#include "internal/sum.h"
 #include <stdint.h>
 
 /*
  * Simulate European option payoffs with antithetic variates.
  *
- * Generates num_pairs pairs of paths using (Z, -Z).
- * Returns sum of all 2*num_pairs payoffs (NOT averaged).
+ * Generates num_pairs pairs of paths using (Z, -Z) and adds all
+ * 2*num_pairs payoffs (NOT averaged) to sum.
  *
  * Parameters:
  *   model     - Initialized GBM model
@@ -55,29 +56,25 @@
  *   strike    - Strike price
  *   type      - MCO_CALL or MCO_PUT
  *   num_pairs - Number of (Z, -Z) pairs to simulate
- *
- * Returns:
- *   Sum of payoffs (caller divides by 2*num_pairs and discounts)
+ *   sum       - Payoff accumulator (caller divides by 2*num_pairs and
+ *               discounts)
  */
-static inline double mco_antithetic_european_sum(const mco_gbm *model,
-                                                  mco_rng *rng,
-                                                  double strike,
-                                                  mco_option_type type,
-                                                  uint64_t num_pairs)
+static inline void mco_antithetic_european_sum(const mco_gbm *model,
+                                               mco_rng *rng,
+                                               double strike,
+                                               mco_option_type type,
+                                               uint64_t num_pairs,
+                                               mco_sum *sum)
 {
-    double sum = 0.0;
-
     for (uint64_t i = 0; i < num_pairs; ++i) {
         double z = mco_rng_normal(rng);
 
         double spot_plus  = mco_gbm_terminal(model, z);
         double spot_minus = mco_gbm_terminal(model, -z);
 
-        sum += mco_payoff(spot_plus, strike, type);
-        sum += mco_payoff(spot_minus, strike, type);
+        mco_sum_add(sum, mco_payoff(spot_plus, strike, type));
+        mco_sum_add(sum, mco_payoff(spot_minus, strike, type));
     }
-
-    return sum;
 }
 
 /*
@@ -105,8 +102,10 @@ static inline double mco_antithetic_european(const mco_gbm *model,
     uint64_t num_pairs = num_sims / 2;
     if (num_pairs == 0) num_pairs = 1;
 
-    double sum = mco_antithetic_european_sum(model, rng, strike, type, num_pairs);
-    double mean = sum / (double)(2 * num_pairs);
+    mco_sum sum;
+    mco_sum_init(&sum);
+    mco_antithetic_european_sum(model, rng, strike, type, num_pairs, &sum);
+    double mean = mco_sum_value(&sum) / (double)(2 * num_pairs);
 
     return model->discount * mean;
 }
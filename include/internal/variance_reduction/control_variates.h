@@ -34,6 +34,13 @@
  * 4. Antithetic + Control (combined):
  *    Use both techniques together
  *
+ * 5. Model-based shadow paths (stochastic vol / jumps):
+ *    Drive a GBM (or Black-76 forward) with the same normals as the
+ *    model path; its payoff has a closed-form expectation
+ *    - Heston: GBM at the mean expected variance, priced by Black-Scholes
+ *    - SABR:   lognormal forward at the Hagan vol, priced by Black-76
+ *    - Merton: the pure-diffusion part, priced by Black-Scholes
+ *
  * Implementation:
  *   1. Simulate paths, compute both X_i and Z_i for each path
  *   2. Estimate optimal c = Cov(X,Z) / Var(Z)
@@ -45,7 +52,9 @@
 
 #include "internal/context.h"
 #include "internal/instruments/payoff.h"
+#include "internal/instruments/path_state.h"
 #include <stddef.h>
+#include <math.h>
 
 /*
  * Control variate type
@@ -60,13 +69,18 @@ typedef enum {
 
 /*
  * Control variate statistics
+ *
+ * Running means and co-moments (Welford), so the optimal coefficient
+ * c = Cov(X,Z) / Var(Z) can be read off at any point without the
+ * cancellation that raw sums of squares suffer on large runs. Per-thread
+ * accumulators are combined with mco_cv_merge (Chan et al. pairwise update).
  */
 typedef struct {
-    double sum_x;       /* Sum of primary estimator */
-    double sum_z;       /* Sum of control variate */
-    double sum_xx;      /* Sum of X² */
-    double sum_zz;      /* Sum of Z² */
-    double sum_xz;      /* Sum of X·Z */
+    double mean_x;      /* Running mean of primary estimator */
+    double mean_z;      /* Running mean of control variate */
+    double m2_x;        /* Σ(x - mean_x)² */
+    double m2_z;        /* Σ(z - mean_z)² */
+    double c_xz;        /* Σ(x - mean_x)·(z - mean_z) */
     double ez;          /* Known E[Z] */
     uint64_t n;         /* Sample count */
 } mco_cv_stats;
@@ -76,11 +90,11 @@ typedef struct {
  */
 static inline void mco_cv_init(mco_cv_stats *stats, double ez)
 {
-    stats->sum_x  = 0.0;
-    stats->sum_z  = 0.0;
-    stats->sum_xx = 0.0;
-    stats->sum_zz = 0.0;
-    stats->sum_xz = 0.0;
+    stats->mean_x = 0.0;
+    stats->mean_z = 0.0;
+    stats->m2_x   = 0.0;
+    stats->m2_z   = 0.0;
+    stats->c_xz   = 0.0;
     stats->ez     = ez;
     stats->n      = 0;
 }
@@ -90,12 +104,65 @@ static inline void mco_cv_init(mco_cv_stats *stats, double ez)
  */
 static inline void mco_cv_add(mco_cv_stats *stats, double x, double z)
 {
-    stats->sum_x  += x;
-    stats->sum_z  += z;
-    stats->sum_xx += x * x;
-    stats->sum_zz += z * z;
-    stats->sum_xz += x * z;
     stats->n++;
+    double n = (double)stats->n;
+
+    double dx = x - stats->mean_x;
+    double dz = z - stats->mean_z;
+    stats->mean_x += dx / n;
+    stats->mean_z += dz / n;
+
+    /* Old deviation × new deviation keeps the update exact */
+    stats->m2_x += dx * (x - stats->mean_x);
+    stats->m2_z += dz * (z - stats->mean_z);
+    stats->c_xz += dx * (z - stats->mean_z);
+}
+
+/*
+ * Merge src into dst (parallel reduction)
+ *
+ * Both accumulators must share the same E[Z]. Merging thread slots in
+ * a fixed order keeps results reproducible for a given thread count.
+ */
+static inline void mco_cv_merge(mco_cv_stats *dst, const mco_cv_stats *src)
+{
+    if (src->n == 0) return;
+    if (dst->n == 0) {
+        double ez = dst->ez;
+        *dst = *src;
+        dst->ez = ez;
+        return;
+    }
+
+    double na = (double)dst->n;
+    double nb = (double)src->n;
+    double n  = na + nb;
+
+    double dx = src->mean_x - dst->mean_x;
+    double dz = src->mean_z - dst->mean_z;
+    double w  = na * nb / n;
+
+    dst->mean_x += dx * nb / n;
+    dst->mean_z += dz * nb / n;
+    dst->m2_x   += src->m2_x + dx * dx * w;
+    dst->m2_z   += src->m2_z + dz * dz * w;
+    dst->c_xz   += src->c_xz + dx * dz * w;
+    dst->n      += src->n;
+}
+
+/*
+ * Optimal coefficient c = Cov(X,Z) / Var(Z)
+ *
+ * Returns 0 when the control has no variance.
+ */
+static inline double mco_cv_beta(const mco_cv_stats *stats)
+{
+    if (stats->n == 0) return 0.0;
+
+    /* Var(Z) below 1e-12 means the control carries no information */
+    if (stats->m2_z < 1e-12 * (double)stats->n) return 0.0;
+
+    return stats->c_xz / stats->m2_z;
 }
 
 /*
@@ -109,26 +176,9 @@ static inline double mco_cv_estimate(const mco_cv_stats *stats)
 {
     if (stats->n == 0) return 0.0;
 
-    double n = (double)stats->n;
-    double mean_x = stats->sum_x / n;
-    double mean_z = stats->sum_z / n;
-
-    /* Var(Z) = E[Z²] - E[Z]² */
-    double var_z = (stats->sum_zz / n) - (mean_z * mean_z);
-
-    if (var_z < 1e-12) {
-        /* Control has no variance - just return mean_x */
-        return mean_x;
-    }
-
-    /* Cov(X,Z) = E[XZ] - E[X]E[Z] */
-    double cov_xz = (stats->sum_xz / n) - (mean_x * mean_z);
-
-    /* Optimal coefficient */
-    double c = cov_xz / var_z;
+    double c = mco_cv_beta(stats);
 
-    /* Adjusted estimate */
-    return mean_x - c * (mean_z - stats->ez);
+    return stats->mean_x - c * (stats->mean_z - stats->ez);
 }
 
 /*
@@ -142,20 +192,238 @@ static inline double mco_cv_variance_reduction(const mco_cv_stats *stats)
     if (stats->n < 2) return 1.0;
 
     double n = (double)stats->n;
-    double mean_x = stats->sum_x / n;
-    double mean_z = stats->sum_z / n;
-
-    double var_x = (stats->sum_xx / n) - (mean_x * mean_x);
-    double var_z = (stats->sum_zz / n) - (mean_z * mean_z);
+    double var_x = stats->m2_x / n;
+    double var_z = stats->m2_z / n;
 
     if (var_x < 1e-12 || var_z < 1e-12) return 1.0;
 
-    double cov_xz = (stats->sum_xz / n) - (mean_x * mean_z);
+    double cov_xz = stats->c_xz / n;
     double rho_sq = (cov_xz * cov_xz) / (var_x * var_z);
 
     return 1.0 - rho_sq;
 }
 
+/*============================================================================
+ * Multiple Control Variates
+ *============================================================================*/
+
+/*
+ * Several controls at once:
+ *
+ *   Y = X - βᵀ(Z - E[Z])
+ *
+ * with the optimal β = Σ_ZZ⁻¹ · Σ_ZX, i.e. the regression of X on Z.
+ * The accumulator keeps running means and the full co-moment matrix
+ * (multivariate Welford) so β is solved once at the end, and per-thread
+ * partials merge exactly.
+ */
+#define MCO_MCV_MAX 4
+
+typedef struct {
+    double mean_x;                          /* Running mean of X */
+    double m2_x;                            /* Σ(x - mean_x)² */
+    double mean_z[MCO_MCV_MAX];             /* Running means of controls */
+    double c_zz[MCO_MCV_MAX][MCO_MCV_MAX];  /* Σ(zᵢ - mean_zᵢ)(zⱼ - mean_zⱼ) */
+    double c_xz[MCO_MCV_MAX];               /* Σ(x - mean_x)(zᵢ - mean_zᵢ) */
+    double ez[MCO_MCV_MAX];                 /* Known E[Zᵢ] */
+    size_t k;                               /* Number of controls */
+    uint64_t n;                             /* Sample count */
+} mco_mcv_stats;
+
+/*
+ * Initialize with k controls whose expectations are ez[0..k-1]
+ */
+static inline void mco_mcv_init(mco_mcv_stats *stats, const double *ez, size_t k)
+{
+    if (k > MCO_MCV_MAX) k = MCO_MCV_MAX;
+
+    stats->mean_x = 0.0;
+    stats->m2_x   = 0.0;
+    for (size_t i = 0; i < MCO_MCV_MAX; ++i) {
+        stats->mean_z[i] = 0.0;
+        stats->c_xz[i]   = 0.0;
+        stats->ez[i]     = (i < k) ? ez[i] : 0.0;
+        for (size_t j = 0; j < MCO_MCV_MAX; ++j) {
+            stats->c_zz[i][j] = 0.0;
+        }
+    }
+    stats->k = k;
+    stats->n = 0;
+}
+
+/*
+ * Add one sample: primary x and controls z[0..k-1]
+ */
+static inline void mco_mcv_add(mco_mcv_stats *stats, double x, const double *z)
+{
+    size_t k = stats->k;
+    double dz[MCO_MCV_MAX];
+    if (k > MCO_MCV_MAX) k = MCO_MCV_MAX;   /* Never (init clamps); bounds the loops */
+
+    stats->n++;
+    double n = (double)stats->n;
+
+    double dx = x - stats->mean_x;
+    stats->mean_x += dx / n;
+    double dx_new = x - stats->mean_x;
+    stats->m2_x += dx * dx_new;
+
+    for (size_t i = 0; i < k; ++i) {
+        dz[i] = z[i] - stats->mean_z[i];
+        stats->mean_z[i] += dz[i] / n;
+    }
+
+    /* Old deviation × new deviation, as in the univariate update */
+    for (size_t i = 0; i < k; ++i) {
+        stats->c_xz[i] += dz[i] * dx_new;
+        for (size_t j = 0; j < k; ++j) {
+            stats->c_zz[i][j] += dz[i] * (z[j] - stats->mean_z[j]);
+        }
+    }
+}
+
+/*
+ * Merge src into dst (parallel reduction)
+ *
+ * Both accumulators must have been initialized with the same controls.
+ */
+static inline void mco_mcv_merge(mco_mcv_stats *dst, const mco_mcv_stats *src)
+{
+    if (src->n == 0) return;
+    if (dst->n == 0) {
+        *dst = *src;
+        return;
+    }
+
+    size_t k = dst->k;
+    double na = (double)dst->n;
+    double nb = (double)src->n;
+    double n  = na + nb;
+    double w  = na * nb / n;
+
+    double dx = src->mean_x - dst->mean_x;
+    double dz[MCO_MCV_MAX];
+    for (size_t i = 0; i < k; ++i) {
+        dz[i] = src->mean_z[i] - dst->mean_z[i];
+    }
+
+    dst->mean_x += dx * nb / n;
+    dst->m2_x   += src->m2_x + dx * dx * w;
+
+    for (size_t i = 0; i < k; ++i) {
+        dst->mean_z[i] += dz[i] * nb / n;
+        dst->c_xz[i]   += src->c_xz[i] + dx * dz[i] * w;
+        for (size_t j = 0; j < k; ++j) {
+            dst->c_zz[i][j] += src->c_zz[i][j] + dz[i] * dz[j] * w;
+        }
+    }
+
+    dst->n += src->n;
+}
+
+/*
+ * Solve Σ_ZZ·β = Σ_ZX for the optimal coefficients.
+ *
+ * Controls that carry no information beyond the ones before them
+ * (zero variance, or collinear with earlier controls) get β = 0
+ * rather than making the system singular.
+ */
+void mco_mcv_beta(const mco_mcv_stats *stats, double *beta);
+
+/*
+ * Control-adjusted estimate: mean(X) - βᵀ(mean(Z) - E[Z])
+ */
+double mco_mcv_estimate(const mco_mcv_stats *stats);
+
+/*
+ * Standard error of the control-adjusted estimate, from the regression
+ * residual variance: (SSₓ - βᵀ·C_xz) / (n - 1 - k), divided by n.
+ */
+double mco_mcv_std_error(const mco_mcv_stats *stats);
+
+/*============================================================================
+ * Path Controls Registered on the Context
+ *============================================================================*/
+
+/*
+ * Controls a path pricer evaluates alongside its payoff.
+ *
+ * Built from the context's mco_control mask, filtered to the controls the
+ * pricer supports. All controls are on the same simulated path:
+ *   SPOT      - discounted S(T), mean S₀
+ *   GEOMETRIC - discounted geometric-average option over S(t₁..tₙ)
+ *   VANILLA   - discounted European payoff at the control strike
+ *   BARRIER   - continuous barrier hit indicator (or its conditional
+ *               probability given the path), mean P(hit)
+ */
+typedef struct {
+    uint32_t mask;              /* Active mco_control bits */
+    size_t k;                   /* Number of active controls */
+    double strike;              /* Strike for GEOMETRIC / VANILLA */
+    double discount;            /* e^(-rT) */
+    mco_option_type type;
+} mco_path_controls;
+
+/*
+ * Initialize path controls and the matching accumulator.
+ *
+ * barrier / is_up are only used when MCO_CONTROL_BARRIER is active.
+ * Returns the number of active controls (0 means run without controls).
+ */
+size_t mco_path_controls_init(mco_path_controls *pc,
+                              mco_mcv_stats *stats,
+                              uint32_t requested,
+                              uint32_t supported,
+                              double spot,
+                              double strike,
+                              double barrier,
+                              int is_up,
+                              double rate,
+                              double volatility,
+                              double time,
+                              size_t num_obs,
+                              mco_option_type type);
+
+/*
+ * Path statistics the active controls need (MCO_PATH_* bits), to be
+ * OR-ed into the pricer's own mco_path_state tracking.
+ */
+static inline uint32_t mco_path_controls_track(const mco_path_controls *pc)
+{
+    return (pc->mask & MCO_CONTROL_GEOMETRIC) ? MCO_PATH_LOG_SUM : 0u;
+}
+
+/*
+ * Evaluate the active controls on one completed path.
+ *
+ * st is the path's streaming state (tracking at least
+ * mco_path_controls_track(pc)), hit is the barrier indicator for this
+ * path, or its conditional probability given the path. Writes pc->k
+ * values to z.
+ */
+static inline void mco_path_controls_eval(const mco_path_controls *pc,
+                                          const mco_path_state *st,
+                                          double hit,
+                                          double *z)
+{
+    size_t idx = 0;
+    double terminal = mco_path_state_spot(st);
+
+    if (pc->mask & MCO_CONTROL_SPOT) {
+        z[idx++] = pc->discount * terminal;
+    }
+    if (pc->mask & MCO_CONTROL_GEOMETRIC) {
+        double geom = mco_path_state_geom_avg(st);
+        z[idx++] = pc->discount * mco_payoff(geom, pc->strike, pc->type);
+    }
+    if (pc->mask & MCO_CONTROL_VANILLA) {
+        z[idx++] = pc->discount * mco_payoff(terminal, pc->strike, pc->type);
+    }
+    if (pc->mask & MCO_CONTROL_BARRIER) {
+        z[idx++] = hit;
+    }
+}
+
 /*============================================================================
  * Convenience Functions
  *============================================================================*/
@@ -174,9 +442,12 @@ double mco_european_cv_spot(mco_ctx *ctx,
                             mco_option_type type);
 
 /*
- * Price arithmetic Asian with geometric Asian as control
+ * Price arithmetic Asian with a control built on the geometric average
  *
- * Geometric Asian has closed-form, highly correlated with arithmetic
+ * Z = e^(-rT)·(A - K)·1{G > K} for a call (mirrored for a put), whose
+ * mean is the exact part of Curran's approximation. Z differs from the
+ * payoff only on paths where G and A straddle the strike, leaving
+ * 50-150x less residual variance than the geometric option as control.
  */
 double mco_asian_cv_geometric(mco_ctx *ctx,
                               double spot,
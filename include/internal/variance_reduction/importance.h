@@ -0,0 +1,200 @@
+/*
+ * Importance Sampling by Mean Shift
+ *
+ * For a deep out-of-the-money payoff almost every path pays zero, so
+ * plain Monte Carlo spends its budget confirming that. Importance
+ * sampling draws the normals from a shifted distribution that puts the
+ * paths where the payoff lives, and corrects with a likelihood ratio.
+ *
+ * Mean shift:
+ *   Draw Z ~ N(θ, 1) instead of N(0, 1). The density ratio is
+ *
+ *     w(Z) = φ(Z) / φ(Z - θ) = exp(-θZ + θ²/2)
+ *
+ *   and E[f(Z)] = E_θ[f(Z)·w(Z)], so weighting every payoff by w keeps
+ *   the estimator unbiased. For a path of n steps each shifted by μ the
+ *   weights multiply: w = exp(-μ·ΣZᵢ + n·μ²/2).
+ *
+ * Choosing θ (terminal payoffs):
+ *   For a payoff of the form e^{cZ}·1{Z > a} (cash digital c = 0, asset
+ *   digital c = σ√T) the second moment under the shifted measure is
+ *
+ *     M(θ) = exp(θ²/2 + (2c - θ)²/2) · Φ̄(a - 2c + θ)
+ *
+ *   which is log-convex in θ. We minimise it directly; for large a the
+ *   optimum approaches the large-deviation point θ ≈ a.
+ *
+ * Path payoffs (knock-in barriers):
+ *   No single drift works - a down-and-in call must fall to the barrier
+ *   and then rise past the strike. The most likely such paths are the
+ *   large-deviation routes: straight lines (in summed normals) touching
+ *   the barrier at time τ and then heading for the strike. Paths are
+ *   drawn from an equal mixture of routes for several τ plus the
+ *   unshifted measure, and weighted against the whole mixture:
+ *
+ *     w = φ(Z) / Σₖ αₖ qₖ(Z)
+ *
+ *   A path near any route gets a moderate weight, and the unshifted
+ *   (defensive) component caps every weight at 1/α₀.
+ *
+ * Standard error:
+ *   The sample standard deviation of the weighted, discounted payoffs
+ *   divided by √N, with the variance accumulated by Welford's update:
+ *   deep out-of-the-money payoffs are tiny weighted values, and
+ *   Σx² - n·mean² would cancel most of their digits. Stratified and
+ *   Latin hypercube draws use their own estimators (mco_is_error).
+ *   Reported through mco_get_std_error().
+ *
+ * Reference:
+ *   Glasserman, P. (2003). Monte Carlo Methods in Financial Engineering,
+ *   Section 4.6 (Importance Sampling)
+ */
+
+#ifndef MCO_INTERNAL_VARIANCE_REDUCTION_IMPORTANCE_H
+#define MCO_INTERNAL_VARIANCE_REDUCTION_IMPORTANCE_H
+
+#include "internal/sum.h"
+#include <math.h>
+#include <stdint.h>
+
+/* Large-deviation routes (barrier touch times) in the path mixture */
+#define MCO_IS_ROUTES 8
+
+/*
+ * Likelihood ratio for a single normal drawn from N(θ, 1).
+ */
+static inline double mco_is_weight(double theta, double z)
+{
+    return exp(-theta * z + 0.5 * theta * theta);
+}
+
+/*
+ * Optimal shift for payoffs e^{cZ}·1{Z > a}.
+ *
+ * For the mirrored indicator 1{Z < a} use -mco_is_optimal_shift(-a, -c).
+ */
+double mco_is_optimal_shift(double a, double c);
+
+/*
+ * How the draws behind the statistics were sampled, which decides the
+ * standard error. The sample variance of stratified or Latin hypercube
+ * payoffs is not an error estimate for their mean
+ * (internal/variance_reduction/stratified.h):
+ *   STRATA - one draw per stratum, added in stratum order. Collapsed
+ *            strata: neighbours are paired as one stratum of two draws,
+ *            Var(mean) ≈ Σₖ (x₂ₖ - x₂ₖ₊₁)² / n². Slightly conservative
+ *            (the pair's mean difference counts as noise).
+ *   BLOCKS - independent blocks of `block` draws (LHS hypercubes). Batch
+ *            means over the complete blocks, Var(mean) ≈ s²·block / n
+ *            with s² the sample variance of the block means; with fewer
+ *            than two complete blocks the i.i.d. estimate is used, which
+ *            for LHS is an upper bound.
+ */
+typedef enum {
+    MCO_IS_ERROR_IID = 0,
+    MCO_IS_ERROR_STRATA,
+    MCO_IS_ERROR_BLOCKS
+} mco_is_error;
+
+/*
+ * Running statistics for the weighted estimator and its standard error:
+ * the pairwise sum for the mean, Welford's mean and M2 for the variance.
+ */
+typedef struct {
+    mco_sum sum;
+    double mean;                /* Running mean (Welford) */
+    double m2;                  /* Σ (x - mean)² */
+    uint64_t n;
+
+    /* Stratified samplers */
+    mco_is_error error;
+    uint64_t block;             /* BLOCKS: draws per block */
+    double pending;             /* STRATA: first of the pair; BLOCKS: block sum */
+    mco_sum pair_sq;            /* STRATA: Σ (x₂ₖ - x₂ₖ₊₁)² */
+    double block_mean;          /* BLOCKS: Welford over complete block means */
+    double block_m2;
+    uint64_t blocks;
+} mco_is_stats;
+
+/*
+ * Statistics for draws sampled as `error` says; block is read for
+ * MCO_IS_ERROR_BLOCKS only.
+ */
+static inline void mco_is_init_as(mco_is_stats *stats, mco_is_error error, uint64_t block)
+{
+    mco_sum_init(&stats->sum);
+    stats->mean = 0.0;
+    stats->m2 = 0.0;
+    stats->n = 0;
+
+    stats->error = (error == MCO_IS_ERROR_BLOCKS && block == 0) ? MCO_IS_ERROR_IID : error;
+    stats->block = block;
+    stats->pending = 0.0;
+    mco_sum_init(&stats->pair_sq);
+    stats->block_mean = 0.0;
+    stats->block_m2 = 0.0;
+    stats->blocks = 0;
+}
+
+static inline void mco_is_init(mco_is_stats *stats)
+{
+    mco_is_init_as(stats, MCO_IS_ERROR_IID, 0);
+}
+
+static inline void mco_is_add(mco_is_stats *stats, double x)
+{
+    mco_sum_add(&stats->sum, x);
+    stats->n++;
+
+    /* Old deviation × new deviation keeps the update exact */
+    double dx = x - stats->mean;
+    stats->mean += dx / (double)stats->n;
+    stats->m2 += dx * (x - stats->mean);
+
+    if (stats->error == MCO_IS_ERROR_STRATA) {
+        if (stats->n & 1u) {
+            stats->pending = x;
+        } else {
+            double d = stats->pending - x;
+            mco_sum_add(&stats->pair_sq, d * d);
+        }
+    } else if (stats->error == MCO_IS_ERROR_BLOCKS) {
+        stats->pending += x;
+        if (stats->n % stats->block == 0) {
+            double m = stats->pending / (double)stats->block;
+            stats->blocks++;
+            double dm = m - stats->block_mean;
+            stats->block_mean += dm / (double)stats->blocks;
+            stats->block_m2 += dm * (m - stats->block_mean);
+            stats->pending = 0.0;
+        }
+    }
+}
+
+static inline double mco_is_mean(const mco_is_stats *stats)
+{
+    return stats->n > 0 ? mco_sum_value(&stats->sum) / (double)stats->n : 0.0;
+}
+
+static inline double mco_is_std_error(const mco_is_stats *stats)
+{
+    if (stats->n < 2) return 0.0;
+
+    double n = (double)stats->n;
+    double var_mean;
+
+    if (stats->error == MCO_IS_ERROR_STRATA) {
+        /* The odd stratum out counts at the average per-stratum variance */
+        double pairs = (double)(stats->n / 2);
+        var_mean = mco_sum_value(&stats->pair_sq) * (n / (2.0 * pairs)) / (n * n);
+    } else if (stats->error == MCO_IS_ERROR_BLOCKS && stats->blocks >= 2) {
+        double s2 = stats->block_m2 / ((double)stats->blocks - 1.0);
+        var_mean = s2 * (double)stats->block / n;
+    } else {
+        var_mean = stats->m2 / (n - 1.0) / n;
+    }
+
+    return var_mean > 0.0 ? sqrt(var_mean) : 0.0;
+}
+
+#endif /* MCO_INTERNAL_VARIANCE_REDUCTION_IMPORTANCE_H */
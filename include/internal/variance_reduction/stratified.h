@@ -0,0 +1,214 @@
+/*
+ * Stratified Sampling and Latin Hypercube Sampling
+ *
+ * Stratified sampling (terminal normal):
+ *   Split [0,1) into N equal strata and draw exactly one uniform from
+ *   each, then map through the inverse normal CDF:
+ *
+ *     Uᵢ = (i + Vᵢ) / N,   Vᵢ ~ U[0,1)
+ *     Zᵢ = Φ⁻¹(Uᵢ)
+ *
+ *   The stratum is the global path index, so a thread that owns paths
+ *   [start, end) owns exactly strata [start, end) - the partition across
+ *   threads is the same as the partition of the simulation range.
+ *
+ *   Removes the between-strata variance. For a payoff that is monotone
+ *   in Z (European, digital) this is most of the variance.
+ *
+ * Latin hypercube sampling (path dimensions):
+ *   For a block of B paths with d normals each, every dimension is
+ *   stratified independently: dimension j uses a random permutation πⱼ
+ *   of the B strata, so path p draws from stratum πⱼ(p) in dimension j.
+ *
+ *   Each marginal is perfectly stratified while the joint distribution
+ *   stays random. Effective for payoffs dominated by additive effects
+ *   of the individual increments (Asian averages, terminal values).
+ *
+ *   Blocks are independent hypercubes; the last block shrinks to the
+ *   number of paths left so it is still a complete hypercube.
+ *
+ * Estimator:
+ *   Both are unbiased with the usual sample mean. The sample variance
+ *   of the payoffs is NOT a valid error estimate - use collapsed strata
+ *   for the terminal normal and batch means over the independent LHS
+ *   blocks (mco_is_error, internal/variance_reduction/importance.h).
+ *
+ * Reference:
+ *   Glasserman, P. (2003). Monte Carlo Methods in Financial Engineering,
+ *   Section 4.3 (Stratified Sampling) and 4.4 (Latin Hypercube)
+ */
+
+#ifndef MCO_INTERNAL_VARIANCE_REDUCTION_STRATIFIED_H
+#define MCO_INTERNAL_VARIANCE_REDUCTION_STRATIFIED_H
+
+#include "internal/rng.h"
+#include "internal/methods/sobol.h"
+#include "internal/models/gbm.h"
+#include "internal/models/gbm_schedule.h"
+#include "internal/instruments/path_state.h"
+#include "internal/methods/kernels.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Paths per Latin hypercube block */
+#define MCO_LHS_BLOCK 256
+
+/*============================================================================
+ * Stratified Terminal Normal
+ *============================================================================*/
+
+/*
+ * Draw a standard normal from stratum `stratum` of `num_strata`.
+ */
+static inline double mco_stratified_normal(mco_rng *rng,
+                                           uint64_t stratum,
+                                           uint64_t num_strata)
+{
+    double u = ((double)stratum + mco_rng_uniform(rng)) / (double)num_strata;
+
+    /* Keep strictly inside (0,1) for the inverse CDF */
+    if (u < 1e-16) u = 1e-16;
+    if (u > 1.0 - 1e-16) u = 1.0 - 1e-16;
+
+    return mco_sobol_inv_normal(u);
+}
+
+/*============================================================================
+ * Latin Hypercube Sampling
+ *============================================================================*/
+
+/*
+ * LHS generator state
+ *
+ * Holds one block of normals (rows × dims, row-major) and hands out
+ * one row per path.
+ */
+typedef struct {
+    size_t dims;        /* Normals per path */
+    size_t block;       /* Maximum paths per hypercube */
+    size_t rows;        /* Paths in the current block */
+    size_t next_row;    /* Next row to hand out */
+    uint32_t *perm;     /* Permutation scratch (block) */
+    double *normals;    /* Current block (block × dims) */
+    const mco_kernels *kernels;     /* Inverse CDF of a block */
+} mco_lhs;
+
+/*
+ * Allocate LHS state for `dims` normals per path; each block's
+ * uniforms go through kernels->inv_normal in one call.
+ *
+ * Returns 0 on success, -1 on allocation failure.
+ */
+int mco_lhs_init(mco_lhs *lhs, size_t dims, size_t block, const mco_kernels *kernels);
+
+/*
+ * Release LHS buffers.
+ */
+void mco_lhs_free(mco_lhs *lhs);
+
+/*
+ * Get the normals for the next path.
+ *
+ * `remaining` is the number of paths still to simulate (including this
+ * one); it sizes the final block so every block is a full hypercube.
+ * Returns a pointer to `dims` normals, valid until the next call.
+ */
+const double *mco_lhs_next(mco_lhs *lhs, mco_rng *rng, uint64_t remaining);
+
+/*
+ * Normals for the next path: an LHS row when `lhs` is non-NULL, NULL
+ * (draw straight from the RNG) otherwise. Read with mco_path_normal().
+ */
+static inline const double *mco_lhs_row(mco_lhs *lhs, mco_rng *rng, uint64_t remaining)
+{
+    return lhs ? mco_lhs_next(lhs, rng, remaining) : NULL;
+}
+
+/*
+ * Normal for step i of the current path.
+ */
+static inline double mco_path_normal(const double *row, mco_rng *rng, size_t i)
+{
+    return row ? row[i] : mco_rng_normal(rng);
+}
+
+/*
+ * Normals for the next path and the normal for step i, with the sampler
+ * given as a constant by a specialised kernel (internal/specialise.h):
+ * an LHS row when `stratified`, straight from the RNG otherwise.
+ */
+MCO_SPECIALISE const double *mco_lhs_row_as(mco_lhs *lhs, mco_rng *rng, uint64_t remaining,
+                                            int stratified)
+{
+    return stratified ? mco_lhs_next(lhs, rng, remaining) : NULL;
+}
+
+MCO_SPECIALISE double mco_path_normal_as(const double *row, mco_rng *rng, size_t i,
+                                         int stratified)
+{
+    return stratified ? row[i] : mco_rng_normal(rng);
+}
+
+/*
+ * Simulate the next GBM path into a streaming payoff state. Steps in
+ * log-spot; the path itself is never stored. With MCO_PATH_BRIDGE_MIN /
+ * _MAX in `track` the bridge extremum inside each step is sampled too;
+ * its uniforms come straight from rng, only the step normals are
+ * stratified.
+ */
+MCO_SPECIALISE void mco_lhs_stream_path_as(mco_lhs *lhs,
+                                           const mco_gbm_path *model,
+                                           mco_rng *rng,
+                                           uint64_t remaining,
+                                           mco_path_state *st,
+                                           int stratified,
+                                           uint32_t track)
+{
+    const double *row = mco_lhs_row_as(lhs, rng, remaining, stratified);
+    double x = model->log_spot;
+
+    for (size_t i = 0; i < model->num_steps; ++i) {
+        x = mco_gbm_log_step(model, x, mco_path_normal_as(row, rng, i, stratified));
+        if (track & (MCO_PATH_BRIDGE_MIN | MCO_PATH_BRIDGE_MAX)) {
+            mco_path_state_observe_bridge_as(st, x, model->variance_dt, rng, track);
+        } else {
+            mco_path_state_observe_as(st, x, track);
+        }
+    }
+}
+
+/*
+ * Same as mco_lhs_stream_path_as, stepping exactly between the dates of
+ * a schedule (one normal per date).
+ */
+MCO_SPECIALISE void mco_lhs_stream_schedule_as(mco_lhs *lhs,
+                                               const mco_gbm_schedule *sched,
+                                               mco_rng *rng,
+                                               uint64_t remaining,
+                                               mco_path_state *st,
+                                               int stratified,
+                                               uint32_t track)
+{
+    const double *row = mco_lhs_row_as(lhs, rng, remaining, stratified);
+    double x = sched->log_spot;
+
+    for (size_t i = 0; i < sched->num_dates; ++i) {
+        x = mco_gbm_schedule_log_step(sched, i, x, mco_path_normal_as(row, rng, i, stratified));
+        mco_path_state_observe_as(st, x, track);
+    }
+}
+
+/*
+ * mco_lhs_stream_path_as with the sampler and statistics read at run
+ * time: through LHS when `lhs` is non-NULL, st->track.
+ */
+static inline void mco_lhs_stream_path(mco_lhs *lhs,
+                                       const mco_gbm_path *model,
+                                       mco_rng *rng,
+                                       uint64_t remaining,
+                                       mco_path_state *st)
+{
+    mco_lhs_stream_path_as(lhs, model, rng, remaining, st, lhs != NULL, st->track);
+}
+
+#endif /* MCO_INTERNAL_VARIANCE_REDUCTION_STRATIFIED_H */
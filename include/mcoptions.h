@@ -88,10 +88,133 @@ MCO_API uint64_t mco_get_steps(const mco_ctx *ctx);
 MCO_API uint64_t mco_get_seed(const mco_ctx *ctx);
 MCO_API uint32_t mco_get_threads(const mco_ctx *ctx);
 
+/*
+ * Instruction-set level for the vectorised kernels (lattice sweeps, PDE
+ * block steps, float32 path lanes, Latin hypercube normals). The library
+ * is built for the architecture baseline; those kernels are also
+ * compiled per level and each context picks the highest one the host
+ * supports when created. MCO_CPU_LEVEL=generic, sse4.2, avx2 or avx512
+ * in the environment caps the default, e.g. for benchmarking;
+ * mco_set_cpu_level does the same per context, lowering a level the host
+ * cannot run to the one it can. The context-free analytic barrier
+ * batches use the default. Prices are bitwise identical at every level.
+ */
+typedef enum {
+    MCO_CPU_GENERIC = 0,    /* Architecture baseline (SSE2 on x86-64) */
+    MCO_CPU_SSE42   = 1,    /* SSE4.2, POPCNT */
+    MCO_CPU_AVX2    = 2,    /* AVX2, FMA */
+    MCO_CPU_AVX512  = 3     /* AVX-512 F/DQ/BW/VL */
+} mco_cpu_level;
+
+MCO_API void          mco_set_cpu_level(mco_ctx *ctx, mco_cpu_level level);
+MCO_API mco_cpu_level mco_get_cpu_level(const mco_ctx *ctx);
+MCO_API const char   *mco_cpu_level_string(mco_cpu_level level);
+
+/*
+ * Arithmetic precision of the Monte Carlo paths.
+ *
+ * MCO_PRECISION_FAST is a screening mode for the European, Asian,
+ * barrier, lookback and digital pricers: paths, normals and payoffs are
+ * float32 in vector lanes, and payoffs are summed in double with
+ * compensation. The float bias is of order 1e-6 of the price (up to
+ * 1000 steps), well inside the 1e-4 screening tolerance; the random
+ * stream differs from double mode, so prices agree within standard
+ * errors (reported by mco_get_std_error), not bitwise. Pricers with a
+ * variance-reduction setting enabled (antithetic, stratified, control
+ * variates, importance sampling, conditional MC, bridge extremum) keep
+ * running in double.
+ */
+typedef enum {
+    MCO_PRECISION_DOUBLE = 0,   /* Default */
+    MCO_PRECISION_FAST   = 1    /* float32 lanes, double accumulation */
+} mco_precision;
+
+MCO_API void          mco_set_precision(mco_ctx *ctx, mco_precision precision);
+MCO_API mco_precision mco_get_precision(const mco_ctx *ctx);
+
 /* Variance reduction (to be added incrementally) */
 MCO_API void mco_set_antithetic(mco_ctx *ctx, int enabled);
 MCO_API int  mco_get_antithetic(const mco_ctx *ctx);
 
+/*
+ * Stratified sampling: one draw per stratum of the terminal normal for
+ * European / digital / CV pricers, Latin hypercube sampling across the
+ * step normals for Asian / barrier / lookback. Takes precedence over
+ * antithetic sampling where both apply.
+ */
+MCO_API void mco_set_stratified(mco_ctx *ctx, int enabled);
+MCO_API int  mco_get_stratified(const mco_ctx *ctx);
+
+/*
+ * Conditional Monte Carlo: replace a sampled quantity by its conditional
+ * expectation given the rest of the path.
+ *   Heston Europeans - simulate only the variance path and price the
+ *                      spot in closed form given that path
+ *   Barriers         - weight each path by its Brownian-bridge survival
+ *                      probability instead of drawing a crossing per step
+ *                      (importance-sampled knock-ins are unaffected)
+ */
+MCO_API void mco_set_conditional_mc(mco_ctx *ctx, int enabled);
+MCO_API int  mco_get_conditional_mc(const mco_ctx *ctx);
+
+/*
+ * Importance sampling: shift the normals toward the payoff region and
+ * reweight each path by its likelihood ratio. Digital pricers use the
+ * optimal terminal shift; knock-in barriers sample from a mixture of
+ * large-deviation drift routes plus the unshifted measure. Other barrier
+ * types are unaffected.
+ */
+MCO_API void mco_set_importance_sampling(mco_ctx *ctx, int enabled);
+MCO_API int  mco_get_importance_sampling(const mco_ctx *ctx);
+
+/*
+ * Brownian-bridge extremum: lookbacks draw the exact minimum / maximum of
+ * the log-price bridge between consecutive steps (one extra uniform per
+ * step), pricing continuous monitoring on a coarse grid - 10-20 steps
+ * instead of thousands. Off by default: the extremum is then taken over
+ * the grid points only, i.e. discrete monitoring.
+ */
+MCO_API void mco_set_bridge_extremum(mco_ctx *ctx, int enabled);
+MCO_API int  mco_get_bridge_extremum(const mco_ctx *ctx);
+
+/*
+ * Standard error of the most recent digital, barrier, MLMC, LSM
+ * American / Bermudan or MCO_PRECISION_FAST estimate (including
+ * importance weights and control variates). Returns 0 for NULL.
+ *
+ * With stratification on, the digital reports a collapsed-strata
+ * estimate (neighbouring strata paired) and the barriers batch means
+ * over the independent Latin hypercube blocks of 256 paths; both are
+ * slightly conservative. Runs with fewer than two complete blocks, and
+ * barriers with control variates, report the i.i.d. error instead, an
+ * upper bound for Latin hypercube sampling.
+ */
+MCO_API double mco_get_std_error(const mco_ctx *ctx);
+
+/*
+ * Control variates applied by the path pricers (bitmask of mco_control).
+ * Each pricer uses the requested controls that apply to it and ignores
+ * the rest; coefficients are fitted jointly by regression.
+ *   European:        SPOT
+ *   American:        SPOT, VANILLA
+ *   Bermudan:        SPOT, VANILLA
+ *   Asian (fixed):   SPOT, GEOMETRIC, VANILLA
+ *   Lookback:        SPOT, GEOMETRIC, VANILLA
+ *   Barrier:         SPOT, GEOMETRIC, VANILLA, BARRIER
+ *   Discrete barrier: SPOT, VANILLA, BARRIER (here the option continuously
+ *                    monitored at the BGK-shifted barrier, closed form)
+ */
+typedef enum {
+    MCO_CONTROL_NONE      = 0,
+    MCO_CONTROL_SPOT      = 1 << 0,  /* Discounted terminal spot e^(-rT)·S(T), E = S₀ */
+    MCO_CONTROL_GEOMETRIC = 1 << 1,  /* Geometric-average option (closed form) */
+    MCO_CONTROL_VANILLA   = 1 << 2,  /* European at the same strike (Black-Scholes) */
+    MCO_CONTROL_BARRIER   = 1 << 3   /* Continuous barrier hit (discrete: shifted-barrier price) */
+} mco_control;
+
+MCO_API void     mco_set_control_variates(mco_ctx *ctx, uint32_t controls);
+MCO_API uint32_t mco_get_control_variates(const mco_ctx *ctx);
+
 /*============================================================================
  * Types
  *============================================================================*/
@@ -131,7 +254,7 @@ MCO_API double mco_european_put(mco_ctx *ctx,
                                  double time_to_maturity);
 
 /*============================================================================
- * American Options (Least Squares Monte Carlo)
+ * American Options
  *============================================================================*/
 
 MCO_API double mco_american_call(mco_ctx *ctx,
@@ -150,6 +273,176 @@ MCO_API double mco_american_put(mco_ctx *ctx,
                                  double time_to_maturity,
                                  size_t num_steps);
 
+/*
+ * Pricing engine for the American and Bermudan pricers.
+ *   LSM       - Least Squares Monte Carlo (default); num_steps are the
+ *               exercise dates
+ *   BINOMIAL  - Leisen-Reimer binomial tree
+ *   TRINOMIAL - Trinomial tree; a strike strip shares one tree
+ *   PDE       - Crank-Nicolson finite differences (see "Finite-Difference
+ *               Pricing"); a strike strip is solved as one batch
+ * The lattices are deterministic. They exercise at every tree level
+ * (American, num_steps unused) or at the level nearest each exercise
+ * date (Bermudan). lattice_steps is the tree depth (default 500,
+ * rounded up to odd for the binomial; 0 or above MCO_LATTICE_MAX_STEPS
+ * is ignored). Richardson extrapolation combines the N- and N/2-level
+ * prices, removing the leading 1/N error.
+ */
+typedef enum {
+    MCO_ENGINE_LSM       = 0,
+    MCO_ENGINE_BINOMIAL  = 1,
+    MCO_ENGINE_TRINOMIAL = 2,
+    MCO_ENGINE_PDE       = 3
+} mco_american_engine;
+
+#define MCO_LATTICE_MAX_STEPS 100000
+
+MCO_API void     mco_set_american_engine(mco_ctx *ctx, mco_american_engine engine);
+MCO_API mco_american_engine mco_get_american_engine(const mco_ctx *ctx);
+MCO_API void     mco_set_lattice_steps(mco_ctx *ctx, uint32_t steps);
+MCO_API uint32_t mco_get_lattice_steps(const mco_ctx *ctx);
+MCO_API void     mco_set_lattice_richardson(mco_ctx *ctx, int enabled);
+MCO_API int      mco_get_lattice_richardson(const mco_ctx *ctx);
+
+/*
+ * American strike strip: prices num_strikes options on one underlying
+ * into out[i] for strikes[i], with the engine selected above. Under LSM
+ * the strikes share one set of paths and one backward pass (with an
+ * exercise cache, each strike is repriced from its own policy instead).
+ */
+MCO_API void mco_american_strip(mco_ctx *ctx,
+                                double spot,
+                                const double *strikes,
+                                size_t num_strikes,
+                                double rate,
+                                double volatility,
+                                double time_to_maturity,
+                                size_t num_steps,
+                                mco_option_type type,
+                                double *out);
+
+/*
+ * LSM regression basis (American and Bermudan pricers).
+ *
+ * Continuation values are regressed on degree+1 functions of moneyness:
+ *   LAGUERRE   - Lₖ(S/K), k = 0..degree (Longstaff-Schwartz; default, degree 2)
+ *   POLYNOMIAL - uᵏ, u = (S/K - 1)/(σ√T)
+ *   HERMITE    - Heₖ(u), probabilists' Hermite polynomials
+ * Degree is 1..MCO_LSM_MAX_DEGREE; out-of-range settings are ignored.
+ *
+ * The payoff regressor adds the exercise value as an extra column.
+ *
+ * The ridge λ is added to the diagonal of the scaled (unit-diagonal)
+ * normal matrix before the Cholesky solve; it keeps high-degree and
+ * collinear fits stable. Default 1e-10; negative values are ignored.
+ */
+typedef enum {
+    MCO_LSM_LAGUERRE   = 0,
+    MCO_LSM_POLYNOMIAL = 1,
+    MCO_LSM_HERMITE    = 2
+} mco_lsm_basis_type;
+
+#define MCO_LSM_MAX_DEGREE 8
+
+MCO_API void   mco_set_lsm_basis(mco_ctx *ctx, mco_lsm_basis_type basis, uint32_t degree);
+MCO_API mco_lsm_basis_type mco_get_lsm_basis(const mco_ctx *ctx);
+MCO_API uint32_t mco_get_lsm_degree(const mco_ctx *ctx);
+MCO_API void   mco_set_lsm_payoff_regressor(mco_ctx *ctx, int enabled);
+MCO_API int    mco_get_lsm_payoff_regressor(const mco_ctx *ctx);
+MCO_API void   mco_set_lsm_ridge(mco_ctx *ctx, double ridge);
+MCO_API double mco_get_lsm_ridge(const mco_ctx *ctx);
+
+/*
+ * Exercise policy cache (American and Bermudan pricers).
+ *
+ * LSM fits a per-date exercise rule by backward regression. With a cache
+ * attached, the fitted rule is stored under the contract's normalised
+ * terms - type, basis, exercise dates as fractions of T, and log(S/K),
+ * T, σ, r rounded to buckets of 0.01, 1 week, 0.005 and 0.0025 - and a
+ * later contract in the same buckets is repriced by one forward pass
+ * under the stored rule: no regression and no stored paths. The
+ * forward price is a low-biased (out-of-sample) LSM estimate, with the
+ * same SPOT / VANILLA control variates as a fit; its standard error is
+ * available from mco_get_std_error.
+ *
+ * A cache may be shared by several contexts, including across threads.
+ * The context only borrows it: free it after the last context using it.
+ * Returns NULL for capacity 0 or on allocation failure.
+ */
+typedef struct mco_exercise_cache mco_exercise_cache;
+
+MCO_API mco_exercise_cache *mco_exercise_cache_new(size_t capacity);
+MCO_API void     mco_exercise_cache_free(mco_exercise_cache *cache);
+MCO_API void     mco_exercise_cache_clear(mco_exercise_cache *cache);
+MCO_API size_t   mco_exercise_cache_size(mco_exercise_cache *cache);
+MCO_API uint64_t mco_exercise_cache_hits(mco_exercise_cache *cache);
+MCO_API uint64_t mco_exercise_cache_misses(mco_exercise_cache *cache);
+MCO_API void     mco_set_exercise_cache(mco_ctx *ctx, mco_exercise_cache *cache);
+
+/*
+ * Exercise boundary implied by the fitted (or cached) LSM rule.
+ *
+ * Writes num_steps exercise dates (years) to times and the critical
+ * spot at each to boundary: a put is exercised below it, a call above.
+ * Dates where the rule never exercises get 0 (put) or +INFINITY (call);
+ * the last date is maturity, with boundary = strike. num_steps = 0
+ * uses the American default. Returns the number of dates written, 0 on
+ * error.
+ */
+MCO_API size_t mco_american_exercise_boundary(mco_ctx *ctx,
+                                              double spot,
+                                              double strike,
+                                              double rate,
+                                              double volatility,
+                                              double time_to_maturity,
+                                              size_t num_steps,
+                                              mco_option_type type,
+                                              double *times,
+                                              double *boundary);
+
+/*
+ * Analytic approximations (no context, microseconds per price):
+ *   BAW - Barone-Adesi-Whaley quadratic approximation
+ *   BJS - Bjerksund-Stensland 2002, a lower bound on the true price
+ * Without dividends early exercise of a call is never optimal, so the
+ * call variants return the Black-Scholes price. Invalid inputs give 0.
+ */
+MCO_API double mco_american_baw_call(double spot, double strike, double rate,
+                                     double volatility, double time);
+
+MCO_API double mco_american_baw_put(double spot, double strike, double rate,
+                                    double volatility, double time);
+
+MCO_API double mco_american_bjs_call(double spot, double strike, double rate,
+                                     double volatility, double time);
+
+MCO_API double mco_american_bjs_put(double spot, double strike, double rate,
+                                    double volatility, double time);
+
+/*
+ * Batched approximations over n contracts in structure-of-arrays form.
+ * The exercise boundary is solved once per run of identical
+ * (rate, volatility, time) and shared, so a strike or spot ladder on
+ * one underlying costs one boundary solve.
+ */
+MCO_API void mco_american_baw_batch(const double *spot,
+                                    const double *strike,
+                                    const double *rate,
+                                    const double *volatility,
+                                    const double *time,
+                                    size_t n,
+                                    mco_option_type type,
+                                    double *out);
+
+MCO_API void mco_american_bjs_batch(const double *spot,
+                                    const double *strike,
+                                    const double *rate,
+                                    const double *volatility,
+                                    const double *time,
+                                    size_t n,
+                                    mco_option_type type,
+                                    double *out);
+
 /*============================================================================
  * Asian Options (Arithmetic Average)
  *============================================================================*/
@@ -186,6 +479,28 @@ MCO_API double mco_asian_geometric_put(mco_ctx *ctx,
                                         double time_to_maturity,
                                         size_t num_obs);
 
+/*
+ * Arithmetic Asian on an arbitrary observation schedule: obs_times are
+ * the averaging dates in years (non-decreasing, ≥ 0), sampled exactly
+ * with no intermediate steps; the payoff is paid at the last date.
+ * Returns 0 with MCO_ERR_INVALID_ARG for an invalid schedule.
+ */
+MCO_API double mco_asian_schedule_call(mco_ctx *ctx,
+                                        double spot,
+                                        double strike,
+                                        double rate,
+                                        double volatility,
+                                        const double *obs_times,
+                                        size_t num_obs);
+
+MCO_API double mco_asian_schedule_put(mco_ctx *ctx,
+                                       double spot,
+                                       double strike,
+                                       double rate,
+                                       double volatility,
+                                       const double *obs_times,
+                                       size_t num_obs);
+
 /* Closed-form geometric Asian (for validation) */
 MCO_API double mco_asian_geometric_closed(double spot,
                                            double strike,
@@ -195,6 +510,55 @@ MCO_API double mco_asian_geometric_closed(double spot,
                                            size_t num_obs,
                                            mco_option_type type);
 
+/*
+ * Analytic arithmetic Asian approximations (no context, fixed strike,
+ * averaging over the same tᵢ = i·T/n as mco_asian_call):
+ *   TURNBULL_WAKEMAN - lognormal with the exact first two moments of the
+ *                      discrete average (sub-microsecond for monthly fixings)
+ *   LEVY             - lognormal fit to the continuous average; num_obs is
+ *                      ignored, O(1) for daily-fixing books
+ *   CURRAN           - conditioned on the geometric average; the most
+ *                      accurate, n normal CDFs per price
+ * Invalid inputs give 0.
+ */
+typedef enum {
+    MCO_ASIAN_TURNBULL_WAKEMAN = 0,
+    MCO_ASIAN_LEVY             = 1,
+    MCO_ASIAN_CURRAN           = 2
+} mco_asian_approx;
+
+MCO_API double mco_asian_approx_call(mco_asian_approx method,
+                                      double spot,
+                                      double strike,
+                                      double rate,
+                                      double volatility,
+                                      double time_to_maturity,
+                                      size_t num_obs);
+
+MCO_API double mco_asian_approx_put(mco_asian_approx method,
+                                     double spot,
+                                     double strike,
+                                     double rate,
+                                     double volatility,
+                                     double time_to_maturity,
+                                     size_t num_obs);
+
+/*
+ * Batched approximation over n contracts in structure-of-arrays form,
+ * all with num_obs fixings. The moments of the average are computed
+ * once per run of identical (rate, volatility, time) and shared.
+ */
+MCO_API void mco_asian_approx_batch(mco_asian_approx method,
+                                    const double *spot,
+                                    const double *strike,
+                                    const double *rate,
+                                    const double *volatility,
+                                    const double *time,
+                                    size_t n,
+                                    size_t num_obs,
+                                    mco_option_type type,
+                                    double *out);
+
 /*============================================================================
  * Bermudan Options (Discrete Early Exercise)
  *============================================================================*/
@@ -215,6 +579,18 @@ MCO_API double mco_bermudan_put(mco_ctx *ctx,
                                  double time_to_maturity,
                                  size_t num_exercise);
 
+/* Exercise boundary at the num_exercise dates (see mco_american_exercise_boundary) */
+MCO_API size_t mco_bermudan_exercise_boundary(mco_ctx *ctx,
+                                              double spot,
+                                              double strike,
+                                              double rate,
+                                              double volatility,
+                                              double time_to_maturity,
+                                              size_t num_exercise,
+                                              mco_option_type type,
+                                              double *times,
+                                              double *boundary);
+
 /*============================================================================
  * SABR Model Functions
  *============================================================================*/
@@ -370,7 +746,28 @@ MCO_API double mco_barrier_put(mco_ctx *ctx, double spot, double strike,
                                 double vol, double time, size_t steps,
                                 mco_barrier_style type);
 
-/* Analytical barrier formulas (continuous monitoring) */
+/*
+ * Discretely monitored barrier: the barrier is only checked at
+ * monitor_times (years, non-decreasing, ≥ 0), with no Brownian bridge in
+ * between; the payoff is paid at the last date. GBM is sampled exactly
+ * at the dates. Returns 0 with MCO_ERR_INVALID_ARG for an invalid
+ * schedule.
+ */
+MCO_API double mco_barrier_discrete_call(mco_ctx *ctx, double spot, double strike,
+                                          double barrier, double rebate, double rate,
+                                          double vol, const double *monitor_times,
+                                          size_t num_dates, mco_barrier_style type);
+
+MCO_API double mco_barrier_discrete_put(mco_ctx *ctx, double spot, double strike,
+                                         double barrier, double rebate, double rate,
+                                         double vol, const double *monitor_times,
+                                         size_t num_dates, mco_barrier_style type);
+
+/*
+ * Analytical barrier formulas (continuous monitoring, Reiner-Rubinstein).
+ * Knock-outs pay the rebate at maturity; knock-ins ignore it. A spot at
+ * or beyond the barrier is already knocked.
+ */
 MCO_API double mco_barrier_down_out_call(double spot, double strike, double barrier,
                                           double rebate, double rate, double vol, double time);
 MCO_API double mco_barrier_down_in_call(double spot, double strike, double barrier,
@@ -379,6 +776,87 @@ MCO_API double mco_barrier_up_out_call(double spot, double strike, double barrie
                                         double rebate, double rate, double vol, double time);
 MCO_API double mco_barrier_up_in_call(double spot, double strike, double barrier,
                                        double rebate, double rate, double vol, double time);
+MCO_API double mco_barrier_down_out_put(double spot, double strike, double barrier,
+                                         double rebate, double rate, double vol, double time);
+MCO_API double mco_barrier_down_in_put(double spot, double strike, double barrier,
+                                        double rebate, double rate, double vol, double time);
+MCO_API double mco_barrier_up_out_put(double spot, double strike, double barrier,
+                                       double rebate, double rate, double vol, double time);
+MCO_API double mco_barrier_up_in_put(double spot, double strike, double barrier,
+                                      double rebate, double rate, double vol, double time);
+
+/*
+ * Analytic price for monitor_dates equally spaced dates with the
+ * Broadie-Glasserman-Kou correction (the continuous formula with the
+ * barrier shifted away from the spot by e^(0.5826·σ·√(T/m))), or
+ * continuous monitoring for monitor_dates = 0. Invalid inputs give 0.
+ *
+ * The correction is reliable for regular knock-outs and the knock-ins.
+ * For up-and-out calls and down-and-out puts - in the money at the
+ * barrier - it overprices once the barrier is near the strike: with
+ * 50 dates, K = 100 and σ = 0.2, about 6% at a barrier of 110 (call)
+ * and 3% at 90 (put), against under 2% at 130 / 70. Price those with
+ * mco_barrier_discrete_call / _put.
+ */
+MCO_API double mco_barrier_analytic_call(double spot, double strike, double barrier,
+                                          double rebate, double rate, double vol,
+                                          double time, size_t monitor_dates,
+                                          mco_barrier_style type);
+
+MCO_API double mco_barrier_analytic_put(double spot, double strike, double barrier,
+                                         double rebate, double rate, double vol,
+                                         double time, size_t monitor_dates,
+                                         mco_barrier_style type);
+
+/*
+ * Batched analytic price over n contracts in structure-of-arrays form,
+ * all with the same style, option type and monitor_dates. rebate may be
+ * NULL for none.
+ */
+MCO_API void mco_barrier_analytic_batch(const double *spot,
+                                        const double *strike,
+                                        const double *barrier,
+                                        const double *rebate,
+                                        const double *rate,
+                                        const double *volatility,
+                                        const double *time,
+                                        size_t n,
+                                        size_t monitor_dates,
+                                        mco_barrier_style barrier_type,
+                                        mco_option_type option_type,
+                                        double *out);
+
+/*
+ * All eight analytic prices of one contract, indexed by mco_barrier_style.
+ * For a given spot only one direction is alive: the other is knocked, in
+ * = vanilla and out = the rebate PV. parity is the largest
+ * |in + out - vanilla| over the live call and put pairs, each leg taken
+ * from its own row of the Reiner-Rubinstein table (rebate excluded): a
+ * round-off check, normally below 1e-12 of the spot.
+ */
+typedef struct {
+    double call[4];
+    double put[4];
+    double parity;
+} mco_barrier_values;
+
+/*
+ * Every in/out, up/down, call/put value for n contracts in one pass.
+ * The normal CDFs, power and logs are shared across the eight values,
+ * and the (rate, volatility, time) terms across runs of identical inputs,
+ * so a full set costs about one scalar price. rebate may be NULL;
+ * monitor_dates as for mco_barrier_analytic_call.
+ */
+MCO_API void mco_barrier_analytic_values(const double *spot,
+                                         const double *strike,
+                                         const double *barrier,
+                                         const double *rebate,
+                                         const double *rate,
+                                         const double *volatility,
+                                         const double *time,
+                                         size_t n,
+                                         size_t monitor_dates,
+                                         mco_barrier_values *out);
 
 /*============================================================================
  * Lookback Options
@@ -418,6 +896,92 @@ MCO_API double mco_digital_asset_call(double spot, double strike,
 MCO_API double mco_digital_asset_put(double spot, double strike,
                                       double rate, double vol, double time);
 
+/*============================================================================
+ * Finite-Difference Pricing (Crank-Nicolson)
+ *============================================================================*/
+
+/*
+ * Deterministic PDE engine for single-asset GBM contracts: Crank-Nicolson
+ * with Rannacher start-up on a spot grid concentrated around the strike
+ * and barrier, solved in batches. space_nodes is the number of spot
+ * nodes (default 400, MCO_PDE_MIN_NODES..MCO_PDE_MAX_NODES) and
+ * time_steps the number of time steps (default 200, 1..MCO_PDE_MAX_STEPS);
+ * out-of-range settings are ignored.
+ *
+ * The batch pricers take arrays of n contracts and return the price
+ * with grid delta, gamma and theta (∂V/∂t, per year). Elements with a
+ * non-positive spot, strike, volatility or time get a zero result and
+ * set MCO_ERR_INVALID_ARG; the rest are priced.
+ */
+#define MCO_PDE_MIN_NODES 16
+#define MCO_PDE_MAX_NODES 100000
+#define MCO_PDE_MAX_STEPS 100000
+
+MCO_API void     mco_set_pde_grid(mco_ctx *ctx, uint32_t space_nodes, uint32_t time_steps);
+MCO_API uint32_t mco_get_pde_space_nodes(const mco_ctx *ctx);
+MCO_API uint32_t mco_get_pde_time_steps(const mco_ctx *ctx);
+
+typedef struct {
+    double price;
+    double delta;
+    double gamma;
+    double theta;
+} mco_pde_result;
+
+MCO_API void mco_european_pde_batch(mco_ctx *ctx,
+                                    const double *spot,
+                                    const double *strike,
+                                    const double *rate,
+                                    const double *volatility,
+                                    const double *time,
+                                    size_t n,
+                                    mco_option_type type,
+                                    mco_pde_result *out);
+
+MCO_API void mco_american_pde_batch(mco_ctx *ctx,
+                                    const double *spot,
+                                    const double *strike,
+                                    const double *rate,
+                                    const double *volatility,
+                                    const double *time,
+                                    size_t n,
+                                    mco_option_type type,
+                                    mco_pde_result *out);
+
+/*
+ * Continuously monitored barrier; rebate may be NULL (no rebate). A
+ * knock-in is the Black-Scholes vanilla less the knock-out without
+ * rebate. Contracts already beyond the barrier are priced as knocked.
+ */
+MCO_API void mco_barrier_pde_batch(mco_ctx *ctx,
+                                   const double *spot,
+                                   const double *strike,
+                                   const double *barrier,
+                                   const double *rebate,
+                                   const double *rate,
+                                   const double *volatility,
+                                   const double *time,
+                                   size_t n,
+                                   mco_barrier_style style,
+                                   mco_option_type type,
+                                   mco_pde_result *out);
+
+/*
+ * Digital; payout is read only for cash-or-nothing and may be NULL
+ * otherwise.
+ */
+MCO_API void mco_digital_pde_batch(mco_ctx *ctx,
+                                   const double *spot,
+                                   const double *strike,
+                                   const double *payout,
+                                   const double *rate,
+                                   const double *volatility,
+                                   const double *time,
+                                   size_t n,
+                                   int cash_or_nothing,
+                                   mco_option_type type,
+                                   mco_pde_result *out);
+
 /*============================================================================
  * Control Variates (Variance Reduction)
  *============================================================================*/
@@ -454,6 +1018,88 @@ MCO_API double mco_asian_put_cv(mco_ctx *ctx,
                                  double time_to_maturity,
                                  size_t num_obs);
 
+/*
+ * Stochastic-vol / jump models with an analytic shadow path as control.
+ * Coefficients are estimated online and merged across threads.
+ *   Heston: GBM at the mean expected variance (Black-Scholes)
+ *   SABR:   lognormal forward at the Hagan implied vol (Black-76)
+ *   Merton: pure-diffusion part of the path (Black-Scholes)
+ */
+MCO_API double mco_heston_european_call_cv(mco_ctx *ctx, double spot, double strike,
+                                            double rate, double time, double v0,
+                                            double kappa, double theta,
+                                            double sigma, double rho);
+
+MCO_API double mco_heston_european_put_cv(mco_ctx *ctx, double spot, double strike,
+                                           double rate, double time, double v0,
+                                           double kappa, double theta,
+                                           double sigma, double rho);
+
+MCO_API double mco_sabr_european_call_cv(mco_ctx *ctx, double forward, double strike,
+                                          double rate, double time_to_maturity,
+                                          double alpha, double beta,
+                                          double rho, double nu);
+
+MCO_API double mco_sabr_european_put_cv(mco_ctx *ctx, double forward, double strike,
+                                         double rate, double time_to_maturity,
+                                         double alpha, double beta,
+                                         double rho, double nu);
+
+MCO_API double mco_merton_european_call_cv(mco_ctx *ctx, double spot, double strike,
+                                            double rate, double time, double sigma,
+                                            double lambda, double mu_j, double sigma_j);
+
+MCO_API double mco_merton_european_put_cv(mco_ctx *ctx, double spot, double strike,
+                                           double rate, double time, double sigma,
+                                           double lambda, double mu_j, double sigma_j);
+
+/*============================================================================
+ * Multilevel Monte Carlo
+ *============================================================================*/
+
+/*
+ * Price to a target RMSE with multilevel Monte Carlo.
+ *
+ * Level l simulates 4·2ˡ steps; fine and coarse paths of a level share
+ * their Brownian increments, and paths per level are allocated from the
+ * estimated level variances and costs. Levels are added until the
+ * estimated discretisation bias is below target_rmse/√2, so the price
+ * converges to the continuously monitored contract:
+ *   Asian    - continuous arithmetic average (fixed strike)
+ *   Lookback - continuous extremum (exact bridge extremum on every level)
+ *   Barrier  - continuous barrier (Brownian-bridge survival)
+ *   Heston   - European under the exact Heston dynamics (Euler levels)
+ *
+ * Levels stop at 12 (8192 steps on the finest). A target_rmse whose bias
+ * test still fails there gets the 12-level price: its statistical error
+ * meets the target, but the discretisation bias may not, and the
+ * standard error does not include it.
+ *
+ * Uses ctx->num_threads; the standard error is available from
+ * mco_get_std_error(). Returns 0 with MCO_ERR_INVALID_ARG if
+ * target_rmse <= 0, spot, time or barrier <= 0, strike <= 0 (except a
+ * floating-strike lookback, which ignores it), or vol, v0 or sigma < 0.
+ */
+MCO_API double mco_mlmc_asian(mco_ctx *ctx, double spot, double strike,
+                               double rate, double vol, double time,
+                               mco_option_type type, double target_rmse);
+
+MCO_API double mco_mlmc_lookback(mco_ctx *ctx, double spot, double strike,
+                                  double rate, double vol, double time,
+                                  int floating_strike, mco_option_type type,
+                                  double target_rmse);
+
+MCO_API double mco_mlmc_barrier(mco_ctx *ctx, double spot, double strike,
+                                 double barrier, double rebate, double rate,
+                                 double vol, double time, mco_barrier_style barrier_type,
+                                 mco_option_type type, double target_rmse);
+
+MCO_API double mco_mlmc_heston_european(mco_ctx *ctx, double spot, double strike,
+                                         double rate, double time, double v0,
+                                         double kappa, double theta, double sigma,
+                                         double rho, mco_option_type type,
+                                         double target_rmse);
+
 /*============================================================================
  * Error Handling
  *============================================================================*/
@@ -468,6 +1114,94 @@ typedef enum {
 MCO_API mco_error   mco_ctx_last_error(const mco_ctx *ctx);
 MCO_API const char *mco_error_string(mco_error err);
 
+/*============================================================================
+ * Asynchronous Jobs
+ *============================================================================*/
+
+/*
+ * Pricings that run on the context's persistent worker pool instead of
+ * the calling thread, so one thread can keep many in flight.
+ *
+ * The pool starts on the first mco_submit with the context's thread
+ * count at that time and lives until mco_ctx_free, which runs every job
+ * still queued before it returns. Each job prices a snapshot of the
+ * context settings (and RNG state) taken at submission on one worker,
+ * so its result is the price the synchronous call would give at that
+ * point with one thread; later setter calls do not affect submitted
+ * jobs, and jobs leave the context's RNG, error and standard error
+ * untouched.
+ *
+ * The callback, if any, runs on the worker once the result is set:
+ * mco_job_poll already returns 1 and mco_job_wait returns at once. It
+ * may submit further jobs and may free its own job, but must not wait
+ * for other jobs or free the context.
+ */
+
+typedef struct mco_job mco_job;
+
+typedef void (*mco_job_callback)(mco_job *job, void *user_data);
+
+/*
+ * Contract of a job; fields a kind does not read are ignored.
+ *   EUROPEAN
+ *   AMERICAN, BERMUDAN          - num_steps: time steps / exercise dates
+ *   ASIAN, ASIAN_GEOMETRIC      - num_steps: averaging observations
+ *   BARRIER                     - num_steps, barrier, rebate, barrier_style
+ *   LOOKBACK                    - num_steps, floating_strike
+ *   DIGITAL                     - payout, cash_or_nothing
+ */
+typedef enum {
+    MCO_JOB_EUROPEAN = 0,
+    MCO_JOB_AMERICAN,
+    MCO_JOB_BERMUDAN,
+    MCO_JOB_ASIAN,
+    MCO_JOB_ASIAN_GEOMETRIC,
+    MCO_JOB_BARRIER,
+    MCO_JOB_LOOKBACK,
+    MCO_JOB_DIGITAL
+} mco_job_kind;
+
+typedef struct {
+    mco_job_kind kind;
+    mco_option_type type;
+    double spot;
+    double strike;
+    double rate;
+    double volatility;
+    double time_to_maturity;
+    size_t num_steps;
+
+    double barrier;
+    double rebate;
+    mco_barrier_style barrier_style;
+    int floating_strike;
+    double payout;
+    int cash_or_nothing;
+
+    mco_job_callback callback;      /* NULL = none */
+    void *user_data;
+} mco_job_desc;
+
+/*
+ * Queue a pricing. Returns NULL with the context error set for an
+ * unknown kind (MCO_ERR_INVALID_ARG), on allocation failure or if the
+ * pool cannot start.
+ */
+MCO_API mco_job *mco_submit(mco_ctx *ctx, const mco_job_desc *desc);
+
+/* 1 once the result is available, 0 while queued or running */
+MCO_API int mco_job_poll(mco_job *job);
+
+/* Block until the result is available; returns the price */
+MCO_API double mco_job_wait(mco_job *job);
+
+/* Error and standard error of the job (as mco_get_std_error); these wait too */
+MCO_API mco_error mco_job_error(mco_job *job);
+MCO_API double    mco_job_std_error(mco_job *job);
+
+/* Wait for the job (and its callback) to finish, then release it */
+MCO_API void mco_job_free(mco_job *job);
+
 #ifdef __cplusplus
 }
 #endif
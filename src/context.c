@@ -7,7 +7,10 @@
 
 #include "internal/context.h"
 #include "internal/allocator.h"
+#include "internal/cpu.h"
+#include "internal/methods/job_pool.h"
 #include "internal/rng.h"
+#include <math.h>
 #include <string.h>
 
 /*============================================================================
@@ -29,8 +32,29 @@ mco_ctx *mco_ctx_new(void)
 
     /* Variance reduction - all disabled by default */
     ctx->antithetic_enabled       = 0;
-    ctx->control_variates_enabled = 0;
+    ctx->control_variates         = MCO_CONTROL_NONE;
     ctx->stratified_enabled       = 0;
+    ctx->conditional_mc_enabled   = 0;
+    ctx->importance_sampling_enabled = 0;
+
+    /* Lookbacks monitor the grid points only by default */
+    ctx->bridge_extremum_enabled  = 0;
+
+    /* LSM - Longstaff-Schwartz quadratic Laguerre basis */
+    ctx->lsm_basis            = MCO_LSM_LAGUERRE;
+    ctx->lsm_degree           = MCO_DEFAULT_LSM_DEGREE;
+    ctx->lsm_payoff_regressor = 0;
+    ctx->lsm_ridge            = MCO_DEFAULT_LSM_RIDGE;
+    ctx->exercise_cache       = NULL;
+    ctx->american_engine      = MCO_ENGINE_LSM;
+    ctx->lattice_steps        = MCO_DEFAULT_LATTICE_STEPS;
+    ctx->lattice_richardson   = 0;
+    ctx->pde_space_nodes      = MCO_DEFAULT_PDE_NODES;
+    ctx->pde_time_steps       = MCO_DEFAULT_PDE_STEPS;
+
+    /* Best kernels for this host, or the MCO_CPU_LEVEL cap */
+    ctx->cpu_level = mco_cpu_default_level();
+    ctx->precision = MCO_PRECISION_DOUBLE;
 
     /* Model - GBM by default */
     ctx->model = 0;
@@ -47,12 +71,16 @@ mco_ctx *mco_ctx_new(void)
     /* No errors yet */
     ctx->last_error = MCO_OK;
 
+    /* Job workers start on the first mco_submit */
+    ctx->job_pool = NULL;
+
     return ctx;
 }
 
 void mco_ctx_free(mco_ctx *ctx)
 {
     if (ctx) {
+        mco_job_pool_free(ctx->job_pool);
         mco_free(ctx);
     }
 }
@@ -126,6 +154,207 @@ int mco_get_antithetic(const mco_ctx *ctx)
     return ctx ? ctx->antithetic_enabled : 0;
 }
 
+void mco_set_stratified(mco_ctx *ctx, int enabled)
+{
+    if (ctx) {
+        ctx->stratified_enabled = enabled ? 1 : 0;
+    }
+}
+
+int mco_get_stratified(const mco_ctx *ctx)
+{
+    return ctx ? ctx->stratified_enabled : 0;
+}
+
+void mco_set_importance_sampling(mco_ctx *ctx, int enabled)
+{
+    if (ctx) {
+        ctx->importance_sampling_enabled = enabled ? 1 : 0;
+    }
+}
+
+int mco_get_importance_sampling(const mco_ctx *ctx)
+{
+    return ctx ? ctx->importance_sampling_enabled : 0;
+}
+
+void mco_set_conditional_mc(mco_ctx *ctx, int enabled)
+{
+    if (ctx) {
+        ctx->conditional_mc_enabled = enabled ? 1 : 0;
+    }
+}
+
+int mco_get_conditional_mc(const mco_ctx *ctx)
+{
+    return ctx ? ctx->conditional_mc_enabled : 0;
+}
+
+void mco_set_bridge_extremum(mco_ctx *ctx, int enabled)
+{
+    if (ctx) {
+        ctx->bridge_extremum_enabled = enabled ? 1 : 0;
+    }
+}
+
+int mco_get_bridge_extremum(const mco_ctx *ctx)
+{
+    return ctx ? ctx->bridge_extremum_enabled : 0;
+}
+
+void mco_set_control_variates(mco_ctx *ctx, uint32_t controls)
+{
+    if (ctx) {
+        ctx->control_variates = controls;
+    }
+}
+
+uint32_t mco_get_control_variates(const mco_ctx *ctx)
+{
+    return ctx ? ctx->control_variates : 0;
+}
+
+/*============================================================================
+ * LSM Regression
+ *============================================================================*/
+
+void mco_set_lsm_basis(mco_ctx *ctx, mco_lsm_basis_type basis, uint32_t degree)
+{
+    if (!ctx || degree == 0 || degree > MCO_LSM_MAX_DEGREE) return;
+    if (basis != MCO_LSM_LAGUERRE && basis != MCO_LSM_POLYNOMIAL && basis != MCO_LSM_HERMITE) {
+        return;
+    }
+
+    ctx->lsm_basis = basis;
+    ctx->lsm_degree = degree;
+}
+
+mco_lsm_basis_type mco_get_lsm_basis(const mco_ctx *ctx)
+{
+    return ctx ? (mco_lsm_basis_type)ctx->lsm_basis : MCO_LSM_LAGUERRE;
+}
+
+uint32_t mco_get_lsm_degree(const mco_ctx *ctx)
+{
+    return ctx ? ctx->lsm_degree : 0;
+}
+
+void mco_set_lsm_payoff_regressor(mco_ctx *ctx, int enabled)
+{
+    if (ctx) {
+        ctx->lsm_payoff_regressor = enabled ? 1 : 0;
+    }
+}
+
+int mco_get_lsm_payoff_regressor(const mco_ctx *ctx)
+{
+    return ctx ? ctx->lsm_payoff_regressor : 0;
+}
+
+void mco_set_lsm_ridge(mco_ctx *ctx, double ridge)
+{
+    if (ctx && isfinite(ridge) && ridge >= 0.0) {
+        ctx->lsm_ridge = ridge;
+    }
+}
+
+double mco_get_lsm_ridge(const mco_ctx *ctx)
+{
+    return ctx ? ctx->lsm_ridge : 0.0;
+}
+
+void mco_set_american_engine(mco_ctx *ctx, mco_american_engine engine)
+{
+    if (!ctx) return;
+    if (engine != MCO_ENGINE_LSM && engine != MCO_ENGINE_BINOMIAL &&
+        engine != MCO_ENGINE_TRINOMIAL && engine != MCO_ENGINE_PDE) {
+        return;
+    }
+
+    ctx->american_engine = engine;
+}
+
+mco_american_engine mco_get_american_engine(const mco_ctx *ctx)
+{
+    return ctx ? (mco_american_engine)ctx->american_engine : MCO_ENGINE_LSM;
+}
+
+void mco_set_lattice_steps(mco_ctx *ctx, uint32_t steps)
+{
+    if (ctx && steps > 0 && steps <= MCO_LATTICE_MAX_STEPS) {
+        ctx->lattice_steps = steps;
+    }
+}
+
+uint32_t mco_get_lattice_steps(const mco_ctx *ctx)
+{
+    return ctx ? ctx->lattice_steps : 0;
+}
+
+void mco_set_lattice_richardson(mco_ctx *ctx, int enabled)
+{
+    if (ctx) {
+        ctx->lattice_richardson = enabled ? 1 : 0;
+    }
+}
+
+int mco_get_lattice_richardson(const mco_ctx *ctx)
+{
+    return ctx ? ctx->lattice_richardson : 0;
+}
+
+void mco_set_pde_grid(mco_ctx *ctx, uint32_t space_nodes, uint32_t time_steps)
+{
+    if (!ctx) return;
+    if (space_nodes < MCO_PDE_MIN_NODES || space_nodes > MCO_PDE_MAX_NODES) return;
+    if (time_steps < 1 || time_steps > MCO_PDE_MAX_STEPS) return;
+
+    ctx->pde_space_nodes = space_nodes;
+    ctx->pde_time_steps = time_steps;
+}
+
+uint32_t mco_get_pde_space_nodes(const mco_ctx *ctx)
+{
+    return ctx ? ctx->pde_space_nodes : 0;
+}
+
+uint32_t mco_get_pde_time_steps(const mco_ctx *ctx)
+{
+    return ctx ? ctx->pde_time_steps : 0;
+}
+
+void mco_set_cpu_level(mco_ctx *ctx, mco_cpu_level level)
+{
+    if (!ctx) return;
+    int requested = (int)level;
+    if (requested < MCO_CPU_GENERIC || requested > MCO_CPU_AVX512) return;
+
+    int host = (int)mco_cpu_host_level();
+    ctx->cpu_level = (requested < host) ? requested : host;
+}
+
+mco_cpu_level mco_get_cpu_level(const mco_ctx *ctx)
+{
+    return ctx ? (mco_cpu_level)ctx->cpu_level : MCO_CPU_GENERIC;
+}
+
+void mco_set_precision(mco_ctx *ctx, mco_precision precision)
+{
+    if (!ctx) return;
+    if (precision != MCO_PRECISION_DOUBLE && precision != MCO_PRECISION_FAST) return;
+    ctx->precision = (int)precision;
+}
+
+mco_precision mco_get_precision(const mco_ctx *ctx)
+{
+    return ctx ? (mco_precision)ctx->precision : MCO_PRECISION_DOUBLE;
+}
+
+double mco_get_std_error(const mco_ctx *ctx)
+{
+    return ctx ? ctx->last_std_error : 0.0;
+}
+
 /*============================================================================
  * Error Handling
  *============================================================================*/
@@ -0,0 +1,73 @@
+/*
+ * CPU feature detection
+ *
+ * The host level and the MCO_CPU_LEVEL cap are read once per process.
+ */
+
+#include "internal/cpu.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+static pthread_once_t cpu_once = PTHREAD_ONCE_INIT;
+static mco_cpu_level cpu_host = MCO_CPU_GENERIC;
+static mco_cpu_level cpu_default = MCO_CPU_GENERIC;
+
+static mco_cpu_level detect_host(void)
+{
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")
+        && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl")
+        && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return MCO_CPU_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return MCO_CPU_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+        return MCO_CPU_SSE42;
+    }
+#endif
+    return MCO_CPU_GENERIC;
+}
+
+static void cpu_detect(void)
+{
+    cpu_host = detect_host();
+    cpu_default = cpu_host;
+
+    /* Unknown names are ignored */
+    const char *env = getenv("MCO_CPU_LEVEL");
+    if (!env) return;
+
+    for (int level = MCO_CPU_GENERIC; level <= MCO_CPU_AVX512; ++level) {
+        if (strcmp(env, mco_cpu_level_string((mco_cpu_level)level)) == 0) {
+            if ((mco_cpu_level)level < cpu_host) cpu_default = (mco_cpu_level)level;
+            return;
+        }
+    }
+}
+
+mco_cpu_level mco_cpu_host_level(void)
+{
+    pthread_once(&cpu_once, cpu_detect);
+    return cpu_host;
+}
+
+mco_cpu_level mco_cpu_default_level(void)
+{
+    pthread_once(&cpu_once, cpu_detect);
+    return cpu_default;
+}
+
+const char *mco_cpu_level_string(mco_cpu_level level)
+{
+    switch (level) {
+        case MCO_CPU_GENERIC: return "generic";
+        case MCO_CPU_SSE42:   return "sse4.2";
+        case MCO_CPU_AVX2:    return "avx2";
+        case MCO_CPU_AVX512:  return "avx512";
+        default:              return "unknown";
+    }
+}
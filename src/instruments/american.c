@@ -4,6 +4,11 @@
 
 #include "internal/instruments/american.h"
 #include "internal/methods/lsm.h"
+#include "internal/methods/exercise_cache.h"
+#include "internal/methods/lattice.h"
+#include "internal/methods/pde.h"
+#include "internal/allocator.h"
+#include "internal/models/american_approx.h"
 #include "mcoptions.h"
 
 /*
@@ -33,6 +38,33 @@ double mco_price_american(mco_ctx *ctx,
         num_steps = MCO_DEFAULT_AMERICAN_STEPS;
     }
 
+    if (ctx->american_engine == MCO_ENGINE_PDE && volatility > 0.0 && time_to_maturity > 0.0) {
+        mco_pde_contract contract = { spot, strike, rate, volatility, time_to_maturity,
+                                      0.0, 0.0, 0.0, 0.0 };
+        mco_pde_spec spec;
+        mco_pde_spec_init(&spec, ctx, MCO_PDE_VANILLA, type);
+        spec.american = 1;
+
+        mco_pde_result result = { 0.0, 0.0, 0.0, 0.0 };
+        if (mco_pde_solve(&spec, &contract, 1, &result) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+        }
+        return result.price;
+    }
+
+    /* Lattice, which also covers the PDE engine without diffusion */
+    if (ctx->american_engine != MCO_ENGINE_LSM) {
+        mco_lattice_spec spec;
+        mco_lattice_spec_init(&spec, ctx);
+
+        double price = 0.0;
+        if (mco_lattice_price(&spec, spot, &strike, 1, rate, volatility,
+                              time_to_maturity, type, &price) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+        }
+        return price;
+    }
+
     return mco_lsm_american(ctx, spot, strike, rate, volatility,
                             time_to_maturity, num_steps, type);
 }
@@ -64,3 +96,226 @@ double mco_american_put(mco_ctx *ctx,
     return mco_price_american(ctx, spot, strike, rate, volatility,
                               time_to_maturity, num_steps, MCO_PUT);
 }
+
+void mco_american_strip(mco_ctx *ctx,
+                        double spot,
+                        const double *strikes,
+                        size_t num_strikes,
+                        double rate,
+                        double volatility,
+                        double time_to_maturity,
+                        size_t num_steps,
+                        mco_option_type type,
+                        double *out)
+{
+    if (!ctx || !strikes || !out) return;
+
+    for (size_t k = 0; k < num_strikes; ++k) {
+        out[k] = 0.0;
+    }
+
+    int valid = spot > 0.0 && volatility >= 0.0 && time_to_maturity >= 0.0;
+    for (size_t k = 0; k < num_strikes; ++k) {
+        valid = valid && strikes[k] > 0.0;
+    }
+    if (!valid) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return;
+    }
+
+    /* Cached policies reprice forward-only, one strike at a time */
+    if (ctx->american_engine == MCO_ENGINE_LSM && ctx->exercise_cache) {
+        for (size_t k = 0; k < num_strikes; ++k) {
+            out[k] = mco_price_american(ctx, spot, strikes[k], rate, volatility,
+                                        time_to_maturity, num_steps, type);
+        }
+        return;
+    }
+
+    /* Shared paths and basis, one backward pass for the strip */
+    if (ctx->american_engine == MCO_ENGINE_LSM) {
+        mco_lsm_american_strip(ctx, spot, strikes, num_strikes, rate, volatility,
+                               time_to_maturity,
+                               num_steps ? num_steps : MCO_DEFAULT_AMERICAN_STEPS,
+                               type, out);
+        return;
+    }
+
+    /* One batch for the whole strip */
+    if (ctx->american_engine == MCO_ENGINE_PDE && volatility > 0.0 && time_to_maturity > 0.0) {
+        mco_pde_contract *contracts = (mco_pde_contract *)mco_malloc(num_strikes * sizeof(*contracts));
+        mco_pde_result *results = (mco_pde_result *)mco_malloc(num_strikes * sizeof(*results));
+        if (!contracts || !results) {
+            mco_free(contracts);
+            mco_free(results);
+            ctx->last_error = MCO_ERR_NOMEM;
+            return;
+        }
+
+        for (size_t k = 0; k < num_strikes; ++k) {
+            contracts[k] = (mco_pde_contract){ spot, strikes[k], rate, volatility,
+                                               time_to_maturity, 0.0, 0.0, 0.0, 0.0 };
+        }
+
+        mco_pde_spec spec;
+        mco_pde_spec_init(&spec, ctx, MCO_PDE_VANILLA, type);
+        spec.american = 1;
+        if (mco_pde_solve(&spec, contracts, num_strikes, results) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+        } else {
+            for (size_t k = 0; k < num_strikes; ++k) out[k] = results[k].price;
+        }
+
+        mco_free(contracts);
+        mco_free(results);
+        return;
+    }
+
+    /* One lattice for the whole strip */
+    mco_lattice_spec spec;
+    mco_lattice_spec_init(&spec, ctx);
+    if (mco_lattice_price(&spec, spot, strikes, num_strikes, rate, volatility,
+                          time_to_maturity, type, out) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+    }
+}
+
+void mco_american_pde_batch(mco_ctx *ctx,
+                            const double *spot,
+                            const double *strike,
+                            const double *rate,
+                            const double *volatility,
+                            const double *time,
+                            size_t n,
+                            mco_option_type type,
+                            mco_pde_result *out)
+{
+    if (!ctx || !spot || !strike || !rate || !volatility || !time || !out) return;
+
+    mco_pde_contract *contracts = mco_pde_contracts_new(spot, strike, rate, volatility, time, n);
+    if (!contracts) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return;
+    }
+
+    mco_pde_spec spec;
+    mco_pde_spec_init(&spec, ctx, MCO_PDE_VANILLA, type);
+    spec.american = 1;
+    mco_pde_run(ctx, &spec, contracts, n, out);
+    mco_free(contracts);
+}
+
+size_t mco_american_exercise_boundary(mco_ctx *ctx,
+                                      double spot,
+                                      double strike,
+                                      double rate,
+                                      double volatility,
+                                      double time_to_maturity,
+                                      size_t num_steps,
+                                      mco_option_type type,
+                                      double *times,
+                                      double *boundary)
+{
+    if (!ctx || !times || !boundary) return 0;
+
+    if (spot <= 0.0 || strike <= 0.0 || volatility < 0.0 || time_to_maturity < 0.0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0;
+    }
+
+    if (num_steps == 0) {
+        num_steps = MCO_DEFAULT_AMERICAN_STEPS;
+    }
+
+    /* No policy comes back on any failure */
+    mco_exercise_policy policy;
+    mco_lsm_american_policy(ctx, spot, strike, rate, volatility,
+                            time_to_maturity, num_steps, type, &policy);
+
+    size_t written = 0;
+    if (policy.coeffs) {
+        for (size_t i = 0; i < num_steps; ++i) {
+            times[i] = time_to_maturity * (double)(i + 1) / (double)num_steps;
+        }
+        mco_exercise_policy_boundary(&policy, strike, type, boundary);
+        written = num_steps;
+    }
+
+    mco_exercise_policy_free(&policy);
+    return written;
+}
+
+/*============================================================================
+ * Analytic Approximations
+ *============================================================================*/
+
+/*
+ * Scalar entry points: no dividends, so the cost of carry is the rate.
+ */
+static double american_approx(mco_american_approx method,
+                              double spot, double strike, double rate,
+                              double volatility, double time,
+                              mco_option_type type)
+{
+    if (spot <= 0.0 || strike <= 0.0 || volatility < 0.0 || time < 0.0) {
+        return 0.0;
+    }
+
+    return (method == MCO_AMERICAN_BAW)
+         ? mco_baw_price(spot, strike, rate, rate, volatility, time, type)
+         : mco_bjs2002_price(spot, strike, rate, rate, volatility, time, type);
+}
+
+double mco_american_baw_call(double spot, double strike, double rate,
+                             double volatility, double time)
+{
+    return american_approx(MCO_AMERICAN_BAW, spot, strike, rate, volatility, time, MCO_CALL);
+}
+
+double mco_american_baw_put(double spot, double strike, double rate,
+                            double volatility, double time)
+{
+    return american_approx(MCO_AMERICAN_BAW, spot, strike, rate, volatility, time, MCO_PUT);
+}
+
+double mco_american_bjs_call(double spot, double strike, double rate,
+                             double volatility, double time)
+{
+    return american_approx(MCO_AMERICAN_BJS2002, spot, strike, rate, volatility, time, MCO_CALL);
+}
+
+double mco_american_bjs_put(double spot, double strike, double rate,
+                            double volatility, double time)
+{
+    return american_approx(MCO_AMERICAN_BJS2002, spot, strike, rate, volatility, time, MCO_PUT);
+}
+
+void mco_american_baw_batch(const double *spot,
+                            const double *strike,
+                            const double *rate,
+                            const double *volatility,
+                            const double *time,
+                            size_t n,
+                            mco_option_type type,
+                            double *out)
+{
+    if (!spot || !strike || !rate || !volatility || !time || !out) return;
+
+    mco_american_approx_batch(MCO_AMERICAN_BAW, spot, strike, rate, volatility,
+                              time, n, type, out);
+}
+
+void mco_american_bjs_batch(const double *spot,
+                            const double *strike,
+                            const double *rate,
+                            const double *volatility,
+                            const double *time,
+                            size_t n,
+                            mco_option_type type,
+                            double *out)
+{
+    if (!spot || !strike || !rate || !volatility || !time || !out) return;
+
+    mco_american_approx_batch(MCO_AMERICAN_BJS2002, spot, strike, rate, volatility,
+                              time, n, type, out);
+}
@@ -4,7 +4,13 @@
 
 #include "internal/instruments/asian.h"
 #include "internal/models/gbm.h"
-#include "internal/allocator.h"
+#include "internal/models/gbm_schedule.h"
+#include "internal/models/asian_approx.h"
+#include "internal/variance_reduction/stratified.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/methods/fast_mc.h"
+#include "internal/specialise.h"
+#include "internal/sum.h"
 #include "mcoptions.h"
 #include <math.h>
 
@@ -15,17 +21,18 @@
 /*
  * For geometric Asian, the average G = (∏ S(tᵢ))^(1/n) is lognormal.
  *
- * Under risk-neutral measure:
- *   E[G] = S₀ · exp(adj_rate · T)
- *   Var[log G] = adj_vol² · T
+ * With observations tᵢ = i·T/n, under the risk-neutral measure:
+ *   E[log G] = log S₀ + μ_G·T
+ *   Var[log G] = σ_G² · T
  *
  * Where:
- *   adj_rate = (r - σ²/2) · (n+1)/(2n) + σ²/2 · (n+1)(2n+1)/(6n²)
- *   adj_vol² = σ² · (n+1)(2n+1)/(6n²)
+ *   μ_G  = (r - σ²/2) · (n+1)/(2n)
+ *   σ_G² = σ² · (n+1)(2n+1)/(6n²)
  *
- * Simplified for large n:
- *   adj_rate ≈ (r - σ²/6) / 2
- *   adj_vol ≈ σ / √3
+ * So G has forward F_G = S₀·exp((μ_G + σ_G²/2)·T) and the option is
+ * Black-76 on F_G with volatility σ_G, discounted at r.
+ *
+ * Large-n limit: σ_G → σ/√3
  */
 double mco_asian_geometric_closed(double spot,
                                   double strike,
@@ -42,31 +49,33 @@ double mco_asian_geometric_closed(double spot,
     double n = (double)num_obs;
     double sigma_sq = volatility * volatility;
 
-    /* Adjusted parameters for geometric average */
-    double adj_rate = (rate - 0.5 * sigma_sq) * (n + 1.0) / (2.0 * n)
-                    + sigma_sq * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n * n);
-
+    /* Drift and variance of log G per unit time */
+    double mu_g = (rate - 0.5 * sigma_sq) * (n + 1.0) / (2.0 * n);
     double adj_vol_sq = sigma_sq * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n * n);
     double adj_vol = sqrt(adj_vol_sq);
 
-    /* Use Black-Scholes with adjusted parameters */
+    double df = exp(-rate * time_to_maturity);
+    double fwd = spot * exp((mu_g + 0.5 * adj_vol_sq) * time_to_maturity);
+
+    if (adj_vol <= 0.0) {
+        return df * mco_payoff(fwd, strike, option_type);
+    }
+
+    /* Black-76 on the geometric forward */
     double sqrt_t = sqrt(time_to_maturity);
-    double d1 = (log(spot / strike) + (adj_rate + 0.5 * adj_vol_sq) * time_to_maturity)
+    double d1 = (log(fwd / strike) + 0.5 * adj_vol_sq * time_to_maturity)
                 / (adj_vol * sqrt_t);
     double d2 = d1 - adj_vol * sqrt_t;
 
     /* Standard normal CDF using erfc from math.h */
-    double nd1 = 0.5 * erfc(-d1 * 0.7071067811865475);
-    double nd2 = 0.5 * erfc(-d2 * 0.7071067811865475);
-
-    double df = exp(-rate * time_to_maturity);
-
     if (option_type == MCO_CALL) {
-        return spot * exp((adj_rate - rate) * time_to_maturity) * nd1 - strike * df * nd2;
+        double nd1 = 0.5 * erfc(-d1 * 0.7071067811865475);
+        double nd2 = 0.5 * erfc(-d2 * 0.7071067811865475);
+        return df * (fwd * nd1 - strike * nd2);
     } else {
         double nmd1 = 0.5 * erfc(d1 * 0.7071067811865475);
         double nmd2 = 0.5 * erfc(d2 * 0.7071067811865475);
-        return strike * df * nmd2 - spot * exp((adj_rate - rate) * time_to_maturity) * nmd1;
+        return df * (strike * nmd2 - fwd * nmd1);
     }
 }
 
@@ -74,6 +83,159 @@ double mco_asian_geometric_closed(double spot,
  * Monte Carlo Asian Pricing
  *============================================================================*/
 
+/* Path loop variants (internal/specialise.h) */
+#define ASIAN_ARITHMETIC (1u << 0)
+#define ASIAN_FIXED      (1u << 1)      /* Fixed strike, else floating */
+#define ASIAN_CALL       (1u << 2)
+#define ASIAN_LHS        (1u << 3)      /* Latin hypercube normals */
+#define ASIAN_CONTROLS   (1u << 4)      /* Registered control variates */
+
+typedef struct {
+    const mco_gbm_schedule *sched;
+    mco_lhs *lhs;
+    mco_rng rng;
+    uint64_t n_paths;
+    double strike;
+    const mco_path_controls *controls;
+    mco_mcv_stats *cv_stats;
+} asian_run;
+
+/*
+ * Simulate every path; returns the undiscounted payoff sum and feeds
+ * the control statistics.
+ */
+MCO_SPECIALISE double asian_paths(const asian_run *run, unsigned variant)
+{
+    const mco_gbm_schedule *sched = run->sched;
+    int arithmetic = (variant & ASIAN_ARITHMETIC) != 0;
+    int call = (variant & ASIAN_CALL) != 0;
+    int stratified = (variant & ASIAN_LHS) != 0;
+
+    /* Running sums only - the path is never stored */
+    uint32_t track = arithmetic ? MCO_PATH_SUM : MCO_PATH_LOG_SUM;
+    if (variant & ASIAN_CONTROLS) track |= MCO_PATH_LOG_SUM;
+
+    mco_sum sum_payoff;
+    mco_sum_init(&sum_payoff);
+    mco_rng rng = run->rng;
+
+    for (uint64_t i = 0; i < run->n_paths; ++i) {
+        /* Simulate the observation dates, accumulating the average */
+        mco_path_state st;
+        mco_path_state_init(&st, sched->spot, track);
+        mco_lhs_stream_schedule_as(run->lhs, sched, &rng, run->n_paths - i, &st,
+                                   stratified, track);
+
+        double avg = arithmetic ? mco_path_state_arith_avg(&st)
+                                : mco_path_state_geom_avg(&st);
+
+        /* Compute payoff */
+        double payoff;
+
+        if (variant & ASIAN_FIXED) {
+            /* Fixed strike: payoff based on average vs strike */
+            payoff = call ? mco_payoff_call(avg, run->strike)
+                          : mco_payoff_put(avg, run->strike);
+        } else {
+            /* Floating strike: payoff based on terminal vs average */
+            double terminal = mco_path_state_spot(&st);
+            payoff = call ? fmax(terminal - avg, 0.0) : fmax(avg - terminal, 0.0);
+        }
+
+        mco_sum_add(&sum_payoff, payoff);
+
+        if (variant & ASIAN_CONTROLS) {
+            double z[MCO_MCV_MAX];
+            mco_path_controls_eval(run->controls, &st, 0.0, z);
+            mco_mcv_add(run->cv_stats, sched->discount * payoff, z);
+        }
+    }
+
+    return mco_sum_value(&sum_payoff);
+}
+
+#define ASIAN_KERNEL(v) \
+    static double asian_paths_##v(const asian_run *run) { return asian_paths(run, v); }
+MCO_VARIANTS_32(ASIAN_KERNEL)
+
+#define ASIAN_ENTRY(v) asian_paths_##v,
+static double (*const asian_kernels[32])(const asian_run *) = {
+    MCO_VARIANTS_32(ASIAN_ENTRY)
+};
+
+/*
+ * Core pricer on an observation schedule. The payoff is paid (and
+ * discounted from) the last observation date.
+ */
+static double price_asian_schedule(mco_ctx *ctx,
+                                   const mco_gbm_schedule *sched,
+                                   double strike,
+                                   double volatility,
+                                   mco_asian_type avg_type,
+                                   mco_asian_strike strike_type,
+                                   mco_option_type option_type)
+{
+    uint64_t n_paths = ctx->num_simulations;
+    size_t num_obs = sched->num_dates;
+    double spot = sched->spot;
+
+    /* Latin hypercube over the path normals when stratification is on */
+    mco_lhs lhs;
+    mco_lhs *plhs = NULL;
+    if (ctx->stratified_enabled) {
+        if (mco_lhs_init(&lhs, num_obs, MCO_LHS_BLOCK,
+                         mco_kernels_get((mco_cpu_level)ctx->cpu_level)) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+            return 0.0;
+        }
+        plhs = &lhs;
+    }
+
+    /*
+     * Registered control variates (geometric/vanilla need a fixed strike,
+     * and the geometric closed form needs evenly spaced dates)
+     */
+    uint32_t supported = MCO_CONTROL_SPOT;
+    if (strike_type == MCO_ASIAN_FIXED_STRIKE) {
+        supported |= MCO_CONTROL_VANILLA;
+        if (sched->uniform) supported |= MCO_CONTROL_GEOMETRIC;
+    }
+    mco_path_controls controls;
+    mco_mcv_stats cv_stats;
+    size_t num_controls = mco_path_controls_init(&controls, &cv_stats,
+                                                 ctx->control_variates, supported,
+                                                 spot, strike, 0.0, 0, sched->rate,
+                                                 volatility, sched->maturity, num_obs,
+                                                 option_type);
+
+    unsigned variant = 0;
+    if (avg_type == MCO_ASIAN_ARITHMETIC) variant |= ASIAN_ARITHMETIC;
+    if (strike_type == MCO_ASIAN_FIXED_STRIKE) variant |= ASIAN_FIXED;
+    if (option_type == MCO_CALL) variant |= ASIAN_CALL;
+    if (plhs) variant |= ASIAN_LHS;
+    if (num_controls > 0) variant |= ASIAN_CONTROLS;
+
+    asian_run run = {
+        .sched    = sched,
+        .lhs      = plhs,
+        .rng      = ctx->rng,
+        .n_paths  = n_paths,
+        .strike   = strike,
+        .controls = &controls,
+        .cv_stats = &cv_stats
+    };
+    double sum_payoff = asian_kernels[variant](&run);
+
+    if (plhs) mco_lhs_free(plhs);
+
+    if (num_controls > 0) {
+        return mco_mcv_estimate(&cv_stats);
+    }
+
+    double price = sched->discount * (sum_payoff / (double)n_paths);
+    return price;
+}
+
 double mco_price_asian(mco_ctx *ctx,
                        double spot,
                        double strike,
@@ -92,66 +254,65 @@ double mco_price_asian(mco_ctx *ctx,
         return 0.0;
     }
 
-    uint64_t n_paths = ctx->num_simulations;
+    /* Single-precision lanes (internal/methods/fast_mc.h) */
+    if (ctx->precision == MCO_PRECISION_FAST && !ctx->stratified_enabled
+        && ctx->control_variates == 0) {
+        mco_fast_spec spec;
+        mco_fast_spec_init(&spec, spot, rate, volatility, time_to_maturity, num_obs,
+                           (avg_type == MCO_ASIAN_ARITHMETIC) ? MCO_FAST_WALK_SUM
+                                                              : MCO_FAST_WALK_LOG_SUM);
+        int fixed = strike_type == MCO_ASIAN_FIXED_STRIKE;
+        spec.x = fixed ? MCO_FAST_AVERAGE : MCO_FAST_SPOT;
+        spec.y = fixed ? MCO_FAST_STRIKE : MCO_FAST_AVERAGE;
+        spec.phi = (option_type == MCO_CALL) ? 1.0 : -1.0;
+        spec.strike = strike;
+        return mco_fast_price(ctx, &spec, &ctx->last_std_error);
+    }
 
-    /* Allocate path storage */
-    double *path = (double *)mco_malloc((num_obs + 1) * sizeof(double));
-    if (!path) {
+    /* Evenly spaced observations tᵢ = i·T/n */
+    mco_gbm_schedule sched;
+    if (mco_gbm_schedule_init_uniform(&sched, spot, rate, volatility,
+                                      time_to_maturity, num_obs) != 0) {
         ctx->last_error = MCO_ERR_NOMEM;
         return 0.0;
     }
 
-    /* Initialize GBM path model */
-    mco_gbm_path model;
-    mco_gbm_path_init(&model, spot, rate, volatility, time_to_maturity, num_obs);
-
-    double sum_payoff = 0.0;
-    mco_rng rng = ctx->rng;
-
-    for (uint64_t i = 0; i < n_paths; ++i) {
-        /* Simulate path */
-        mco_gbm_simulate_path(&model, &rng, path);
-
-        /* Compute average (skip path[0] = initial spot for standard Asian) */
-        double avg;
-        if (avg_type == MCO_ASIAN_ARITHMETIC) {
-            /* Arithmetic average */
-            double sum = 0.0;
-            for (size_t j = 1; j <= num_obs; ++j) {
-                sum += path[j];
-            }
-            avg = sum / (double)num_obs;
-        } else {
-            /* Geometric average */
-            double log_sum = 0.0;
-            for (size_t j = 1; j <= num_obs; ++j) {
-                log_sum += log(path[j]);
-            }
-            avg = exp(log_sum / (double)num_obs);
-        }
+    double price = price_asian_schedule(ctx, &sched, strike, volatility,
+                                        avg_type, strike_type, option_type);
 
-        /* Compute payoff */
-        double payoff;
-        double terminal = path[num_obs];
+    mco_gbm_schedule_free(&sched);
+    return price;
+}
 
-        if (strike_type == MCO_ASIAN_FIXED_STRIKE) {
-            /* Fixed strike: payoff based on average vs strike */
-            payoff = mco_payoff(avg, strike, option_type);
-        } else {
-            /* Floating strike: payoff based on terminal vs average */
-            if (option_type == MCO_CALL) {
-                payoff = fmax(terminal - avg, 0.0);
-            } else {
-                payoff = fmax(avg - terminal, 0.0);
-            }
-        }
+double mco_price_asian_schedule(mco_ctx *ctx,
+                                double spot,
+                                double strike,
+                                double rate,
+                                double volatility,
+                                const double *obs_times,
+                                size_t num_obs,
+                                mco_asian_type avg_type,
+                                mco_asian_strike strike_type,
+                                mco_option_type option_type)
+{
+    if (!ctx) return 0.0;
+
+    if (spot <= 0.0 || strike <= 0.0 || volatility < 0.0
+        || !mco_gbm_schedule_valid(obs_times, num_obs)) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
 
-        sum_payoff += payoff;
+    mco_gbm_schedule sched;
+    if (mco_gbm_schedule_init(&sched, spot, rate, volatility, obs_times, num_obs) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
     }
 
-    mco_free(path);
+    double price = price_asian_schedule(ctx, &sched, strike, volatility,
+                                        avg_type, strike_type, option_type);
 
-    double price = model.discount * (sum_payoff / (double)n_paths);
+    mco_gbm_schedule_free(&sched);
     return price;
 }
 
@@ -206,3 +367,74 @@ double mco_asian_geometric_put(mco_ctx *ctx,
     return mco_price_asian(ctx, spot, strike, rate, volatility, time_to_maturity,
                            num_obs, MCO_ASIAN_GEOMETRIC, MCO_ASIAN_FIXED_STRIKE, MCO_PUT);
 }
+
+double mco_asian_schedule_call(mco_ctx *ctx,
+                               double spot,
+                               double strike,
+                               double rate,
+                               double volatility,
+                               const double *obs_times,
+                               size_t num_obs)
+{
+    return mco_price_asian_schedule(ctx, spot, strike, rate, volatility, obs_times,
+                                    num_obs, MCO_ASIAN_ARITHMETIC, MCO_ASIAN_FIXED_STRIKE,
+                                    MCO_CALL);
+}
+
+double mco_asian_schedule_put(mco_ctx *ctx,
+                              double spot,
+                              double strike,
+                              double rate,
+                              double volatility,
+                              const double *obs_times,
+                              size_t num_obs)
+{
+    return mco_price_asian_schedule(ctx, spot, strike, rate, volatility, obs_times,
+                                    num_obs, MCO_ASIAN_ARITHMETIC, MCO_ASIAN_FIXED_STRIKE,
+                                    MCO_PUT);
+}
+
+/*============================================================================
+ * Analytic Approximations
+ *============================================================================*/
+
+double mco_asian_approx_call(mco_asian_approx method,
+                             double spot,
+                             double strike,
+                             double rate,
+                             double volatility,
+                             double time_to_maturity,
+                             size_t num_obs)
+{
+    return mco_asian_approx_price(method, spot, strike, rate, volatility,
+                                  time_to_maturity, num_obs, MCO_CALL);
+}
+
+double mco_asian_approx_put(mco_asian_approx method,
+                            double spot,
+                            double strike,
+                            double rate,
+                            double volatility,
+                            double time_to_maturity,
+                            size_t num_obs)
+{
+    return mco_asian_approx_price(method, spot, strike, rate, volatility,
+                                  time_to_maturity, num_obs, MCO_PUT);
+}
+
+void mco_asian_approx_batch(mco_asian_approx method,
+                            const double *spot,
+                            const double *strike,
+                            const double *rate,
+                            const double *volatility,
+                            const double *time,
+                            size_t n,
+                            size_t num_obs,
+                            mco_option_type type,
+                            double *out)
+{
+    if (!spot || !strike || !rate || !volatility || !time || !out) return;
+
+    mco_asian_approx_price_batch(method, spot, strike, rate, volatility, time,
+                                 n, num_obs, type, out);
+}
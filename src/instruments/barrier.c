@@ -5,7 +5,16 @@
  */
 
 #include "internal/instruments/barrier.h"
+#include "internal/instruments/barrier_analytic.h"
 #include "internal/models/gbm.h"
+#include "internal/models/gbm_schedule.h"
+#include "internal/variance_reduction/stratified.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/variance_reduction/importance.h"
+#include "internal/methods/pde.h"
+#include "internal/methods/fast_mc.h"
+#include "internal/methods/kernels.h"
+#include "internal/cpu.h"
 #include "internal/allocator.h"
 #include "mcoptions.h"
 #include <math.h>
@@ -15,54 +24,297 @@
 #endif
 
 /*============================================================================
- * Brownian Bridge Barrier Probability
+ * Barrier Monitoring
  *============================================================================*/
 
 /*
- * Probability that a Brownian bridge hits a barrier.
+ * Check one step (in log-spot) against the barrier: discrete check at
+ * the endpoints plus a Brownian bridge draw for a crossing in between.
  *
- * Given S(t) and S(t+dt), probability that min/max crossed barrier H.
+ * The bridge probability depends only on the step endpoints, not on the
+ * drift, so it is equally valid for importance-sampled paths. A discrete
+ * hit consumes no uniform.
+ */
+MCO_SPECIALISE int step_hits_barrier(double x1, double x2, double log_barrier,
+                                     double inv_var, int is_up, mco_rng *rng)
+{
+    double p_hit = mco_barrier_bridge_hit_prob_log(x1, x2, log_barrier, inv_var, is_up);
+    return p_hit >= 1.0 || mco_rng_uniform(rng) < p_hit;
+}
+
+/*============================================================================
+ * Importance-Sampled Knock-In Pricing
+ *============================================================================*/
+
+/*
+ * Piecewise-constant drift shift of the step normals: mu1 for steps
+ * [0, switch_step), mu2 for the rest.
+ */
+typedef struct {
+    double mu1;
+    double mu2;
+    size_t switch_step;
+} is_route;
+
+/*
+ * Large-deviation routes for a knock-in.
  *
- * For down barrier (min < H):
- *   P = exp(-2 * log(S(t)/H) * log(S(t+dt)/H) / (σ²dt))
+ * Route k is the straight line (in summed step normals) that touches the
+ * barrier at step m_k = k·n/R and then, if that leaves the option out
+ * of the money, carries on to the strike by maturity. For a down-and-in
+ * call this is the "down, then back up" path no constant drift follows.
+ * Route 0 is the unshifted measure (the defensive component).
+ */
+static size_t knock_in_routes(const mco_gbm_path *model, double strike,
+                              double barrier, mco_option_type option_type,
+                              is_route *out)
+{
+    size_t n = model->num_steps;
+    double x0 = model->log_spot;
+    size_t count = 0;
+
+    out[count++] = (is_route){ 0.0, 0.0, n };
+
+    /* Sum of step normals needed to finish at the strike */
+    double c = (log(strike) - x0 - model->drift_dt * (double)n) / model->diffusion_dt;
+
+    for (int k = 1; k <= MCO_IS_ROUTES; ++k) {
+        size_t m = (size_t)ceil((double)k * (double)n / MCO_IS_ROUTES);
+        if (m < 1) m = 1;
+        if (m > n) m = n;
+
+        /* Sum of step normals needed to touch the barrier at step m */
+        double a = (log(barrier) - x0 - model->drift_dt * (double)m) / model->diffusion_dt;
+        double rest = c - a;
+        int need_more = (option_type == MCO_CALL) ? (rest > 0.0) : (rest < 0.0);
+        double mu2 = (need_more && m < n) ? rest / (double)(n - m) : 0.0;
+
+        out[count++] = (is_route){ a / (double)m, mu2, m };
+    }
+
+    return count;
+}
+
+/*
+ * Knock-in barrier by defensive mixture importance sampling.
+ *
+ * Each path picks a route uniformly and is simulated under that shift.
+ * The likelihood ratio is taken against the whole mixture,
  *
- * For up barrier (max > H):
- *   P = exp(-2 * log(H/S(t)) * log(H/S(t+dt)) / (σ²dt))
+ *   w = φ(Z) / Σₖ αₖ qₖ(Z),   log(qₖ/φ) = Σᵢ μₖ,ᵢZᵢ - ½ Σᵢ μₖ,ᵢ²
  *
- * Only applies when S(t) and S(t+dt) are on same side of barrier.
+ * so no single route can produce a huge weight, and the unshifted
+ * component bounds every weight by 1/α₀.
  */
-static inline double bridge_hit_prob(double s1, double s2, double h,
-                                      double vol, double dt, int is_up)
+static double price_knock_in_importance(mco_ctx *ctx,
+                                        const mco_gbm_path *model,
+                                        double strike,
+                                        double barrier,
+                                        double volatility,
+                                        int is_up,
+                                        mco_option_type option_type)
 {
-    if (is_up) {
-        /* Up barrier: check if max > H */
-        if (s1 >= h || s2 >= h) return 1.0;  /* Already hit */
-        if (s1 <= 0.0 || s2 <= 0.0) return 0.0;
-
-        double log1 = log(h / s1);
-        double log2 = log(h / s2);
-        if (log1 <= 0.0 || log2 <= 0.0) return 1.0;
-
-        double var = vol * vol * dt;
-        return exp(-2.0 * log1 * log2 / var);
-    } else {
-        /* Down barrier: check if min < H */
-        if (s1 <= h || s2 <= h) return 1.0;  /* Already hit */
-        if (s1 <= 0.0 || s2 <= 0.0) return 0.0;
-
-        double log1 = log(s1 / h);
-        double log2 = log(s2 / h);
-        if (log1 <= 0.0 || log2 <= 0.0) return 1.0;
-
-        double var = vol * vol * dt;
-        return exp(-2.0 * log1 * log2 / var);
+    uint64_t n_paths = ctx->num_simulations;
+    size_t n = model->num_steps;
+
+    /* Prefix sums of the step normals, to evaluate every route's ratio */
+    double *cum_z = (double *)mco_malloc((n + 1) * sizeof(double));
+    if (!cum_z) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
     }
+
+    double log_barrier = log(barrier);
+    double inv_var = 1.0 / (volatility * volatility * model->dt);
+
+    is_route routes[MCO_IS_ROUTES + 1];
+    size_t num_routes = knock_in_routes(model, strike, barrier, option_type, routes);
+    double log_alpha = -log((double)num_routes);
+
+    mco_is_stats stats;
+    mco_is_init(&stats);
+    mco_rng rng = ctx->rng;
+
+    for (uint64_t p = 0; p < n_paths; ++p) {
+        const is_route *route = &routes[p % num_routes];
+
+        /* Simulate under the chosen route in log-spot, monitoring as it goes */
+        double x = model->log_spot;
+        int hit = 0;
+        cum_z[0] = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            double z = mco_rng_normal(&rng)
+                     + ((i < route->switch_step) ? route->mu1 : route->mu2);
+            double next = mco_gbm_log_step(model, x, z);
+            cum_z[i + 1] = cum_z[i] + z;
+            if (!hit) {
+                hit = step_hits_barrier(x, next, log_barrier, inv_var, is_up, &rng);
+            }
+            x = next;
+        }
+
+        double payoff = mco_payoff(exp(x), strike, option_type);
+        if (payoff <= 0.0 || !hit) {
+            mco_is_add(&stats, 0.0);
+            continue;
+        }
+
+        /* log qₖ/φ = Σ μZ - ½ Σ μ²; mixture ratio via log-sum-exp */
+        double log_q[MCO_IS_ROUTES + 1];
+        double max_log_q = -HUGE_VAL;
+        for (size_t k = 0; k < num_routes; ++k) {
+            size_t m = routes[k].switch_step;
+            double s1 = cum_z[m];
+            double s2 = cum_z[n] - cum_z[m];
+            log_q[k] = log_alpha
+                     + routes[k].mu1 * s1 + routes[k].mu2 * s2
+                     - 0.5 * (routes[k].mu1 * routes[k].mu1 * (double)m
+                              + routes[k].mu2 * routes[k].mu2 * (double)(n - m));
+            if (log_q[k] > max_log_q) max_log_q = log_q[k];
+        }
+
+        double sum_q = 0.0;
+        for (size_t k = 0; k < num_routes; ++k) {
+            sum_q += exp(log_q[k] - max_log_q);
+        }
+
+        double weight = exp(-(max_log_q + log(sum_q)));
+        mco_is_add(&stats, model->discount * payoff * weight);
+    }
+
+    mco_free(cum_z);
+
+    ctx->last_std_error = mco_is_std_error(&stats);
+
+    return mco_is_mean(&stats);
 }
 
 /*============================================================================
  * Monte Carlo Barrier Pricing
  *============================================================================*/
 
+/* Path loop variants (internal/specialise.h) */
+#define BARRIER_KNOCK_IN    (1u << 0)
+#define BARRIER_UP          (1u << 1)
+#define BARRIER_CALL        (1u << 2)
+#define BARRIER_CONDITIONAL (1u << 3)   /* Survival weights, no uniforms */
+#define BARRIER_LHS         (1u << 4)   /* Latin hypercube normals */
+#define BARRIER_CONTROLS    (1u << 5)   /* Registered control variates */
+
+typedef struct {
+    const mco_gbm_path *model;
+    mco_lhs *lhs;
+    mco_rng rng;
+    uint64_t n_paths;
+    double strike;
+    double rebate;
+    double log_barrier;
+    double inv_var;             /* 1/(σ²Δt) */
+    const mco_path_controls *controls;
+    mco_mcv_stats *cv_stats;
+    mco_is_stats *stats;
+} barrier_run;
+
+/*
+ * Simulate every path into the discounted payoff statistics (and the
+ * control statistics).
+ */
+MCO_SPECIALISE void barrier_paths(const barrier_run *run, unsigned variant)
+{
+    const mco_gbm_path *model = run->model;
+    size_t num_steps = model->num_steps;
+    int knock_in = (variant & BARRIER_KNOCK_IN) != 0;
+    int is_up = (variant & BARRIER_UP) != 0;
+    int conditional = (variant & BARRIER_CONDITIONAL) != 0;
+    int stratified = (variant & BARRIER_LHS) != 0;
+    uint32_t track = (variant & BARRIER_CONTROLS) ? MCO_PATH_LOG_SUM : 0u;
+
+    /*
+     * A knock-out is decided the moment it is hit (the rebate does not
+     * depend on the rest of the path), so stop stepping there. Controls
+     * need the whole path, so they turn this off.
+     */
+    int early_exit = !knock_in && !(variant & BARRIER_CONTROLS);
+
+    mco_rng rng = run->rng;
+
+    for (uint64_t i = 0; i < run->n_paths; ++i) {
+        /* Simulate path in log-spot, monitoring the barrier as it goes */
+        const double *row = mco_lhs_row_as(run->lhs, &rng, run->n_paths - i, stratified);
+        mco_path_state st;
+        mco_path_state_init(&st, model->spot, track);
+
+        double x = model->log_spot;
+        double survival = 1.0;
+        size_t j = 0;
+        while (j < num_steps && !st.hit) {
+            double next = mco_gbm_log_step(model, x, mco_path_normal_as(row, &rng, j++, stratified));
+            mco_path_state_observe_as(&st, next, track);
+            if (conditional) {
+                survival *= 1.0 - mco_barrier_bridge_hit_prob_log(x, next, run->log_barrier,
+                                                                  run->inv_var, is_up);
+                st.hit = survival < MCO_BARRIER_SURVIVAL_EPS;
+            } else {
+                st.hit = step_hits_barrier(x, next, run->log_barrier, run->inv_var,
+                                           is_up, &rng);
+            }
+            x = next;
+        }
+        if (st.hit) survival = 0.0;
+
+        /* Once hit, only the payoff statistics are left to collect */
+        if (!early_exit) {
+            for (; j < num_steps; ++j) {
+                x = mco_gbm_log_step(model, x, mco_path_normal_as(row, &rng, j, stratified));
+                mco_path_state_observe_as(&st, x, track);
+            }
+        }
+
+        /*
+         * Compute payoff based on barrier type. survival is 1 or 0 for a
+         * sampled path and the bridge survival probability otherwise.
+         */
+        double payoff = 0.0;
+
+        if (knock_in) {
+            /* Knock-in: pay if barrier was hit */
+            if (survival < 1.0) {
+                double terminal = mco_path_state_spot(&st);
+                payoff = (1.0 - survival)
+                       * ((variant & BARRIER_CALL) ? mco_payoff_call(terminal, run->strike)
+                                                   : mco_payoff_put(terminal, run->strike));
+            }
+            /* else payoff = 0 (option never activated) */
+        } else {
+            /* Knock-out: pay if barrier was NOT hit, rebate (if any) if it was */
+            if (survival > 0.0) {
+                double terminal = mco_path_state_spot(&st);
+                payoff = survival
+                       * ((variant & BARRIER_CALL) ? mco_payoff_call(terminal, run->strike)
+                                                   : mco_payoff_put(terminal, run->strike));
+            }
+            payoff += (1.0 - survival) * run->rebate;
+        }
+
+        mco_is_add(run->stats, model->discount * payoff);
+
+        if (variant & BARRIER_CONTROLS) {
+            double z[MCO_MCV_MAX];
+            mco_path_controls_eval(run->controls, &st, 1.0 - survival, z);
+            mco_mcv_add(run->cv_stats, model->discount * payoff, z);
+        }
+    }
+}
+
+#define BARRIER_KERNEL(v) \
+    static void barrier_paths_##v(const barrier_run *run) { barrier_paths(run, v); }
+MCO_VARIANTS_64(BARRIER_KERNEL)
+
+#define BARRIER_ENTRY(v) barrier_paths_##v,
+static void (*const barrier_kernels[64])(const barrier_run *) = {
+    MCO_VARIANTS_64(BARRIER_ENTRY)
+};
+
 double mco_price_barrier(mco_ctx *ctx,
                          double spot,
                          double strike,
@@ -79,241 +331,494 @@ double mco_price_barrier(mco_ctx *ctx,
 
     uint64_t n_paths = ctx->num_simulations;
 
-    /* Allocate path storage */
-    double *path = (double *)mco_malloc((num_steps + 1) * sizeof(double));
-    if (!path) {
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
-    }
-
     /* Initialize GBM path model */
     mco_gbm_path model;
     mco_gbm_path_init(&model, spot, rate, volatility, time, num_steps);
 
-    double dt = time / (double)num_steps;
     int is_up = (barrier_type == MCO_BARRIER_UP_IN || barrier_type == MCO_BARRIER_UP_OUT);
     int is_knock_in = (barrier_type == MCO_BARRIER_DOWN_IN || barrier_type == MCO_BARRIER_UP_IN);
 
-    double sum_payoff = 0.0;
-    mco_rng rng = ctx->rng;
-
-    for (uint64_t i = 0; i < n_paths; ++i) {
-        /* Simulate path */
-        mco_gbm_simulate_path(&model, &rng, path);
-
-        /* Check barrier */
-        int barrier_hit = 0;
-
-        for (size_t j = 0; j < num_steps; ++j) {
-            double s1 = path[j];
-            double s2 = path[j + 1];
-
-            /* Discrete check */
-            if (is_up) {
-                if (s1 >= barrier || s2 >= barrier) {
-                    barrier_hit = 1;
-                    break;
-                }
-            } else {
-                if (s1 <= barrier || s2 <= barrier) {
-                    barrier_hit = 1;
-                    break;
-                }
-            }
-
-            /* Brownian bridge probability for continuous approximation */
-            double p_hit = bridge_hit_prob(s1, s2, barrier, volatility, dt, is_up);
-            if (mco_rng_uniform(&rng) < p_hit) {
-                barrier_hit = 1;
-                break;
-            }
-        }
+    /* Importance sampling replaces the plain estimator for knock-ins */
+    if (is_knock_in && ctx->importance_sampling_enabled && volatility > 0.0) {
+        return price_knock_in_importance(ctx, &model, strike, barrier,
+                                         volatility, is_up, option_type);
+    }
 
-        /* Compute payoff based on barrier type */
-        double payoff = 0.0;
-        double terminal = path[num_steps];
+    /* Single-precision lanes (internal/methods/fast_mc.h) */
+    if (ctx->precision == MCO_PRECISION_FAST && !ctx->stratified_enabled
+        && ctx->control_variates == 0 && !ctx->conditional_mc_enabled) {
+        mco_fast_spec spec;
+        mco_fast_spec_init(&spec, spot, rate, volatility, time, num_steps,
+                           is_up ? MCO_FAST_WALK_BARRIER_UP : MCO_FAST_WALK_BARRIER_DOWN);
+        spec.x = MCO_FAST_SPOT;
+        spec.y = MCO_FAST_STRIKE;
+        spec.phi = (option_type == MCO_CALL) ? 1.0 : -1.0;
+        spec.strike = strike;
+        spec.barrier = barrier;
+        spec.rebate = rebate;
+        spec.knock_in = is_knock_in;
+        return mco_fast_price(ctx, &spec, &ctx->last_std_error);
+    }
 
-        if (is_knock_in) {
-            /* Knock-in: pay if barrier was hit */
-            if (barrier_hit) {
-                payoff = mco_payoff(terminal, strike, option_type);
-            }
-            /* else payoff = 0 (option never activated) */
-        } else {
-            /* Knock-out: pay if barrier was NOT hit */
-            if (!barrier_hit) {
-                payoff = mco_payoff(terminal, strike, option_type);
-            } else {
-                /* Pay rebate (if any) */
-                payoff = rebate;
-            }
+    /* Latin hypercube over the path normals when stratification is on */
+    mco_lhs lhs;
+    mco_lhs *plhs = NULL;
+    if (ctx->stratified_enabled) {
+        if (mco_lhs_init(&lhs, num_steps, MCO_LHS_BLOCK,
+                         mco_kernels_get((mco_cpu_level)ctx->cpu_level)) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+            return 0.0;
         }
+        plhs = &lhs;
+    }
 
-        sum_payoff += payoff;
+    /* Registered control variates */
+    mco_path_controls controls;
+    mco_mcv_stats cv_stats;
+    size_t num_controls = mco_path_controls_init(&controls, &cv_stats,
+                                                 ctx->control_variates,
+                                                 MCO_CONTROL_SPOT | MCO_CONTROL_GEOMETRIC
+                                                 | MCO_CONTROL_VANILLA | MCO_CONTROL_BARRIER,
+                                                 spot, strike, barrier, is_up, rate,
+                                                 volatility, time, num_steps, option_type);
+
+    /*
+     * Conditional mode: instead of a Bernoulli draw per step, carry the
+     * survival probability w = Π(1 - pᵢ) given the sampled endpoints and
+     * pay E[payoff | path] - w·V + (1 - w)·R for a knock-out, (1 - w)·V
+     * for a knock-in. No uniforms are drawn. The path counts as hit once
+     * w drops below MCO_BARRIER_SURVIVAL_EPS.
+     */
+    unsigned variant = 0;
+    if (is_knock_in) variant |= BARRIER_KNOCK_IN;
+    if (is_up) variant |= BARRIER_UP;
+    if (option_type == MCO_CALL) variant |= BARRIER_CALL;
+    if (ctx->conditional_mc_enabled) variant |= BARRIER_CONDITIONAL;
+    if (plhs) variant |= BARRIER_LHS;
+    if (num_controls > 0) variant |= BARRIER_CONTROLS;
+
+    /* LHS blocks are independent hypercubes: batch means for the error */
+    mco_is_stats stats;
+    mco_is_init_as(&stats, plhs ? MCO_IS_ERROR_BLOCKS : MCO_IS_ERROR_IID, MCO_LHS_BLOCK);
+
+    barrier_run run = {
+        .model       = &model,
+        .lhs         = plhs,
+        .rng         = ctx->rng,
+        .n_paths     = n_paths,
+        .strike      = strike,
+        .rebate      = rebate,
+        .log_barrier = log(barrier),
+        .inv_var     = 1.0 / (volatility * volatility * model.dt),
+        .controls    = &controls,
+        .cv_stats    = &cv_stats,
+        .stats       = &stats
+    };
+    barrier_kernels[variant](&run);
+
+    if (plhs) mco_lhs_free(plhs);
+
+    if (num_controls > 0) {
+        ctx->last_std_error = mco_mcv_std_error(&cv_stats);
+        return mco_mcv_estimate(&cv_stats);
     }
 
-    mco_free(path);
+    ctx->last_std_error = mco_is_std_error(&stats);
 
-    return model.discount * (sum_payoff / (double)n_paths);
+    return mco_is_mean(&stats);
 }
 
 /*============================================================================
- * Analytical Barrier Formulas (Continuous Monitoring)
+ * Analytical Barrier Formulas
  *============================================================================*/
 
-static double norm_cdf(double x)
+static double rr_select(const mco_barrier_values *v, mco_barrier_style style,
+                        mco_option_type type)
 {
-    return 0.5 * erfc(-x * 0.7071067811865475);
+    return (type == MCO_CALL) ? v->call[style] : v->put[style];
 }
 
 /*
- * Helper functions for barrier formulas
+ * Continuously monitored price against exactly this barrier
  */
-static double barrier_A(double spot, double strike, double rate, double vol, double time, double phi)
+static double barrier_closed_form(double spot, double strike, double barrier, double rebate,
+                                  double rate, double vol, double time,
+                                  mco_barrier_style style, mco_option_type type)
 {
-    double sqrt_t = sqrt(time);
-    double d1 = (log(spot / strike) + (rate + 0.5 * vol * vol) * time) / (vol * sqrt_t);
-    double d2 = d1 - vol * sqrt_t;
-    return phi * spot * norm_cdf(phi * d1) - phi * strike * exp(-rate * time) * norm_cdf(phi * d2);
+    mco_rr_market m;
+    mco_barrier_values v;
+    mco_rr_market_init(&m, rate, vol, time, 0);
+    mco_rr_values(&m, spot, strike, barrier, rebate, &v);
+    return rr_select(&v, style, type);
 }
 
-static double barrier_B(double spot, double strike, double barrier, double rate, double vol, double time, double phi, double eta)
+double mco_barrier_analytic_price(double spot,
+                                  double strike,
+                                  double barrier,
+                                  double rebate,
+                                  double rate,
+                                  double volatility,
+                                  double time,
+                                  size_t monitor_dates,
+                                  mco_barrier_style barrier_type,
+                                  mco_option_type option_type)
 {
-    double sqrt_t = sqrt(time);
-    double mu = (rate - 0.5 * vol * vol) / (vol * vol);
-    double x1 = log(spot / barrier) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
-    double y1 = log(barrier / spot) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
+    if (!mco_barrier_analytic_valid(spot, strike, barrier, volatility, time)) return 0.0;
 
-    double pow_term = pow(barrier / spot, 2.0 * mu);
+    /* Knocked at inception: skip the other direction's terms */
+    int is_up = (barrier_type == MCO_BARRIER_UP_IN || barrier_type == MCO_BARRIER_UP_OUT);
+    if (volatility > 0.0 && time > 0.0 && (is_up ? spot >= barrier : spot <= barrier)) {
+        if (barrier_type == MCO_BARRIER_UP_OUT || barrier_type == MCO_BARRIER_DOWN_OUT) {
+            return rebate * exp(-rate * time);
+        }
+        return (option_type == MCO_CALL) ? mco_black_scholes_call(spot, strike, rate, volatility, time)
+                                         : mco_black_scholes_put(spot, strike, rate, volatility, time);
+    }
 
-    double term1 = phi * spot * norm_cdf(phi * x1);
-    double term2 = -phi * strike * exp(-rate * time) * norm_cdf(phi * x1 - phi * vol * sqrt_t);
-    double term3 = -phi * spot * pow_term * norm_cdf(eta * y1);
-    double term4 = phi * strike * exp(-rate * time) * pow_term * norm_cdf(eta * y1 - eta * vol * sqrt_t);
+    mco_rr_market m;
+    mco_barrier_values v;
+    mco_rr_market_init(&m, rate, volatility, time, monitor_dates);
+    mco_rr_values(&m, spot, strike, barrier, rebate, &v);
+    return rr_select(&v, barrier_type, option_type);
+}
+
+/*============================================================================
+ * Batch Evaluation
+ *============================================================================*/
 
-    return term1 + term2 + term3 + term4;
+void mco_barrier_analytic_values_batch(const double *spot,
+                                       const double *strike,
+                                       const double *barrier,
+                                       const double *rebate,
+                                       const double *rate,
+                                       const double *volatility,
+                                       const double *time,
+                                       size_t n,
+                                       size_t monitor_dates,
+                                       mco_barrier_values *out)
+{
+    const mco_kernels *kernels = mco_kernels_get(mco_cpu_default_level());
+    kernels->barrier_values(spot, strike, barrier, rebate, rate, volatility, time, n,
+                            monitor_dates, out);
 }
 
-/* Down-and-Out Call: S > H, K > H */
-double mco_barrier_down_out_call(double spot, double strike, double barrier,
-                                  double rebate, double rate, double vol, double time)
+void mco_barrier_analytic_price_batch(const double *spot,
+                                      const double *strike,
+                                      const double *barrier,
+                                      const double *rebate,
+                                      const double *rate,
+                                      const double *volatility,
+                                      const double *time,
+                                      size_t n,
+                                      size_t monitor_dates,
+                                      mco_barrier_style barrier_type,
+                                      mco_option_type option_type,
+                                      double *out)
 {
-    if (spot <= barrier) return rebate * exp(-rate * time);
-    if (strike <= barrier) {
-        /* In-the-money path, use simpler formula */
-        double vanilla = mco_black_scholes_call(spot, strike, rate, vol, time);
-        double in_price = mco_barrier_down_in_call(spot, strike, barrier, 0, rate, vol, time);
-        return vanilla - in_price + rebate * exp(-rate * time);
+    const mco_kernels *kernels = mco_kernels_get(mco_cpu_default_level());
+    mco_barrier_values v[64];
+
+    for (size_t done = 0; done < n; done += 64) {
+        size_t m = (n - done < 64) ? n - done : 64;
+        kernels->barrier_values(spot + done, strike + done, barrier + done,
+                                rebate ? rebate + done : NULL, rate + done,
+                                volatility + done, time + done, m, monitor_dates, v);
+        for (size_t i = 0; i < m; ++i) {
+            out[done + i] = rr_select(&v[i], barrier_type, option_type);
+        }
     }
+}
 
-    /* Standard case: K > H */
-    double sqrt_t = sqrt(time);
-    double mu = (rate - 0.5 * vol * vol) / (vol * vol);
-
-    double x1 = log(spot / strike) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
-    double y1 = log(barrier * barrier / (spot * strike)) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
-
-    double pow_term = pow(barrier / spot, 2.0 * mu);
-
-    double call = spot * norm_cdf(x1) - strike * exp(-rate * time) * norm_cdf(x1 - vol * sqrt_t);
-    double adjustment = spot * pow_term * norm_cdf(y1) - strike * exp(-rate * time) * pow_term * norm_cdf(y1 - vol * sqrt_t);
+/* Continuous monitoring, one function per combination */
 
-    return call - adjustment;
+double mco_barrier_down_out_call(double spot, double strike, double barrier,
+                                  double rebate, double rate, double vol, double time)
+{
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_DOWN_OUT, MCO_CALL);
 }
 
 double mco_barrier_down_in_call(double spot, double strike, double barrier,
                                  double rebate, double rate, double vol, double time)
 {
-    if (spot <= barrier) {
-        return mco_black_scholes_call(spot, strike, rate, vol, time);
-    }
-
-    double vanilla = mco_black_scholes_call(spot, strike, rate, vol, time);
-    double out = mco_barrier_down_out_call(spot, strike, barrier, 0, rate, vol, time);
-    return vanilla - out;
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_DOWN_IN, MCO_CALL);
 }
 
 double mco_barrier_up_out_call(double spot, double strike, double barrier,
                                 double rebate, double rate, double vol, double time)
 {
-    if (spot >= barrier) return rebate * exp(-rate * time);
-    if (barrier <= strike) return 0.0;  /* Never ITM before knockout */
-
-    double vanilla = mco_black_scholes_call(spot, strike, rate, vol, time);
-    double in_price = mco_barrier_up_in_call(spot, strike, barrier, 0, rate, vol, time);
-    return vanilla - in_price;
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_UP_OUT, MCO_CALL);
 }
 
 double mco_barrier_up_in_call(double spot, double strike, double barrier,
                                double rebate, double rate, double vol, double time)
 {
-    if (spot >= barrier) {
-        return mco_black_scholes_call(spot, strike, rate, vol, time);
-    }
-
-    double sqrt_t = sqrt(time);
-    double mu = (rate - 0.5 * vol * vol) / (vol * vol);
-    double pow_term = pow(barrier / spot, 2.0 * mu);
-
-    double y1 = log(barrier / spot) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
-
-    return spot * pow_term * norm_cdf(y1) - strike * exp(-rate * time) * pow_term * norm_cdf(y1 - vol * sqrt_t);
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_UP_IN, MCO_CALL);
 }
 
-/* Put versions using put-call parity-like relations */
 double mco_barrier_down_out_put(double spot, double strike, double barrier,
                                  double rebate, double rate, double vol, double time)
 {
-    if (spot <= barrier) return rebate * exp(-rate * time);
-
-    double vanilla = mco_black_scholes_put(spot, strike, rate, vol, time);
-    double in_price = mco_barrier_down_in_put(spot, strike, barrier, 0, rate, vol, time);
-    return vanilla - in_price;
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_DOWN_OUT, MCO_PUT);
 }
 
 double mco_barrier_down_in_put(double spot, double strike, double barrier,
                                 double rebate, double rate, double vol, double time)
 {
-    if (spot <= barrier) {
-        return mco_black_scholes_put(spot, strike, rate, vol, time);
-    }
-
-    double sqrt_t = sqrt(time);
-    double mu = (rate - 0.5 * vol * vol) / (vol * vol);
-    double pow_term = pow(barrier / spot, 2.0 * mu);
-
-    double y1 = log(barrier / spot) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
-
-    return -spot * pow_term * norm_cdf(-y1) + strike * exp(-rate * time) * pow_term * norm_cdf(-y1 + vol * sqrt_t);
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_DOWN_IN, MCO_PUT);
 }
 
 double mco_barrier_up_out_put(double spot, double strike, double barrier,
                                double rebate, double rate, double vol, double time)
 {
-    if (spot >= barrier) return rebate * exp(-rate * time);
-    if (barrier >= strike) {
-        /* Standard case */
-        double vanilla = mco_black_scholes_put(spot, strike, rate, vol, time);
-        double in_price = mco_barrier_up_in_put(spot, strike, barrier, 0, rate, vol, time);
-        return vanilla - in_price;
-    }
-    return 0.0;
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_UP_OUT, MCO_PUT);
 }
 
 double mco_barrier_up_in_put(double spot, double strike, double barrier,
                               double rebate, double rate, double vol, double time)
 {
-    if (spot >= barrier) {
-        return mco_black_scholes_put(spot, strike, rate, vol, time);
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time, 0,
+                                      MCO_BARRIER_UP_IN, MCO_PUT);
+}
+
+/*============================================================================
+ * Discretely Monitored Barrier Pricing
+ *============================================================================*/
+
+double mco_price_barrier_discrete(mco_ctx *ctx,
+                                  double spot,
+                                  double strike,
+                                  double barrier,
+                                  double rebate,
+                                  double rate,
+                                  double volatility,
+                                  const double *monitor_times,
+                                  size_t num_dates,
+                                  mco_barrier_style barrier_type,
+                                  mco_option_type option_type)
+{
+    if (!ctx) return 0.0;
+
+    if (spot <= 0.0 || barrier <= 0.0 || volatility < 0.0
+        || !mco_gbm_schedule_valid(monitor_times, num_dates)) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
     }
 
+    uint64_t n_paths = ctx->num_simulations;
+
+    mco_gbm_schedule sched;
+    if (mco_gbm_schedule_init(&sched, spot, rate, volatility, monitor_times, num_dates) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+
+    double log_barrier = log(barrier);
+    int is_up = (barrier_type == MCO_BARRIER_UP_IN || barrier_type == MCO_BARRIER_UP_OUT);
+    int is_knock_in = (barrier_type == MCO_BARRIER_DOWN_IN || barrier_type == MCO_BARRIER_UP_IN);
+
+    /* Latin hypercube over the date normals when stratification is on */
+    mco_lhs lhs;
+    mco_lhs *plhs = NULL;
+    if (ctx->stratified_enabled) {
+        if (mco_lhs_init(&lhs, num_dates, MCO_LHS_BLOCK,
+                         mco_kernels_get((mco_cpu_level)ctx->cpu_level)) != 0) {
+            mco_gbm_schedule_free(&sched);
+            ctx->last_error = MCO_ERR_NOMEM;
+            return 0.0;
+        }
+        plhs = &lhs;
+    }
+
+    /* The continuous-hit control does not apply to discrete monitoring */
+    mco_path_controls controls;
+    mco_mcv_stats cv_stats;
+    size_t num_controls = mco_path_controls_init(&controls, &cv_stats,
+                                                 ctx->control_variates,
+                                                 MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA,
+                                                 spot, strike, barrier, is_up, rate,
+                                                 volatility, sched.maturity, num_dates,
+                                                 option_type);
+
+    /* BARRIER: continuous monitoring of the BGK-shifted barrier, appended last */
+    int bgk_control = (ctx->control_variates & MCO_CONTROL_BARRIER)
+                      && volatility > 0.0 && sched.maturity > 0.0;
+    double log_shifted = 0.0;
+    if (bgk_control) {
+        double factor = mco_barrier_bgk_factor(volatility, sched.maturity / (double)num_dates);
+        double shifted = is_up ? barrier * factor : barrier / factor;
+        double ez[MCO_MCV_MAX];
+        for (size_t k = 0; k < num_controls; ++k) ez[k] = cv_stats.ez[k];
+        ez[num_controls++] = barrier_closed_form(spot, strike, shifted, rebate, rate,
+                                                 volatility, sched.maturity,
+                                                 barrier_type, option_type);
+        mco_mcv_init(&cv_stats, ez, num_controls);
+        log_shifted = log(shifted);
+    }
+
+    int early_exit = !is_knock_in && num_controls == 0;
+
+    mco_is_stats stats;
+    mco_is_init_as(&stats, plhs ? MCO_IS_ERROR_BLOCKS : MCO_IS_ERROR_IID, MCO_LHS_BLOCK);
+    mco_rng rng = ctx->rng;
+
+    for (uint64_t i = 0; i < n_paths; ++i) {
+        const double *row = mco_lhs_row(plhs, &rng, n_paths - i);
+        mco_path_state st;
+        mco_path_state_init(&st, spot, 0);
+
+        /* Step date to date in log-spot, checking the barrier at each */
+        double x = sched.log_spot;
+        double survive = 1.0;
+        for (size_t j = 0; j < num_dates; ++j) {
+            double prev = x;
+            x = mco_gbm_schedule_log_step(&sched, j, x, mco_path_normal(row, &rng, j));
+            mco_path_state_observe(&st, x);
+
+            if (bgk_control) {
+                double var = sched.diffusion[j] * sched.diffusion[j];
+                survive *= 1.0 - mco_barrier_bridge_hit_prob_log(prev, x, log_shifted,
+                                                                 1.0 / var, is_up);
+            }
+
+            if (!st.hit) {
+                st.hit = is_up ? (x >= log_barrier) : (x <= log_barrier);
+                if (st.hit && early_exit) break;
+            }
+        }
+
+        double payoff = 0.0;
+        if (is_knock_in) {
+            if (st.hit) payoff = mco_payoff(mco_path_state_spot(&st), strike, option_type);
+        } else {
+            payoff = st.hit ? rebate
+                            : mco_payoff(mco_path_state_spot(&st), strike, option_type);
+        }
+
+        mco_is_add(&stats, sched.discount * payoff);
+
+        if (num_controls > 0) {
+            double z[MCO_MCV_MAX];
+            mco_path_controls_eval(&controls, &st, 0.0, z);
+            if (bgk_control) {
+                double vanilla = mco_payoff(mco_path_state_spot(&st), strike, option_type);
+                z[controls.k] = sched.discount * (is_knock_in
+                    ? (1.0 - survive) * vanilla
+                    : survive * vanilla + (1.0 - survive) * rebate);
+            }
+            mco_mcv_add(&cv_stats, sched.discount * payoff, z);
+        }
+    }
+
+    mco_gbm_schedule_free(&sched);
+    if (plhs) mco_lhs_free(plhs);
+
+    if (num_controls > 0) {
+        ctx->last_std_error = mco_mcv_std_error(&cv_stats);
+        return mco_mcv_estimate(&cv_stats);
+    }
+
+    ctx->last_std_error = mco_is_std_error(&stats);
+
+    return mco_is_mean(&stats);
+}
+
+/*============================================================================
+ * Finite-Difference Barrier Pricing
+ *============================================================================*/
+
+/*
+ * Black-Scholes price and Greeks, for knock-in parity
+ */
+static mco_pde_result black_scholes_result(double spot, double strike, double rate,
+                                           double vol, double time, mco_option_type type)
+{
     double sqrt_t = sqrt(time);
-    double mu = (rate - 0.5 * vol * vol) / (vol * vol);
-    double pow_term = pow(barrier / spot, 2.0 * mu);
+    double d1 = (log(spot / strike) + (rate + 0.5 * vol * vol) * time) / (vol * sqrt_t);
+    double d2 = d1 - vol * sqrt_t;
+    double pdf = exp(-0.5 * d1 * d1) / sqrt(2.0 * M_PI);
+    double df = exp(-rate * time);
+    double phi = (type == MCO_CALL) ? 1.0 : -1.0;
+
+    mco_pde_result r;
+    r.price = phi * (spot * mco_barrier_norm_cdf(phi * d1) - strike * df * mco_barrier_norm_cdf(phi * d2));
+    r.delta = phi * mco_barrier_norm_cdf(phi * d1);
+    r.gamma = pdf / (spot * vol * sqrt_t);
+    r.theta = -spot * pdf * vol / (2.0 * sqrt_t) - phi * rate * strike * df * mco_barrier_norm_cdf(phi * d2);
+    return r;
+}
+
+void mco_barrier_pde_batch(mco_ctx *ctx,
+                           const double *spot,
+                           const double *strike,
+                           const double *barrier,
+                           const double *rebate,
+                           const double *rate,
+                           const double *volatility,
+                           const double *time,
+                           size_t n,
+                           mco_barrier_style style,
+                           mco_option_type type,
+                           mco_pde_result *out)
+{
+    if (!ctx || !spot || !strike || !barrier || !rate || !volatility || !time || !out) return;
+
+    mco_pde_contract *contracts = mco_pde_contracts_new(spot, strike, rate, volatility, time, n);
+    if (!contracts) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return;
+    }
+
+    int is_up = (style == MCO_BARRIER_UP_IN || style == MCO_BARRIER_UP_OUT);
+    int is_knock_in = (style == MCO_BARRIER_DOWN_IN || style == MCO_BARRIER_UP_IN);
+
+    /* Every contract is solved as the knock-out; knock-ins drop the rebate */
+    for (size_t k = 0; k < n; ++k) {
+        if (!(barrier[k] > 0.0)) {
+            contracts[k].time = 0.0;    /* Rejected by mco_pde_run */
+            continue;
+        }
+        if (is_up) contracts[k].upper_barrier = barrier[k];
+        else contracts[k].lower_barrier = barrier[k];
+        contracts[k].rebate = (rebate && !is_knock_in) ? rebate[k] : 0.0;
+    }
+
+    mco_pde_spec spec;
+    mco_pde_spec_init(&spec, ctx, MCO_PDE_VANILLA, type);
+    mco_pde_run(ctx, &spec, contracts, n, out);
+
+    for (size_t k = 0; k < n; ++k) {
+        const mco_pde_contract *c = &contracts[k];
+        if (!(c->spot > 0.0 && c->strike > 0.0 && c->volatility > 0.0 && c->time > 0.0)) {
+            continue;
+        }
 
-    double y1 = log(barrier / spot) / (vol * sqrt_t) + (1.0 + mu) * vol * sqrt_t;
+        int knocked = is_up ? spot[k] >= barrier[k] : spot[k] <= barrier[k];
+        if (knocked && !is_knock_in) {
+            double pv = c->rebate * exp(-c->rate * c->time);
+            out[k] = (mco_pde_result){ pv, 0.0, 0.0, c->rate * pv };
+            continue;
+        }
+
+        mco_pde_result vanilla = black_scholes_result(c->spot, c->strike, c->rate,
+                                                      c->volatility, c->time, type);
+        if (knocked) {
+            out[k] = vanilla;
+        } else if (is_knock_in) {
+            out[k].price = vanilla.price - out[k].price;
+            out[k].delta = vanilla.delta - out[k].delta;
+            out[k].gamma = vanilla.gamma - out[k].gamma;
+            out[k].theta = vanilla.theta - out[k].theta;
+        }
+    }
 
-    return -spot * pow_term * norm_cdf(-y1) + strike * exp(-rate * time) * pow_term * norm_cdf(-y1 + vol * sqrt_t);
+    mco_free(contracts);
 }
 
 /*============================================================================
@@ -335,3 +840,75 @@ double mco_barrier_put(mco_ctx *ctx, double spot, double strike, double barrier,
     return mco_price_barrier(ctx, spot, strike, barrier, rebate, rate, vol, time,
                               steps, type, MCO_PUT);
 }
+
+double mco_barrier_discrete_call(mco_ctx *ctx, double spot, double strike, double barrier,
+                                 double rebate, double rate, double vol,
+                                 const double *monitor_times, size_t num_dates,
+                                 mco_barrier_style type)
+{
+    return mco_price_barrier_discrete(ctx, spot, strike, barrier, rebate, rate, vol,
+                                      monitor_times, num_dates, type, MCO_CALL);
+}
+
+double mco_barrier_discrete_put(mco_ctx *ctx, double spot, double strike, double barrier,
+                                double rebate, double rate, double vol,
+                                const double *monitor_times, size_t num_dates,
+                                mco_barrier_style type)
+{
+    return mco_price_barrier_discrete(ctx, spot, strike, barrier, rebate, rate, vol,
+                                      monitor_times, num_dates, type, MCO_PUT);
+}
+
+double mco_barrier_analytic_call(double spot, double strike, double barrier,
+                                 double rebate, double rate, double vol,
+                                 double time, size_t monitor_dates,
+                                 mco_barrier_style type)
+{
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time,
+                                      monitor_dates, type, MCO_CALL);
+}
+
+double mco_barrier_analytic_put(double spot, double strike, double barrier,
+                                double rebate, double rate, double vol,
+                                double time, size_t monitor_dates,
+                                mco_barrier_style type)
+{
+    return mco_barrier_analytic_price(spot, strike, barrier, rebate, rate, vol, time,
+                                      monitor_dates, type, MCO_PUT);
+}
+
+void mco_barrier_analytic_batch(const double *spot,
+                                const double *strike,
+                                const double *barrier,
+                                const double *rebate,
+                                const double *rate,
+                                const double *volatility,
+                                const double *time,
+                                size_t n,
+                                size_t monitor_dates,
+                                mco_barrier_style barrier_type,
+                                mco_option_type option_type,
+                                double *out)
+{
+    if (!spot || !strike || !barrier || !rate || !volatility || !time || !out) return;
+
+    mco_barrier_analytic_price_batch(spot, strike, barrier, rebate, rate, volatility, time,
+                                     n, monitor_dates, barrier_type, option_type, out);
+}
+
+void mco_barrier_analytic_values(const double *spot,
+                                 const double *strike,
+                                 const double *barrier,
+                                 const double *rebate,
+                                 const double *rate,
+                                 const double *volatility,
+                                 const double *time,
+                                 size_t n,
+                                 size_t monitor_dates,
+                                 mco_barrier_values *out)
+{
+    if (!spot || !strike || !barrier || !rate || !volatility || !time || !out) return;
+
+    mco_barrier_analytic_values_batch(spot, strike, barrier, rebate, rate, volatility, time,
+                                      n, monitor_dates, out);
+}
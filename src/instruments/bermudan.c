@@ -6,100 +6,53 @@
 
 #include "internal/instruments/bermudan.h"
 #include "internal/methods/lsm.h"
-#include "internal/models/gbm.h"
+#include "internal/methods/exercise_cache.h"
+#include "internal/methods/lattice.h"
+#include "internal/methods/pde.h"
+#include "internal/models/gbm_schedule.h"
 #include "internal/allocator.h"
 #include "mcoptions.h"
 #include <math.h>
-#include <string.h>
 
 /*============================================================================
  * Bermudan LSM Implementation
  *============================================================================*/
 
-double mco_price_bermudan(mco_ctx *ctx,
-                          double spot,
-                          double strike,
-                          double rate,
-                          double volatility,
-                          double time_to_maturity,
-                          const double *exercise_times,
-                          size_t num_exercise,
-                          mco_option_type type)
+/*
+ * Backward LSM through the exercise dates of sched, recording each
+ * date's regression into policy when it is non-NULL. Writes the price
+ * and its standard error. Returns 0, or -1 on allocation failure.
+ */
+static int bermudan_fit(const mco_gbm_schedule *sched,
+                        const mco_lsm_basis *basis,
+                        mco_rng rng,
+                        uint64_t n_paths,
+                        double strike,
+                        mco_option_type type,
+                        const mco_path_controls *pc,
+                        mco_mcv_stats *cv_stats,
+                        mco_exercise_policy *policy,
+                        double *price,
+                        double *std_error)
 {
-    if (!ctx || !exercise_times || num_exercise == 0) return 0.0;
-
-    if (spot <= 0.0 || strike <= 0.0 || volatility < 0.0 || time_to_maturity < 0.0) {
-        ctx->last_error = MCO_ERR_INVALID_ARG;
-        return 0.0;
-    }
-
-    uint64_t n_paths = ctx->num_simulations;
-
-    /*
-     * We need to simulate paths and store spot prices at each exercise date.
-     * Use fine time steps for accuracy, but only record at exercise times.
-     */
-    size_t sim_steps = num_exercise * 10;  /* 10 steps between each exercise */
-    if (sim_steps < 50) sim_steps = 50;
+    size_t num_exercise = sched->num_dates;
+    double rate = sched->rate;
 
     /* Allocate arrays */
     double *spot_at_ex = (double *)mco_malloc(n_paths * num_exercise * sizeof(double));
     double *cashflow = (double *)mco_calloc(n_paths, sizeof(double));
-    double *path = (double *)mco_malloc((sim_steps + 1) * sizeof(double));
-
-    /* Regression arrays */
-    double *A = (double *)mco_malloc(n_paths * MCO_LSM_NUM_BASIS * sizeof(double));
-    double *Y = (double *)mco_malloc(n_paths * sizeof(double));
-    uint64_t *itm_indices = (uint64_t *)mco_malloc(n_paths * sizeof(uint64_t));
-
-    if (!spot_at_ex || !cashflow || !path || !A || !Y || !itm_indices) {
-        mco_free(spot_at_ex);
-        mco_free(cashflow);
-        mco_free(path);
-        mco_free(A);
-        mco_free(Y);
-        mco_free(itm_indices);
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
-    }
-
-    /* Initialize GBM path model */
-    mco_gbm_path model;
-    mco_gbm_path_init(&model, spot, rate, volatility, time_to_maturity, sim_steps);
 
-    /* Convert exercise times to step indices */
-    size_t *ex_steps = (size_t *)mco_malloc(num_exercise * sizeof(size_t));
-    if (!ex_steps) {
+    if (!spot_at_ex || !cashflow) {
         mco_free(spot_at_ex);
         mco_free(cashflow);
-        mco_free(path);
-        mco_free(A);
-        mco_free(Y);
-        mco_free(itm_indices);
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
-    }
-
-    for (size_t i = 0; i < num_exercise; ++i) {
-        /* exercise_times[i] is fraction of time_to_maturity */
-        double t_frac = exercise_times[i];
-        if (t_frac > 1.0) t_frac = 1.0;
-        if (t_frac < 0.0) t_frac = 0.0;
-        ex_steps[i] = (size_t)(t_frac * (double)sim_steps + 0.5);
-        if (ex_steps[i] > sim_steps) ex_steps[i] = sim_steps;
+        return -1;
     }
 
     /*=========================================================================
-     * Step 1: Simulate paths and record spot at exercise dates
+     * Step 1: Simulate spot at the exercise dates
      *=========================================================================*/
-    mco_rng rng = ctx->rng;
-
     for (uint64_t i = 0; i < n_paths; ++i) {
-        mco_gbm_simulate_path(&model, &rng, path);
-
-        for (size_t j = 0; j < num_exercise; ++j) {
-            spot_at_ex[i * num_exercise + j] = path[ex_steps[j]];
-        }
+        mco_gbm_schedule_simulate(sched, &rng, spot_at_ex + i * num_exercise);
     }
 
     /*=========================================================================
@@ -115,8 +68,8 @@ double mco_price_bermudan(mco_ctx *ctx,
      *=========================================================================*/
     for (int ex_idx = (int)num_exercise - 2; ex_idx >= 0; --ex_idx) {
         /* Discount factor from this exercise to next */
-        double t_this = exercise_times[ex_idx] * time_to_maturity;
-        double t_next = exercise_times[ex_idx + 1] * time_to_maturity;
+        double t_this = sched->times[(size_t)ex_idx];
+        double t_next = sched->times[(size_t)ex_idx + 1];
         double df = exp(-rate * (t_next - t_this));
 
         /* Discount cashflows one period */
@@ -124,76 +77,181 @@ double mco_price_bermudan(mco_ctx *ctx,
             cashflow[i] *= df;
         }
 
-        /* Find ITM paths */
-        size_t n_itm = 0;
-        for (uint64_t i = 0; i < n_paths; ++i) {
-            double s_t = spot_at_ex[i * num_exercise + (size_t)ex_idx];
-            double ex_val = mco_payoff(s_t, strike, type);
+        /* Regress and exercise */
+        double coeffs[MCO_LSM_MAX_BASIS];
+        int rc = mco_lsm_exercise_step(basis, spot_at_ex + (size_t)ex_idx, num_exercise,
+                                       cashflow, n_paths, strike, type, coeffs);
+        if (policy) {
+            mco_exercise_policy_record(policy, (size_t)ex_idx, rc == 0 ? coeffs : NULL, strike);
+        }
+    }
 
-            if (ex_val > 0.0) {
-                itm_indices[n_itm] = i;
+    /*=========================================================================
+     * Step 4: Final discount to time 0
+     *=========================================================================*/
+    double t_first = sched->times[0];
+    double df_first = exp(-rate * t_first);
 
-                double x = s_t / strike;
-                mco_lsm_basis(x, A + n_itm * MCO_LSM_NUM_BASIS);
-                Y[n_itm] = cashflow[i];
+    *price = mco_lsm_price(cashflow, df_first, spot_at_ex + (num_exercise - 1),
+                           num_exercise, n_paths, pc, cv_stats, std_error);
 
-                n_itm++;
-            }
-        }
+    /* Cleanup */
+    mco_free(spot_at_ex);
+    mco_free(cashflow);
 
-        if (n_itm < MCO_LSM_NUM_BASIS) continue;
+    return 0;
+}
 
-        /* Regression */
-        double coeffs[MCO_LSM_NUM_BASIS];
-        int rc = mco_lsm_regress(A, Y, coeffs, n_itm, MCO_LSM_NUM_BASIS);
-        if (rc != 0) continue;
+double mco_price_bermudan_policy(mco_ctx *ctx,
+                                 double spot,
+                                 double strike,
+                                 double rate,
+                                 double volatility,
+                                 double time_to_maturity,
+                                 const double *exercise_times,
+                                 size_t num_exercise,
+                                 mco_option_type type,
+                                 mco_exercise_policy *policy_out)
+{
+    if (policy_out) {
+        policy_out->coeffs = NULL;
+        policy_out->fitted = NULL;
+    }
+    if (!ctx || !exercise_times || num_exercise == 0) return 0.0;
 
-        /* Exercise decision */
-        for (size_t j = 0; j < n_itm; ++j) {
-            uint64_t i = itm_indices[j];
-            double s_t = spot_at_ex[i * num_exercise + (size_t)ex_idx];
-            double ex_val = mco_payoff(s_t, strike, type);
+    if (spot <= 0.0 || strike <= 0.0 || volatility < 0.0 || time_to_maturity < 0.0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
+
+    /*
+     * Exercise dates in years. GBM is sampled exactly at these dates -
+     * no fine grid and no rounding of dates to grid points.
+     */
+    double *ex_dates = (double *)mco_malloc(num_exercise * sizeof(double));
+    if (!ex_dates) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+    for (size_t i = 0; i < num_exercise; ++i) {
+        /* exercise_times[i] is fraction of time_to_maturity */
+        double t_frac = exercise_times[i];
+        if (t_frac > 1.0) t_frac = 1.0;
+        if (t_frac < 0.0) t_frac = 0.0;
+        ex_dates[i] = t_frac * time_to_maturity;
+    }
 
-            double x = s_t / strike;
-            double basis[MCO_LSM_NUM_BASIS];
-            mco_lsm_basis(x, basis);
+    if (!mco_gbm_schedule_valid(ex_dates, num_exercise)) {
+        mco_free(ex_dates);
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
 
-            double continuation = 0.0;
-            for (size_t k = 0; k < MCO_LSM_NUM_BASIS; ++k) {
-                continuation += coeffs[k] * basis[k];
-            }
+    /* PDE engine: exercised after the time step nearest each date */
+    double maturity = ex_dates[num_exercise - 1];
+    if (ctx->american_engine == MCO_ENGINE_PDE && !policy_out
+        && volatility > 0.0 && maturity > 0.0) {
+        mco_pde_contract contract = { spot, strike, rate, volatility, maturity,
+                                      0.0, 0.0, 0.0, 0.0 };
+        mco_pde_spec spec;
+        mco_pde_spec_init(&spec, ctx, MCO_PDE_VANILLA, type);
+        spec.exercise_times = ex_dates;
+        spec.num_exercise = num_exercise;
+
+        mco_pde_result result = { 0.0, 0.0, 0.0, 0.0 };
+        if (mco_pde_solve(&spec, &contract, 1, &result) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+        }
+        mco_free(ex_dates);
+        return result.price;
+    }
 
-            if (ex_val > continuation) {
-                cashflow[i] = ex_val;
-            }
+    /* Lattice engine: same dates, exercised on the nearest tree level */
+    if (ctx->american_engine != MCO_ENGINE_LSM && !policy_out) {
+        mco_lattice_spec spec;
+        mco_lattice_spec_init(&spec, ctx);
+        spec.exercise_times = ex_dates;
+        spec.num_exercise = num_exercise;
+
+        double price = 0.0;
+        if (mco_lattice_price(&spec, spot, &strike, 1, rate, volatility,
+                              maturity, type, &price) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
         }
+        mco_free(ex_dates);
+        return price;
     }
 
-    /*=========================================================================
-     * Step 4: Final discount to time 0
-     *=========================================================================*/
-    double t_first = exercise_times[0] * time_to_maturity;
-    double df_first = exp(-rate * t_first);
+    mco_gbm_schedule sched;
+    int sched_rc = mco_gbm_schedule_init(&sched, spot, rate, volatility, ex_dates, num_exercise);
+    mco_free(ex_dates);
+    if (sched_rc != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
 
-    double sum = 0.0;
-    for (uint64_t i = 0; i < n_paths; ++i) {
-        sum += cashflow[i] * df_first;
+    mco_lsm_basis basis;
+    mco_lsm_basis_init(&basis, ctx, strike, volatility, time_to_maturity);
+
+    /* A policy is kept when the caller wants it or the cache will */
+    mco_exercise_cache *cache = ctx->exercise_cache;
+    mco_exercise_policy local = {0};
+    mco_exercise_policy *policy = policy_out ? policy_out : (cache ? &local : NULL);
+
+    if (policy && mco_exercise_policy_init(policy, &basis, num_exercise) != 0) {
+        mco_gbm_schedule_free(&sched);
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
     }
 
-    double price = sum / (double)n_paths;
+    /* Controls on the spot at the last exercise date */
+    mco_path_controls controls;
+    mco_mcv_stats cv_stats;
+    mco_path_controls_init(&controls, &cv_stats, ctx->control_variates,
+                           MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA,
+                           spot, strike, 0.0, 0, rate, volatility,
+                           sched.maturity, num_exercise, type);
+
+    double price = 0.0;
+    double std_error = 0.0;
+    mco_exercise_key key;
+    if (cache) {
+        mco_exercise_key_init(&key, &sched, strike, volatility, type, &basis);
+    }
 
-    /* Cleanup */
-    mco_free(spot_at_ex);
-    mco_free(cashflow);
-    mco_free(path);
-    mco_free(A);
-    mco_free(Y);
-    mco_free(itm_indices);
-    mco_free(ex_steps);
+    if (cache && mco_exercise_cache_get(cache, &key, policy)) {
+        /* Known contract: forward pass under the cached policy */
+        price = mco_exercise_forward_price(ctx, &sched, policy, strike, type,
+                                           &controls, &cv_stats);
+    } else if (bermudan_fit(&sched, &basis, ctx->rng, ctx->num_simulations, strike, type,
+                            &controls, &cv_stats, policy, &price, &std_error) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        if (policy) mco_exercise_policy_free(policy);
+    } else {
+        ctx->last_std_error = std_error;
+        if (cache) mco_exercise_cache_put(cache, &key, policy);
+    }
+
+    mco_gbm_schedule_free(&sched);
+    if (policy == &local) mco_exercise_policy_free(&local);
 
     return price;
 }
 
+double mco_price_bermudan(mco_ctx *ctx,
+                          double spot,
+                          double strike,
+                          double rate,
+                          double volatility,
+                          double time_to_maturity,
+                          const double *exercise_times,
+                          size_t num_exercise,
+                          mco_option_type type)
+{
+    return mco_price_bermudan_policy(ctx, spot, strike, rate, volatility, time_to_maturity,
+                                     exercise_times, num_exercise, type, NULL);
+}
+
 double mco_price_bermudan_uniform(mco_ctx *ctx,
                                   double spot,
                                   double strike,
@@ -250,3 +308,44 @@ double mco_bermudan_put(mco_ctx *ctx,
     return mco_price_bermudan_uniform(ctx, spot, strike, rate, volatility,
                                        time_to_maturity, num_exercise, MCO_PUT);
 }
+
+size_t mco_bermudan_exercise_boundary(mco_ctx *ctx,
+                                      double spot,
+                                      double strike,
+                                      double rate,
+                                      double volatility,
+                                      double time_to_maturity,
+                                      size_t num_exercise,
+                                      mco_option_type type,
+                                      double *times,
+                                      double *boundary)
+{
+    if (!ctx || num_exercise == 0 || !times || !boundary) return 0;
+
+    double *ex_times = (double *)mco_malloc(num_exercise * sizeof(double));
+    if (!ex_times) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0;
+    }
+    for (size_t i = 0; i < num_exercise; ++i) {
+        ex_times[i] = (double)(i + 1) / (double)num_exercise;
+    }
+
+    /* No policy comes back on any failure */
+    mco_exercise_policy policy;
+    mco_price_bermudan_policy(ctx, spot, strike, rate, volatility, time_to_maturity,
+                              ex_times, num_exercise, type, &policy);
+
+    size_t written = 0;
+    if (policy.coeffs) {
+        for (size_t i = 0; i < num_exercise; ++i) {
+            times[i] = ex_times[i] * time_to_maturity;
+        }
+        mco_exercise_policy_boundary(&policy, strike, type, boundary);
+        written = num_exercise;
+    }
+
+    mco_exercise_policy_free(&policy);
+    mco_free(ex_times);
+    return written;
+}
@@ -4,6 +4,12 @@
 
 #include "internal/instruments/digital.h"
 #include "internal/models/gbm.h"
+#include "internal/variance_reduction/stratified.h"
+#include "internal/variance_reduction/importance.h"
+#include "internal/methods/pde.h"
+#include "internal/methods/fast_mc.h"
+#include "internal/allocator.h"
+#include "internal/specialise.h"
 #include "mcoptions.h"
 #include <math.h>
 
@@ -16,6 +22,61 @@ static double norm_cdf(double x)
  * Monte Carlo Digital Pricing
  *============================================================================*/
 
+/* Path loop variants (internal/specialise.h) */
+#define DIGITAL_CALL       (1u << 0)
+#define DIGITAL_CASH       (1u << 1)    /* Cash-or-nothing, else asset */
+#define DIGITAL_STRATIFIED (1u << 2)    /* Stratified terminal normal */
+#define DIGITAL_IS         (1u << 3)    /* Importance-sampling shift */
+
+typedef struct {
+    const mco_gbm *model;
+    mco_rng rng;
+    uint64_t n_paths;
+    double strike;
+    double payout;
+    double theta;               /* Normal mean shift */
+    mco_is_stats *stats;
+} digital_run;
+
+/*
+ * Simulate every path into the discounted payoff statistics.
+ */
+MCO_SPECIALISE void digital_paths(const digital_run *run, unsigned variant)
+{
+    const mco_gbm *model = run->model;
+    mco_rng rng = run->rng;
+
+    for (uint64_t i = 0; i < run->n_paths; ++i) {
+        double z = (variant & DIGITAL_STRATIFIED)
+                 ? mco_stratified_normal(&rng, i, run->n_paths)
+                 : mco_rng_normal(&rng);
+        if (variant & DIGITAL_IS) z += run->theta;
+
+        double s_T = mco_gbm_terminal(model, z);
+
+        int itm = (variant & DIGITAL_CALL) ? (s_T > run->strike) : (s_T < run->strike);
+
+        double payoff = 0.0;
+        if (itm) {
+            payoff = (variant & DIGITAL_CASH) ? run->payout : s_T;
+            if (variant & DIGITAL_IS) {
+                payoff *= mco_is_weight(run->theta, z);
+            }
+        }
+
+        mco_is_add(run->stats, model->discount * payoff);
+    }
+}
+
+#define DIGITAL_KERNEL(v) \
+    static void digital_paths_##v(const digital_run *run) { digital_paths(run, v); }
+MCO_VARIANTS_16(DIGITAL_KERNEL)
+
+#define DIGITAL_ENTRY(v) digital_paths_##v,
+static void (*const digital_kernels[16])(const digital_run *) = {
+    MCO_VARIANTS_16(DIGITAL_ENTRY)
+};
+
 double mco_price_digital(mco_ctx *ctx,
                          double spot,
                          double strike,
@@ -28,33 +89,61 @@ double mco_price_digital(mco_ctx *ctx,
 {
     if (!ctx) return 0.0;
 
-    uint64_t n_paths = ctx->num_simulations;
-
     /* Initialize GBM model */
     mco_gbm model;
     mco_gbm_init(&model, spot, rate, volatility, time);
 
-    double sum_payoff = 0.0;
-    mco_rng rng = ctx->rng;
+    /*
+     * Importance sampling: the option is ITM for Z beyond
+     *   a = (ln(K/S) - (r - σ²/2)T) / (σ√T)
+     * and the asset payoff carries an extra e^{σ√T·Z}.
+     */
+    int use_is = ctx->importance_sampling_enabled && model.diffusion > 0.0 && strike > 0.0;
+    double theta = 0.0;
+    if (use_is) {
+        double a = (log(strike / spot) - model.drift) / model.diffusion;
+        double c = (digital_type == MCO_DIGITAL_ASSET) ? model.diffusion : 0.0;
+        theta = (option_type == MCO_CALL) ? mco_is_optimal_shift(a, c)
+                                          : -mco_is_optimal_shift(-a, -c);
+    }
 
-    for (uint64_t i = 0; i < n_paths; ++i) {
-        double s_T = mco_gbm_simulate(&model, &rng);
+    /* Single-precision lanes (internal/methods/fast_mc.h) */
+    if (ctx->precision == MCO_PRECISION_FAST && !ctx->stratified_enabled && !use_is) {
+        mco_fast_spec spec;
+        mco_fast_spec_init(&spec, spot, rate, volatility, time, 1, MCO_FAST_WALK_TERMINAL);
+        spec.x = MCO_FAST_SPOT;
+        spec.y = MCO_FAST_STRIKE;
+        spec.pay = (digital_type == MCO_DIGITAL_CASH) ? MCO_FAST_PAY_CASH : MCO_FAST_PAY_ASSET;
+        spec.phi = (option_type == MCO_CALL) ? 1.0 : -1.0;
+        spec.strike = strike;
+        spec.payout = payout;
+        return mco_fast_price(ctx, &spec, &ctx->last_std_error);
+    }
 
-        int itm = (option_type == MCO_CALL) ? (s_T > strike) : (s_T < strike);
+    unsigned variant = 0;
+    if (option_type == MCO_CALL) variant |= DIGITAL_CALL;
+    if (digital_type == MCO_DIGITAL_CASH) variant |= DIGITAL_CASH;
+    if (ctx->stratified_enabled) variant |= DIGITAL_STRATIFIED;
+    if (use_is) variant |= DIGITAL_IS;
 
-        double payoff = 0.0;
-        if (itm) {
-            if (digital_type == MCO_DIGITAL_CASH) {
-                payoff = payout;
-            } else {
-                payoff = s_T;
-            }
-        }
+    /* Strata are simulated in order, so neighbours pair up for the error */
+    mco_is_stats stats;
+    mco_is_init_as(&stats, ctx->stratified_enabled ? MCO_IS_ERROR_STRATA : MCO_IS_ERROR_IID, 0);
 
-        sum_payoff += payoff;
-    }
+    digital_run run = {
+        .model   = &model,
+        .rng     = ctx->rng,
+        .n_paths = ctx->num_simulations,
+        .strike  = strike,
+        .payout  = payout,
+        .theta   = theta,
+        .stats   = &stats
+    };
+    digital_kernels[variant](&run);
 
-    return model.discount * (sum_payoff / (double)n_paths);
+    ctx->last_std_error = mco_is_std_error(&stats);
+
+    return mco_is_mean(&stats);
 }
 
 /*============================================================================
@@ -142,3 +231,34 @@ double mco_digital_put(mco_ctx *ctx, double spot, double strike, double payout,
     mco_digital_type type = cash_or_nothing ? MCO_DIGITAL_CASH : MCO_DIGITAL_ASSET;
     return mco_price_digital(ctx, spot, strike, payout, rate, vol, time, type, MCO_PUT);
 }
+
+void mco_digital_pde_batch(mco_ctx *ctx,
+                           const double *spot,
+                           const double *strike,
+                           const double *payout,
+                           const double *rate,
+                           const double *vol,
+                           const double *time,
+                           size_t n,
+                           int cash_or_nothing,
+                           mco_option_type type,
+                           mco_pde_result *out)
+{
+    if (!ctx || !spot || !strike || !rate || !vol || !time || !out) return;
+    if (cash_or_nothing && !payout) return;
+
+    mco_pde_contract *contracts = mco_pde_contracts_new(spot, strike, rate, vol, time, n);
+    if (!contracts) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return;
+    }
+
+    if (cash_or_nothing) {
+        for (size_t k = 0; k < n; ++k) contracts[k].payout = payout[k];
+    }
+
+    mco_pde_spec spec;
+    mco_pde_spec_init(&spec, ctx, cash_or_nothing ? MCO_PDE_CASH : MCO_PDE_ASSET, type);
+    mco_pde_run(ctx, &spec, contracts, n, out);
+    mco_free(contracts);
+}
@@ -12,8 +12,13 @@
 #include "internal/instruments/european.h"
 #include "internal/models/gbm.h"
 #include "internal/variance_reduction/antithetic.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/variance_reduction/stratified.h"
 #include "internal/methods/thread_pool.h"
+#include "internal/methods/pde.h"
+#include "internal/methods/fast_mc.h"
 #include "internal/allocator.h"
+#include "internal/sum.h"
 #include "mcoptions.h"
 
 /*============================================================================
@@ -34,15 +39,44 @@ static double price_european_basic(mco_ctx *ctx,
     mco_gbm model;
     mco_gbm_init(&model, spot, rate, volatility, time_to_maturity);
 
-    double sum = 0.0;
+    mco_sum sum;
+    mco_sum_init(&sum);
     uint64_t n = ctx->num_simulations;
 
     for (uint64_t i = 0; i < n; ++i) {
         double s_t = mco_gbm_simulate(&model, &ctx->rng);
-        sum += mco_payoff(s_t, strike, type);
+        mco_sum_add(&sum, mco_payoff(s_t, strike, type));
     }
 
-    return model.discount * (sum / (double)n);
+    return model.discount * (mco_sum_value(&sum) / (double)n);
+}
+
+/*
+ * Price European option with a stratified terminal normal.
+ *
+ * Path i draws from stratum i of N, so every stratum is hit exactly once.
+ */
+static double price_european_stratified(mco_ctx *ctx,
+                                        double spot,
+                                        double strike,
+                                        double rate,
+                                        double volatility,
+                                        double time_to_maturity,
+                                        mco_option_type type)
+{
+    mco_gbm model;
+    mco_gbm_init(&model, spot, rate, volatility, time_to_maturity);
+
+    mco_sum sum;
+    mco_sum_init(&sum);
+    uint64_t n = ctx->num_simulations;
+
+    for (uint64_t i = 0; i < n; ++i) {
+        double z = mco_stratified_normal(&ctx->rng, i, n);
+        mco_sum_add(&sum, mco_payoff(mco_gbm_terminal(&model, z), strike, type));
+    }
+
+    return model.discount * (mco_sum_value(&sum) / (double)n);
 }
 
 /*
@@ -63,6 +97,96 @@ static double price_european_antithetic(mco_ctx *ctx,
                                    ctx->num_simulations);
 }
 
+/*============================================================================
+ * Registered Control Variates
+ *============================================================================*/
+
+typedef struct {
+    const mco_gbm *model;
+    double log_spot;            /* log S₀ */
+    const mco_path_controls *controls;
+    double strike;
+    mco_option_type type;
+    uint64_t num_strata;        /* Stratify the terminal normal (0 = off) */
+    mco_mcv_stats *stats;       /* One slot per thread */
+} european_controls_job;
+
+static void european_controls_worker(void *arg, uint32_t thread_id, mco_rng *rng,
+                                     uint64_t start, uint64_t end)
+{
+    const european_controls_job *job = (const european_controls_job *)arg;
+    mco_mcv_stats *stats = &job->stats[thread_id];
+    uint32_t track = mco_path_controls_track(job->controls);
+
+    for (uint64_t i = start; i < end; ++i) {
+        double normal = job->num_strata
+                      ? mco_stratified_normal(rng, i, job->num_strata)
+                      : mco_rng_normal(rng);
+
+        mco_path_state st;
+        mco_path_state_init(&st, job->model->spot, track);
+        mco_path_state_observe(&st, job->log_spot + job->model->drift
+                                    + job->model->diffusion * normal);
+        double terminal = mco_path_state_spot(&st);
+
+        double z[MCO_MCV_MAX];
+        mco_path_controls_eval(job->controls, &st, 0.0, z);
+        mco_mcv_add(stats, job->model->discount * mco_payoff(terminal, job->strike, job->type), z);
+    }
+}
+
+/*
+ * Price European option with the controls registered on the context.
+ *
+ * Runs single- or multi-threaded through mco_parallel_for; per-thread
+ * accumulators are merged before the coefficients are solved.
+ */
+static double price_european_controls(mco_ctx *ctx,
+                                      const mco_path_controls *controls,
+                                      const mco_mcv_stats *proto,
+                                      double spot,
+                                      double strike,
+                                      double rate,
+                                      double volatility,
+                                      double time_to_maturity,
+                                      mco_option_type type)
+{
+    mco_gbm model;
+    mco_gbm_init(&model, spot, rate, volatility, time_to_maturity);
+
+    uint32_t num_threads = ctx->num_threads ? ctx->num_threads : 1;
+    mco_mcv_stats *stats = (mco_mcv_stats *)mco_calloc(num_threads, sizeof(mco_mcv_stats));
+    if (!stats) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mco_mcv_init(&stats[t], proto->ez, proto->k);
+    }
+
+    european_controls_job job = {
+        .model      = &model,
+        .log_spot   = log(spot),
+        .controls   = controls,
+        .strike     = strike,
+        .type       = type,
+        .num_strata = ctx->stratified_enabled ? ctx->num_simulations : 0,
+        .stats      = stats
+    };
+
+    uint32_t used = mco_parallel_for(ctx, ctx->num_simulations,
+                                     european_controls_worker, &job);
+
+    mco_mcv_stats total;
+    mco_mcv_init(&total, proto->ez, proto->k);
+    for (uint32_t t = 0; t < used; ++t) {
+        mco_mcv_merge(&total, &stats[t]);
+    }
+    mco_free(stats);
+
+    return mco_mcv_estimate(&total);
+}
+
 /*============================================================================
  * Main Entry Point
  *============================================================================*/
@@ -72,7 +196,12 @@ static double price_european_antithetic(mco_ctx *ctx,
  *
  * Automatically selects:
  *   - Single vs multi-threaded based on ctx->num_threads
+ *   - Stratified terminal normal based on ctx->stratified_enabled,
+ *     which takes precedence over antithetic variates
  *   - Antithetic variates based on ctx->antithetic_enabled
+ *   - Registered control variates (MCO_CONTROL_SPOT), which take
+ *     precedence over antithetic sampling and combine with stratification
+ *   - Single-precision lanes for MCO_PRECISION_FAST with plain sampling
  */
 double mco_price_european(mco_ctx *ctx,
                           double spot,
@@ -90,6 +219,29 @@ double mco_price_european(mco_ctx *ctx,
         return 0.0;
     }
 
+    /* Registered control variates */
+    mco_path_controls controls;
+    mco_mcv_stats proto;
+    if (mco_path_controls_init(&controls, &proto, ctx->control_variates,
+                               MCO_CONTROL_SPOT, spot, strike, 0.0, 0, rate,
+                               volatility, time_to_maturity, 1, type) > 0) {
+        return price_european_controls(ctx, &controls, &proto, spot, strike, rate,
+                                       volatility, time_to_maturity, type);
+    }
+
+    /* Single-precision lanes (internal/methods/fast_mc.h) */
+    if (ctx->precision == MCO_PRECISION_FAST && !ctx->stratified_enabled
+        && !ctx->antithetic_enabled) {
+        mco_fast_spec spec;
+        mco_fast_spec_init(&spec, spot, rate, volatility, time_to_maturity, 1,
+                           MCO_FAST_WALK_TERMINAL);
+        spec.x = MCO_FAST_SPOT;
+        spec.y = MCO_FAST_STRIKE;
+        spec.phi = (type == MCO_CALL) ? 1.0 : -1.0;
+        spec.strike = strike;
+        return mco_fast_price(ctx, &spec, &ctx->last_std_error);
+    }
+
     /* Multi-threaded path */
     if (ctx->num_threads > 1) {
         return mco_parallel_european(ctx, spot, strike, rate, volatility,
@@ -97,7 +249,10 @@ double mco_price_european(mco_ctx *ctx,
     }
 
     /* Single-threaded path */
-    if (ctx->antithetic_enabled) {
+    if (ctx->stratified_enabled) {
+        return price_european_stratified(ctx, spot, strike, rate, volatility,
+                                         time_to_maturity, type);
+    } else if (ctx->antithetic_enabled) {
         return price_european_antithetic(ctx, spot, strike, rate, volatility,
                                          time_to_maturity, type);
     } else {
@@ -131,3 +286,27 @@ double mco_european_put(mco_ctx *ctx,
     return mco_price_european(ctx, spot, strike, rate, volatility,
                               time_to_maturity, MCO_PUT);
 }
+
+void mco_european_pde_batch(mco_ctx *ctx,
+                            const double *spot,
+                            const double *strike,
+                            const double *rate,
+                            const double *volatility,
+                            const double *time,
+                            size_t n,
+                            mco_option_type type,
+                            mco_pde_result *out)
+{
+    if (!ctx || !spot || !strike || !rate || !volatility || !time || !out) return;
+
+    mco_pde_contract *contracts = mco_pde_contracts_new(spot, strike, rate, volatility, time, n);
+    if (!contracts) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return;
+    }
+
+    mco_pde_spec spec;
+    mco_pde_spec_init(&spec, ctx, MCO_PDE_VANILLA, type);
+    mco_pde_run(ctx, &spec, contracts, n, out);
+    mco_free(contracts);
+}
@@ -4,10 +4,13 @@
 
 #include "internal/instruments/lookback.h"
 #include "internal/models/gbm.h"
-#include "internal/allocator.h"
+#include "internal/variance_reduction/stratified.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/methods/fast_mc.h"
+#include "internal/specialise.h"
+#include "internal/sum.h"
 #include "mcoptions.h"
 #include <math.h>
-#include <float.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -22,6 +25,96 @@ static double norm_cdf(double x)
  * Monte Carlo Lookback Pricing
  *============================================================================*/
 
+/* Path loop variants (internal/specialise.h) */
+#define LOOKBACK_FLOATING (1u << 0)
+#define LOOKBACK_CALL     (1u << 1)
+#define LOOKBACK_BRIDGE   (1u << 2)     /* Bridge-sampled extremum */
+#define LOOKBACK_LHS      (1u << 3)     /* Latin hypercube normals */
+#define LOOKBACK_CONTROLS (1u << 4)     /* Registered control variates */
+
+typedef struct {
+    const mco_gbm_path *model;
+    mco_lhs *lhs;
+    mco_rng rng;
+    uint64_t n_paths;
+    double strike;
+    const mco_path_controls *controls;
+    mco_mcv_stats *cv_stats;
+} lookback_run;
+
+/*
+ * Simulate every path; returns the undiscounted payoff sum and feeds
+ * the control statistics.
+ */
+MCO_SPECIALISE double lookback_paths(const lookback_run *run, unsigned variant)
+{
+    const mco_gbm_path *model = run->model;
+    int floating = (variant & LOOKBACK_FLOATING) != 0;
+    int call = (variant & LOOKBACK_CALL) != 0;
+    int stratified = (variant & LOOKBACK_LHS) != 0;
+
+    /* Bridge sampling draws only the extremum the payoff uses */
+    uint32_t extremum = MCO_PATH_EXTREMA;
+    if (variant & LOOKBACK_BRIDGE) {
+        extremum = (floating == call) ? MCO_PATH_BRIDGE_MIN : MCO_PATH_BRIDGE_MAX;
+    }
+    uint32_t track = extremum | ((variant & LOOKBACK_CONTROLS) ? MCO_PATH_LOG_SUM : 0u);
+
+    mco_sum sum_payoff;
+    mco_sum_init(&sum_payoff);
+    mco_rng rng = run->rng;
+
+    for (uint64_t i = 0; i < run->n_paths; ++i) {
+        /* Simulate path, tracking min and max (in logs) as it goes */
+        mco_path_state st;
+        mco_path_state_init(&st, model->spot, track);
+        mco_lhs_stream_path_as(run->lhs, model, &rng, run->n_paths - i, &st,
+                               stratified, track);
+
+        double payoff;
+
+        if (floating) {
+            /* Floating strike */
+            double terminal = mco_path_state_spot(&st);
+            if (call) {
+                /* Buy at minimum: S(T) - min(S) */
+                payoff = terminal - mco_path_state_min(&st);
+            } else {
+                /* Sell at maximum: max(S) - S(T) */
+                payoff = mco_path_state_max(&st) - terminal;
+            }
+        } else {
+            /* Fixed strike */
+            if (call) {
+                /* max(max(S) - K, 0) */
+                payoff = fmax(mco_path_state_max(&st) - run->strike, 0.0);
+            } else {
+                /* max(K - min(S), 0) */
+                payoff = fmax(run->strike - mco_path_state_min(&st), 0.0);
+            }
+        }
+
+        mco_sum_add(&sum_payoff, payoff);
+
+        if (variant & LOOKBACK_CONTROLS) {
+            double z[MCO_MCV_MAX];
+            mco_path_controls_eval(run->controls, &st, 0.0, z);
+            mco_mcv_add(run->cv_stats, model->discount * payoff, z);
+        }
+    }
+
+    return mco_sum_value(&sum_payoff);
+}
+
+#define LOOKBACK_KERNEL(v) \
+    static double lookback_paths_##v(const lookback_run *run) { return lookback_paths(run, v); }
+MCO_VARIANTS_32(LOOKBACK_KERNEL)
+
+#define LOOKBACK_ENTRY(v) lookback_paths_##v,
+static double (*const lookback_kernels[32])(const lookback_run *) = {
+    MCO_VARIANTS_32(LOOKBACK_ENTRY)
+};
+
 double mco_price_lookback(mco_ctx *ctx,
                           double spot,
                           double strike,
@@ -35,61 +128,78 @@ double mco_price_lookback(mco_ctx *ctx,
     if (!ctx || num_steps == 0) return 0.0;
 
     uint64_t n_paths = ctx->num_simulations;
-
-    /* Allocate path storage */
-    double *path = (double *)mco_malloc((num_steps + 1) * sizeof(double));
-    if (!path) {
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
+    int call = option_type == MCO_CALL;
+
+    /* Single-precision lanes (internal/methods/fast_mc.h) */
+    if (ctx->precision == MCO_PRECISION_FAST && !ctx->stratified_enabled
+        && ctx->control_variates == 0 && !ctx->bridge_extremum_enabled) {
+        mco_fast_spec spec;
+        mco_fast_spec_init(&spec, spot, rate, volatility, time, num_steps,
+                           MCO_FAST_WALK_EXTREMA);
+        if (strike_type == MCO_LOOKBACK_FLOATING) {
+            /* S(T) - min(S), max(S) - S(T) */
+            spec.x = MCO_FAST_SPOT;
+            spec.y = call ? MCO_FAST_MIN : MCO_FAST_MAX;
+        } else {
+            /* max(S) - K, K - min(S) */
+            spec.x = call ? MCO_FAST_MAX : MCO_FAST_MIN;
+            spec.y = MCO_FAST_STRIKE;
+        }
+        spec.phi = call ? 1.0 : -1.0;
+        spec.strike = strike;
+        return mco_fast_price(ctx, &spec, &ctx->last_std_error);
     }
 
     /* Initialize GBM path model */
     mco_gbm_path model;
     mco_gbm_path_init(&model, spot, rate, volatility, time, num_steps);
 
-    double sum_payoff = 0.0;
-    mco_rng rng = ctx->rng;
-
-    for (uint64_t i = 0; i < n_paths; ++i) {
-        /* Simulate path */
-        mco_gbm_simulate_path(&model, &rng, path);
-
-        /* Find min and max */
-        double path_min = path[0];
-        double path_max = path[0];
-
-        for (size_t j = 1; j <= num_steps; ++j) {
-            if (path[j] < path_min) path_min = path[j];
-            if (path[j] > path_max) path_max = path[j];
-        }
-
-        double terminal = path[num_steps];
-        double payoff = 0.0;
-
-        if (strike_type == MCO_LOOKBACK_FLOATING) {
-            /* Floating strike */
-            if (option_type == MCO_CALL) {
-                /* Buy at minimum: S(T) - min(S) */
-                payoff = terminal - path_min;
-            } else {
-                /* Sell at maximum: max(S) - S(T) */
-                payoff = path_max - terminal;
-            }
-        } else {
-            /* Fixed strike */
-            if (option_type == MCO_CALL) {
-                /* max(max(S) - K, 0) */
-                payoff = fmax(path_max - strike, 0.0);
-            } else {
-                /* max(K - min(S), 0) */
-                payoff = fmax(strike - path_min, 0.0);
-            }
+    /* Latin hypercube over the path normals when stratification is on */
+    mco_lhs lhs;
+    mco_lhs *plhs = NULL;
+    if (ctx->stratified_enabled) {
+        if (mco_lhs_init(&lhs, num_steps, MCO_LHS_BLOCK,
+                         mco_kernels_get((mco_cpu_level)ctx->cpu_level)) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+            return 0.0;
         }
-
-        sum_payoff += payoff;
+        plhs = &lhs;
     }
 
-    mco_free(path);
+    /* Registered control variates; floating strikes use ATM controls */
+    double control_strike = (strike_type == MCO_LOOKBACK_FLOATING) ? spot : strike;
+    mco_path_controls controls;
+    mco_mcv_stats cv_stats;
+    size_t num_controls = mco_path_controls_init(&controls, &cv_stats,
+                                                 ctx->control_variates,
+                                                 MCO_CONTROL_SPOT | MCO_CONTROL_GEOMETRIC
+                                                 | MCO_CONTROL_VANILLA,
+                                                 spot, control_strike, 0.0, 0, rate,
+                                                 volatility, time, num_steps, option_type);
+
+    unsigned variant = 0;
+    if (strike_type == MCO_LOOKBACK_FLOATING) variant |= LOOKBACK_FLOATING;
+    if (call) variant |= LOOKBACK_CALL;
+    if (ctx->bridge_extremum_enabled) variant |= LOOKBACK_BRIDGE;
+    if (plhs) variant |= LOOKBACK_LHS;
+    if (num_controls > 0) variant |= LOOKBACK_CONTROLS;
+
+    lookback_run run = {
+        .model    = &model,
+        .lhs      = plhs,
+        .rng      = ctx->rng,
+        .n_paths  = n_paths,
+        .strike   = strike,
+        .controls = &controls,
+        .cv_stats = &cv_stats
+    };
+    double sum_payoff = lookback_kernels[variant](&run);
+
+    if (plhs) mco_lhs_free(plhs);
+
+    if (num_controls > 0) {
+        return mco_mcv_estimate(&cv_stats);
+    }
 
     return model.discount * (sum_payoff / (double)n_paths);
 }
@@ -99,75 +209,96 @@ double mco_price_lookback(mco_ctx *ctx,
  *============================================================================*/
 
 /*
- * Floating strike lookback call: E[S(T) - min(S)]
+ * Extremum terms shared by the closed forms. With λ = 2r/σ², X the
+ * running extremum or strike, and d₁ = (log(S/X) + (r + ½σ²)T)/(σ√T):
  *
- * Goldman, Sosin, Gatto (1979):
- *   C = S·N(a₁) - S·(σ²/2r)·N(-a₁) - S·e^(-rT)·[N(a₂) - (σ²/2r)·e^(a₃)·N(-a₃)]
+ *   min term:  (σ²/2r)·[(S/X)^(-λ)·N(-d₁ + λσ√T) - e^(rT)·N(-d₁)]
+ *   max term:  (σ²/2r)·[e^(rT)·N(d₁) - (S/X)^(-λ)·N(d₁ - λσ√T)]
  *
- * Simplified form for r ≠ 0
+ * Both are 0/0 at r = 0; the limit there is
+ *
+ *   min term:  σ√T·φ(d₁) - (log(S/X) + ½σ²T)·N(-d₁)
+ *   max term:  min term + log(S/X) + ½σ²T
  */
-double mco_lookback_floating_call(double spot, double rate, double vol, double time)
+#define LOOKBACK_RATE_EPS 1e-8
+
+static double lookback_min_term(double log_sx, double d1, double rate, double vol, double time)
 {
-    if (spot <= 0.0 || time <= 0.0 || vol <= 0.0) {
-        return 0.0;
-    }
+    double vol_sqrt_t = vol * sqrt(time);
+    double half_var = 0.5 * vol * vol * time;
 
-    double sqrt_t = sqrt(time);
-    double vol_sqrt_t = vol * sqrt_t;
+    if (fabs(rate) < LOOKBACK_RATE_EPS) {
+        double pdf = exp(-0.5 * d1 * d1) / sqrt(2.0 * M_PI);
+        return vol_sqrt_t * pdf - (log_sx + half_var) * norm_cdf(-d1);
+    }
 
-    double a1 = (rate / vol + 0.5 * vol) * sqrt_t;
+    double lambda = 2.0 * rate / (vol * vol);
+    return (norm_cdf(-d1 + lambda * vol_sqrt_t) * exp(-lambda * log_sx)
+          - exp(rate * time) * norm_cdf(-d1)) / lambda;
+}
 
-    double df = exp(-rate * time);
+static double lookback_max_term(double log_sx, double d1, double rate, double vol, double time)
+{
+    /* N(y) = 1 - N(-y) turns the max term into the min term plus
+     * (σ²/2r)·[e^(rT) - (S/X)^(-λ)], which expm1 keeps accurate near r = 0 */
+    double min_term = lookback_min_term(log_sx, d1, rate, vol, time);
 
-    if (fabs(rate) < 1e-10) {
-        /* r ≈ 0: simplified formula */
-        return spot * (norm_cdf(a1) - norm_cdf(-a1)) + spot * vol * sqrt_t * 0.7978845608;  /* sqrt(2/π) */
+    if (fabs(rate) < LOOKBACK_RATE_EPS) {
+        return min_term + log_sx + 0.5 * vol * vol * time;
     }
 
-    double vol_sq_over_2r = vol * vol / (2.0 * rate);
-
-    /* Use accurate formula */
-    double mu = rate - 0.5 * vol * vol;
-    double d1 = (mu * time + vol_sqrt_t * vol_sqrt_t) / vol_sqrt_t;
-    double d2 = mu * time / vol_sqrt_t;
-
-    return spot * norm_cdf(d1) - spot * df * norm_cdf(d2)
-         + spot * vol_sq_over_2r * (norm_cdf(-d1) - df * exp(2.0 * mu / vol / vol * log(1.0)) * norm_cdf(-d2));
+    double lambda = 2.0 * rate / (vol * vol);
+    return min_term + (expm1(rate * time) - expm1(-lambda * log_sx)) / lambda;
 }
 
 /*
- * Floating strike lookback put: E[max(S) - S(T)]
+ * Floating strike lookback call: E[S(T) - min(S)]
+ *
+ * Goldman, Sosin, Gatto (1979), running minimum = S at inception:
+ *   C = S·N(a₁) - S·e^(-rT)·N(a₂) + S·e^(-rT)·(min term at X = S)
+ *   a₁ = (r + ½σ²)√T/σ,  a₂ = a₁ - σ√T
  */
-double mco_lookback_floating_put(double spot, double rate, double vol, double time)
+double mco_lookback_floating_call(double spot, double rate, double vol, double time)
 {
     if (spot <= 0.0 || time <= 0.0 || vol <= 0.0) {
         return 0.0;
     }
 
-    double sqrt_t = sqrt(time);
-    double vol_sqrt_t = vol * sqrt_t;
+    double vol_sqrt_t = vol * sqrt(time);
+    double a1 = (rate + 0.5 * vol * vol) * time / vol_sqrt_t;
+    double a2 = a1 - vol_sqrt_t;
     double df = exp(-rate * time);
 
-    double a1 = (rate / vol + 0.5 * vol) * sqrt_t;
-    double a2 = a1 - vol_sqrt_t;
+    return spot * norm_cdf(a1) - spot * df * norm_cdf(a2)
+         + spot * df * lookback_min_term(0.0, a1, rate, vol, time);
+}
 
-    if (fabs(rate) < 1e-10) {
-        return spot * (norm_cdf(a1) - norm_cdf(-a1)) + spot * vol * sqrt_t * 0.7978845608;
+/*
+ * Floating strike lookback put: E[max(S) - S(T)]
+ *
+ *   P = S·e^(-rT)·N(-a₂) - S·N(-a₁) + S·e^(-rT)·(max term at X = S)
+ */
+double mco_lookback_floating_put(double spot, double rate, double vol, double time)
+{
+    if (spot <= 0.0 || time <= 0.0 || vol <= 0.0) {
+        return 0.0;
     }
 
-    double vol_sq_over_2r = vol * vol / (2.0 * rate);
-
-    /* Use symmetry: put payoff is symmetric to call with sign changes */
-    double term1 = -spot * norm_cdf(-a1);
-    double term2 = spot * vol_sq_over_2r * norm_cdf(a1);
-    double term3 = spot * df * norm_cdf(-a2);
-    double term4 = -spot * df * vol_sq_over_2r * norm_cdf(a2);
+    double vol_sqrt_t = vol * sqrt(time);
+    double a1 = (rate + 0.5 * vol * vol) * time / vol_sqrt_t;
+    double a2 = a1 - vol_sqrt_t;
+    double df = exp(-rate * time);
 
-    return -(term1 + term2 + term3 + term4);
+    return spot * df * norm_cdf(-a2) - spot * norm_cdf(-a1)
+         + spot * df * lookback_max_term(0.0, a1, rate, vol, time);
 }
 
 /*
  * Fixed strike lookback call: E[max(max(S) - K, 0)]
+ *
+ * Conze & Viswanathan (1991), running maximum = S at inception:
+ *   K > S:  C = S·N(d₁) - K·e^(-rT)·N(d₂) + S·e^(-rT)·(max term at X = K)
+ *   K ≤ S:  C = e^(-rT)·(S - K) + floating put
  */
 double mco_lookback_fixed_call(double spot, double strike, double rate, double vol, double time)
 {
@@ -175,27 +306,26 @@ double mco_lookback_fixed_call(double spot, double strike, double rate, double v
         return fmax(spot - strike, 0.0);
     }
 
-    /* For S₀ ≥ K, this is approximately the floating call + adjustment */
-    /* For S₀ < K, more complex formula needed */
-
-    double sqrt_t = sqrt(time);
-    double vol_sqrt_t = vol * sqrt_t;
     double df = exp(-rate * time);
 
-    double d1 = (log(spot / strike) + (rate + 0.5 * vol * vol) * time) / vol_sqrt_t;
-    double d2 = d1 - vol_sqrt_t;
-
-    /* Vanilla call component */
-    double vanilla = spot * norm_cdf(d1) - strike * df * norm_cdf(d2);
+    if (strike <= spot) {
+        return df * (spot - strike) + mco_lookback_floating_put(spot, rate, vol, time);
+    }
 
-    /* Lookback premium: value of seeing the maximum */
-    double premium = mco_lookback_floating_call(spot, rate, vol, time) - spot + spot * df;
+    double vol_sqrt_t = vol * sqrt(time);
+    double log_sk = log(spot / strike);
+    double d1 = (log_sk + (rate + 0.5 * vol * vol) * time) / vol_sqrt_t;
+    double d2 = d1 - vol_sqrt_t;
 
-    return vanilla + fmax(premium, 0.0);
+    return spot * norm_cdf(d1) - strike * df * norm_cdf(d2)
+         + spot * df * lookback_max_term(log_sk, d1, rate, vol, time);
 }
 
 /*
  * Fixed strike lookback put: E[max(K - min(S), 0)]
+ *
+ *   K < S:  P = K·e^(-rT)·N(-d₂) - S·N(-d₁) + S·e^(-rT)·(min term at X = K)
+ *   K ≥ S:  P = e^(-rT)·(K - S) + floating call
  */
 double mco_lookback_fixed_put(double spot, double strike, double rate, double vol, double time)
 {
@@ -203,20 +333,19 @@ double mco_lookback_fixed_put(double spot, double strike, double rate, double vo
         return fmax(strike - spot, 0.0);
     }
 
-    double sqrt_t = sqrt(time);
-    double vol_sqrt_t = vol * sqrt_t;
     double df = exp(-rate * time);
 
-    double d1 = (log(spot / strike) + (rate + 0.5 * vol * vol) * time) / vol_sqrt_t;
-    double d2 = d1 - vol_sqrt_t;
-
-    /* Vanilla put component */
-    double vanilla = strike * df * norm_cdf(-d2) - spot * norm_cdf(-d1);
+    if (strike >= spot) {
+        return df * (strike - spot) + mco_lookback_floating_call(spot, rate, vol, time);
+    }
 
-    /* Lookback premium */
-    double premium = mco_lookback_floating_put(spot, rate, vol, time) - spot * df + spot;
+    double vol_sqrt_t = vol * sqrt(time);
+    double log_sk = log(spot / strike);
+    double d1 = (log_sk + (rate + 0.5 * vol * vol) * time) / vol_sqrt_t;
+    double d2 = d1 - vol_sqrt_t;
 
-    return vanilla + fmax(premium, 0.0);
+    return strike * df * norm_cdf(-d2) - spot * norm_cdf(-d1)
+         + spot * df * lookback_min_term(log_sk, d1, rate, vol, time);
 }
 
 /*============================================================================
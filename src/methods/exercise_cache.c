@@ -0,0 +1,408 @@
+/*
+ * Exercise Policy Cache Implementation
+ */
+
+#include "internal/methods/exercise_cache.h"
+#include "internal/variance_reduction/importance.h"
+#include "internal/allocator.h"
+#include "internal/rng.h"
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+/* Schedules match when every date fraction agrees to this tolerance */
+#define SCHEDULE_MATCH_TOL 1e-12
+
+/* Boundary search: coarse scan, then bisection */
+#define BOUNDARY_SCAN_POINTS 256
+#define BOUNDARY_BISECT_ITERS 60
+#define BOUNDARY_CALL_RANGE 8.0   /* Scan S/K up to 1 + 8σ√T for calls */
+
+typedef struct {
+    mco_exercise_key key;        /* key.times points at fractions */
+    double *fractions;           /* tᵢ / T (owned) */
+    mco_exercise_policy policy;
+    uint64_t last_used;
+} cache_entry;
+
+struct mco_exercise_cache {
+    pthread_mutex_t lock;
+    cache_entry *entries;
+    size_t capacity;
+    size_t count;
+    uint64_t clock;              /* LRU timestamp */
+    uint64_t hits;
+    uint64_t misses;
+};
+
+/*============================================================================
+ * Policy
+ *============================================================================*/
+
+static void policy_copy(mco_exercise_policy *dst, const mco_exercise_policy *src)
+{
+    dst->basis = src->basis;
+    memcpy(dst->coeffs, src->coeffs, src->num_dates * MCO_LSM_MAX_BASIS * sizeof(double));
+    memcpy(dst->fitted, src->fitted, src->num_dates);
+}
+
+/*============================================================================
+ * Keys
+ *============================================================================*/
+
+static int64_t bucket(double value, double width)
+{
+    return (int64_t)floor(value / width);
+}
+
+void mco_exercise_key_init(mco_exercise_key *key,
+                           const mco_gbm_schedule *sched,
+                           double strike,
+                           double volatility,
+                           mco_option_type type,
+                           const mco_lsm_basis *basis)
+{
+    key->type = (int)type;
+    key->basis_kind = basis->kind;
+    key->degree = basis->degree;
+    key->payoff = basis->payoff;
+    key->moneyness = bucket(log(sched->spot / strike), MCO_EXERCISE_BUCKET_MONEYNESS);
+    key->maturity = bucket(sched->maturity, MCO_EXERCISE_BUCKET_MATURITY);
+    key->volatility = bucket(volatility, MCO_EXERCISE_BUCKET_VOL);
+    key->rate = bucket(sched->rate, MCO_EXERCISE_BUCKET_RATE);
+    key->num_dates = sched->num_dates;
+    key->times = sched->times;
+    key->maturity_time = sched->maturity;
+}
+
+static double key_fraction(const mco_exercise_key *key, size_t i)
+{
+    return (key->maturity_time > 0.0) ? key->times[i] / key->maturity_time : 0.0;
+}
+
+static int key_equal(const mco_exercise_key *a, const mco_exercise_key *b)
+{
+    if (a->type != b->type || a->basis_kind != b->basis_kind ||
+        a->degree != b->degree || a->payoff != b->payoff ||
+        a->moneyness != b->moneyness || a->maturity != b->maturity ||
+        a->volatility != b->volatility || a->rate != b->rate ||
+        a->num_dates != b->num_dates) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < a->num_dates; ++i) {
+        if (fabs(key_fraction(a, i) - key_fraction(b, i)) > SCHEDULE_MATCH_TOL) return 0;
+    }
+
+    return 1;
+}
+
+static cache_entry *cache_find(mco_exercise_cache *cache, const mco_exercise_key *key)
+{
+    for (size_t i = 0; i < cache->count; ++i) {
+        if (key_equal(&cache->entries[i].key, key)) return &cache->entries[i];
+    }
+    return NULL;
+}
+
+/*============================================================================
+ * Cache
+ *============================================================================*/
+
+mco_exercise_cache *mco_exercise_cache_new(size_t capacity)
+{
+    if (capacity == 0) return NULL;
+
+    mco_exercise_cache *cache = (mco_exercise_cache *)mco_calloc(1, sizeof(mco_exercise_cache));
+    if (!cache) return NULL;
+
+    cache->entries = (cache_entry *)mco_calloc(capacity, sizeof(cache_entry));
+    if (!cache->entries || pthread_mutex_init(&cache->lock, NULL) != 0) {
+        mco_free(cache->entries);
+        mco_free(cache);
+        return NULL;
+    }
+    cache->capacity = capacity;
+
+    return cache;
+}
+
+static void entry_release(cache_entry *entry)
+{
+    mco_free(entry->fractions);
+    entry->fractions = NULL;
+    mco_exercise_policy_free(&entry->policy);
+}
+
+void mco_exercise_cache_clear(mco_exercise_cache *cache)
+{
+    if (!cache) return;
+
+    pthread_mutex_lock(&cache->lock);
+    for (size_t i = 0; i < cache->count; ++i) {
+        entry_release(&cache->entries[i]);
+    }
+    cache->count = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void mco_exercise_cache_free(mco_exercise_cache *cache)
+{
+    if (!cache) return;
+
+    mco_exercise_cache_clear(cache);
+    pthread_mutex_destroy(&cache->lock);
+    mco_free(cache->entries);
+    mco_free(cache);
+}
+
+size_t mco_exercise_cache_size(mco_exercise_cache *cache)
+{
+    if (!cache) return 0;
+
+    pthread_mutex_lock(&cache->lock);
+    size_t count = cache->count;
+    pthread_mutex_unlock(&cache->lock);
+
+    return count;
+}
+
+uint64_t mco_exercise_cache_hits(mco_exercise_cache *cache)
+{
+    if (!cache) return 0;
+
+    pthread_mutex_lock(&cache->lock);
+    uint64_t hits = cache->hits;
+    pthread_mutex_unlock(&cache->lock);
+
+    return hits;
+}
+
+uint64_t mco_exercise_cache_misses(mco_exercise_cache *cache)
+{
+    if (!cache) return 0;
+
+    pthread_mutex_lock(&cache->lock);
+    uint64_t misses = cache->misses;
+    pthread_mutex_unlock(&cache->lock);
+
+    return misses;
+}
+
+int mco_exercise_cache_get(mco_exercise_cache *cache,
+                           const mco_exercise_key *key,
+                           mco_exercise_policy *policy)
+{
+    pthread_mutex_lock(&cache->lock);
+
+    cache_entry *entry = cache_find(cache, key);
+    if (entry) {
+        policy_copy(policy, &entry->policy);
+        entry->last_used = ++cache->clock;
+        cache->hits++;
+    } else {
+        cache->misses++;
+    }
+
+    pthread_mutex_unlock(&cache->lock);
+
+    return entry ? 1 : 0;
+}
+
+void mco_exercise_cache_put(mco_exercise_cache *cache,
+                            const mco_exercise_key *key,
+                            const mco_exercise_policy *policy)
+{
+    /* Build the entry outside the lock */
+    cache_entry fresh;
+    fresh.fractions = (double *)mco_malloc(key->num_dates * sizeof(double));
+    if (!fresh.fractions) return;
+    if (mco_exercise_policy_init(&fresh.policy, &policy->basis, policy->num_dates) != 0) {
+        mco_free(fresh.fractions);
+        return;
+    }
+
+    for (size_t i = 0; i < key->num_dates; ++i) {
+        fresh.fractions[i] = key_fraction(key, i);
+    }
+    policy_copy(&fresh.policy, policy);
+    fresh.key = *key;
+    fresh.key.times = fresh.fractions;
+    fresh.key.maturity_time = 1.0;
+
+    pthread_mutex_lock(&cache->lock);
+
+    cache_entry *slot = cache_find(cache, key);
+    if (!slot && cache->count < cache->capacity) {
+        slot = &cache->entries[cache->count++];
+    } else if (!slot) {
+        slot = &cache->entries[0];
+        for (size_t i = 1; i < cache->count; ++i) {
+            if (cache->entries[i].last_used < slot->last_used) slot = &cache->entries[i];
+        }
+    }
+
+    cache_entry old = *slot;
+    fresh.last_used = ++cache->clock;
+    *slot = fresh;
+
+    pthread_mutex_unlock(&cache->lock);
+
+    /* Slot was either empty (zeroed) or replaced */
+    entry_release(&old);
+}
+
+void mco_set_exercise_cache(mco_ctx *ctx, mco_exercise_cache *cache)
+{
+    if (ctx) {
+        ctx->exercise_cache = cache;
+    }
+}
+
+/*============================================================================
+ * Forward Repricing
+ *============================================================================*/
+
+double mco_exercise_forward_price(mco_ctx *ctx,
+                                  const mco_gbm_schedule *sched,
+                                  const mco_exercise_policy *policy,
+                                  double strike,
+                                  mco_option_type type,
+                                  const mco_path_controls *pc,
+                                  mco_mcv_stats *cv_stats)
+{
+    uint64_t n_paths = ctx->num_simulations;
+    size_t last = sched->num_dates - 1;
+    double log_strike = log(strike);
+    int is_put = (type == MCO_PUT);
+    int controlled = pc && pc->k > 0;
+
+    mco_lsm_basis basis = policy->basis;
+    basis.inv_strike = 1.0 / strike;
+
+    double phi[MCO_LSM_MAX_BASIS];
+    mco_is_stats stats;
+    mco_is_init(&stats);
+    mco_rng rng = ctx->rng;
+
+    for (uint64_t p = 0; p < n_paths; ++p) {
+        double x = sched->log_spot;
+        double value = 0.0;
+        int alive = 1;
+
+        for (size_t i = 0; i <= last; ++i) {
+            x = mco_gbm_schedule_log_step(sched, i, x, mco_rng_normal(&rng));
+
+            /* Exercised: walk on to S(T) for the controls only */
+            if (!alive) continue;
+
+            if (i == last) {
+                value = mco_payoff(exp(x), strike, type) * sched->discount;
+                break;
+            }
+
+            /* Out of the money or no regression: hold */
+            int itm = is_put ? (x < log_strike) : (x > log_strike);
+            if (!itm || !policy->fitted[i]) continue;
+
+            double s_t = exp(x);
+            double exercise_value = mco_payoff(s_t, strike, type);
+            const double *coeffs = policy->coeffs + i * MCO_LSM_MAX_BASIS;
+
+            mco_lsm_basis_eval(&basis, s_t, exercise_value, phi);
+            double continuation = strike * mco_lsm_continuation(coeffs, phi, basis.num_basis);
+
+            if (exercise_value > continuation) {
+                value = exercise_value * exp(-sched->rate * sched->times[i]);
+                if (!controlled) break;
+                alive = 0;
+            }
+        }
+
+        if (controlled) {
+            mco_path_state st;
+            double z[MCO_MCV_MAX];
+            mco_path_state_init(&st, exp(x), 0u);
+            mco_path_controls_eval(pc, &st, 0.0, z);
+            mco_mcv_add(cv_stats, value, z);
+        } else {
+            mco_is_add(&stats, value);
+        }
+    }
+
+    if (controlled) {
+        ctx->last_std_error = mco_mcv_std_error(cv_stats);
+        return mco_mcv_estimate(cv_stats);
+    }
+
+    ctx->last_std_error = mco_is_std_error(&stats);
+    return mco_is_mean(&stats);
+}
+
+/*============================================================================
+ * Exercise Boundary
+ *============================================================================*/
+
+/* Exercise value minus continuation at moneyness x = S/K, per unit strike */
+static double exercise_margin(const mco_lsm_basis *basis,
+                              const double *coeffs,
+                              double x,
+                              mco_option_type type)
+{
+    double phi[MCO_LSM_MAX_BASIS];
+    double exercise_value = mco_payoff(x, 1.0, type);
+
+    mco_lsm_basis_eval(basis, x, exercise_value, phi);
+    return exercise_value - mco_lsm_continuation(coeffs, phi, basis->num_basis);
+}
+
+void mco_exercise_policy_boundary(const mco_exercise_policy *policy,
+                                  double strike,
+                                  mco_option_type type,
+                                  double *boundary)
+{
+    int is_put = (type == MCO_PUT);
+    double no_exercise = is_put ? 0.0 : HUGE_VAL;
+    size_t last = policy->num_dates - 1;
+
+    /* Policy coefficients are per unit strike: work at K = 1 */
+    mco_lsm_basis basis = policy->basis;
+    basis.inv_strike = 1.0;
+
+    /* In-the-money moneyness range, from the money outwards */
+    double scale = 1.0 / basis.inv_scale;
+    double far = is_put ? 0.0 : 1.0 + BOUNDARY_CALL_RANGE * scale;
+
+    for (size_t i = 0; i < last; ++i) {
+        boundary[i] = no_exercise;
+        if (!policy->fitted[i]) continue;
+
+        const double *coeffs = policy->coeffs + i * MCO_LSM_MAX_BASIS;
+
+        /* First exercise point walking away from the money */
+        double hold = 1.0;
+        double step = (far - 1.0) / BOUNDARY_SCAN_POINTS;
+        for (int k = 1; k <= BOUNDARY_SCAN_POINTS; ++k) {
+            double x = 1.0 + step * (double)k;
+            if (exercise_margin(&basis, coeffs, x, type) > 0.0) {
+                /* Boundary lies in (hold, x] */
+                double ex = x;
+                for (int it = 0; it < BOUNDARY_BISECT_ITERS; ++it) {
+                    double mid = 0.5 * (hold + ex);
+                    if (exercise_margin(&basis, coeffs, mid, type) > 0.0) {
+                        ex = mid;
+                    } else {
+                        hold = mid;
+                    }
+                }
+                boundary[i] = strike * 0.5 * (hold + ex);
+                break;
+            }
+            hold = x;
+        }
+    }
+
+    boundary[last] = strike;
+}
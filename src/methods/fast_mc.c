@@ -0,0 +1,110 @@
+/*
+ * Single-Precision Screening Mode Implementation
+ *
+ * The lane kernel lives with the other vector kernels; this file seeds
+ * the lanes, runs the kernel on each thread's slice and merges the
+ * thread sums.
+ */
+
+#include "internal/methods/fast_mc.h"
+#include "internal/methods/kernels.h"
+#include "internal/methods/thread_pool.h"
+#include "internal/allocator.h"
+#include <math.h>
+#include <string.h>
+
+/*============================================================================
+ * Setup
+ *============================================================================*/
+
+void mco_fast_rng_init(mco_fast_rng *lanes, mco_rng *rng)
+{
+    for (int l = 0; l < MCO_FAST_LANES; ++l) {
+        mco_rng lane;
+        mco_rng_seed(&lane, mco_rng_next(rng));
+        for (int k = 0; k < 4; ++k) {
+            lanes->s[k][l] = lane.s[k];
+        }
+    }
+}
+
+void mco_fast_spec_init(mco_fast_spec *spec, double spot, double rate,
+                        double volatility, double time, size_t num_steps,
+                        mco_fast_walk walk)
+{
+    memset(spec, 0, sizeof *spec);
+
+    double dt = time / (double)num_steps;
+    spec->spot = spot;
+    spec->drift_dt = (rate - 0.5 * volatility * volatility) * dt;
+    spec->diffusion_dt = volatility * sqrt(dt);
+    spec->discount = exp(-rate * time);
+    spec->num_steps = num_steps;
+    spec->walk = walk;
+    spec->phi = 1.0;
+}
+
+/*============================================================================
+ * Pricing
+ *============================================================================*/
+
+typedef struct {
+    const mco_fast_spec *spec;
+    mco_fast_paths_fn paths;
+    mco_fast_sums *sums;        /* One slot per thread */
+} fast_job;
+
+static void fast_worker(void *arg, uint32_t thread_id, mco_rng *rng,
+                        uint64_t start, uint64_t end)
+{
+    const fast_job *job = (const fast_job *)arg;
+    mco_fast_rng lanes;
+    mco_fast_rng_init(&lanes, rng);
+    job->paths(job->spec, &lanes, end - start, &job->sums[thread_id]);
+}
+
+double mco_fast_price(mco_ctx *ctx, const mco_fast_spec *spec, double *std_error)
+{
+    uint64_t n = ctx->num_simulations;
+    uint32_t num_threads = ctx->num_threads ? ctx->num_threads : 1;
+
+    mco_fast_sums *sums = (mco_fast_sums *)mco_malloc(num_threads * sizeof(mco_fast_sums));
+    if (!sums) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mco_sum_init(&sums[t].sum);
+        mco_sum_init(&sums[t].sq);
+    }
+
+    fast_job job = {
+        .spec  = spec,
+        .paths = mco_kernels_get((mco_cpu_level)ctx->cpu_level)->fast_paths,
+        .sums  = sums
+    };
+    uint32_t used = mco_parallel_for(ctx, n, fast_worker, &job);
+
+    /* Thread sums, merged in thread order */
+    mco_fast_sums total;
+    mco_sum_init(&total.sum);
+    mco_sum_init(&total.sq);
+    for (uint32_t t = 0; t < used; ++t) {
+        mco_sum_merge(&total.sum, &sums[t].sum);
+        mco_sum_merge(&total.sq, &sums[t].sq);
+    }
+    double sum = mco_sum_value(&total.sum);
+    double sum_sq = mco_sum_value(&total.sq);
+
+    mco_free(sums);
+
+    if (used == 0 || n == 0) return 0.0;
+
+    double mean = sum / (double)n;
+    if (std_error) {
+        double var = (n > 1) ? (sum_sq - mean * sum) / (double)(n - 1) : 0.0;
+        *std_error = spec->discount * sqrt(fmax(var, 0.0) / (double)n);
+    }
+
+    return spec->discount * mean;
+}
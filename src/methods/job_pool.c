@@ -0,0 +1,380 @@
+/*
+ * Persistent Job Pool Implementation
+ */
+
+#include "internal/methods/job_pool.h"
+#include "internal/allocator.h"
+#include "mcoptions.h"
+#include <pthread.h>
+
+/*============================================================================
+ * Jobs
+ *============================================================================*/
+
+typedef enum {
+    JOB_QUEUED = 0,
+    JOB_RUNNING,
+    JOB_DONE,                   /* Result set, callback running */
+    JOB_FINISHED
+} job_state;
+
+struct mco_job {
+    mco_job_desc desc;
+    mco_ctx ctx;                /* Snapshot: one thread, no pool */
+
+    /* Result */
+    double price;
+    double std_error;
+    mco_error error;
+
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    job_state state;
+    int free_requested;         /* Freed by its own callback */
+    pthread_t worker;           /* Set when running */
+
+    mco_job *next;              /* Queue link */
+};
+
+struct mco_job_pool {
+    pthread_mutex_t lock;
+    pthread_cond_t ready;       /* Queue non-empty, or stopping */
+    mco_job *head;
+    mco_job *tail;
+    int stopping;
+
+    pthread_t *workers;
+    uint32_t num_workers;
+};
+
+static void job_destroy(mco_job *job)
+{
+    pthread_cond_destroy(&job->changed);
+    pthread_mutex_destroy(&job->lock);
+    mco_free(job);
+}
+
+/*
+ * Synchronous price of the job's contract on its context snapshot
+ */
+static double job_price(mco_job *job)
+{
+    const mco_job_desc *d = &job->desc;
+    mco_ctx *ctx = &job->ctx;
+    int call = d->type == MCO_CALL;
+
+    switch (d->kind) {
+        case MCO_JOB_EUROPEAN:
+            return call
+                ? mco_european_call(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                    d->time_to_maturity)
+                : mco_european_put(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                   d->time_to_maturity);
+        case MCO_JOB_AMERICAN:
+            return call
+                ? mco_american_call(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                    d->time_to_maturity, d->num_steps)
+                : mco_american_put(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                   d->time_to_maturity, d->num_steps);
+        case MCO_JOB_BERMUDAN:
+            return call
+                ? mco_bermudan_call(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                    d->time_to_maturity, d->num_steps)
+                : mco_bermudan_put(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                   d->time_to_maturity, d->num_steps);
+        case MCO_JOB_ASIAN:
+            return call
+                ? mco_asian_call(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                 d->time_to_maturity, d->num_steps)
+                : mco_asian_put(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                d->time_to_maturity, d->num_steps);
+        case MCO_JOB_ASIAN_GEOMETRIC:
+            return call
+                ? mco_asian_geometric_call(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                           d->time_to_maturity, d->num_steps)
+                : mco_asian_geometric_put(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                          d->time_to_maturity, d->num_steps);
+        case MCO_JOB_BARRIER:
+            return call
+                ? mco_barrier_call(ctx, d->spot, d->strike, d->barrier, d->rebate, d->rate,
+                                   d->volatility, d->time_to_maturity, d->num_steps,
+                                   d->barrier_style)
+                : mco_barrier_put(ctx, d->spot, d->strike, d->barrier, d->rebate, d->rate,
+                                  d->volatility, d->time_to_maturity, d->num_steps,
+                                  d->barrier_style);
+        case MCO_JOB_LOOKBACK:
+            return call
+                ? mco_lookback_call(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                    d->time_to_maturity, d->num_steps, d->floating_strike)
+                : mco_lookback_put(ctx, d->spot, d->strike, d->rate, d->volatility,
+                                   d->time_to_maturity, d->num_steps, d->floating_strike);
+        case MCO_JOB_DIGITAL:
+            return call
+                ? mco_digital_call(ctx, d->spot, d->strike, d->payout, d->rate,
+                                   d->volatility, d->time_to_maturity, d->cash_or_nothing)
+                : mco_digital_put(ctx, d->spot, d->strike, d->payout, d->rate,
+                                  d->volatility, d->time_to_maturity, d->cash_or_nothing);
+        default:
+            ctx->last_error = MCO_ERR_INVALID_ARG;
+            return 0.0;
+    }
+}
+
+static void job_run(mco_job *job)
+{
+    pthread_mutex_lock(&job->lock);
+    job->state = JOB_RUNNING;
+    job->worker = pthread_self();
+    pthread_mutex_unlock(&job->lock);
+
+    double price = job_price(job);
+
+    mco_job_callback callback = job->desc.callback;
+
+    pthread_mutex_lock(&job->lock);
+    job->price = price;
+    job->std_error = job->ctx.last_std_error;
+    job->error = job->ctx.last_error;
+    job->state = callback ? JOB_DONE : JOB_FINISHED;
+    pthread_cond_broadcast(&job->changed);
+    pthread_mutex_unlock(&job->lock);
+
+    if (!callback) return;
+
+    callback(job, job->desc.user_data);
+
+    pthread_mutex_lock(&job->lock);
+    if (job->free_requested) {
+        pthread_mutex_unlock(&job->lock);
+        job_destroy(job);
+        return;
+    }
+    job->state = JOB_FINISHED;
+    pthread_cond_broadcast(&job->changed);
+    pthread_mutex_unlock(&job->lock);
+}
+
+/*
+ * Block until the job reaches at least the given state
+ */
+static void job_wait_state(mco_job *job, job_state state)
+{
+    pthread_mutex_lock(&job->lock);
+    while (job->state < state) {
+        pthread_cond_wait(&job->changed, &job->lock);
+    }
+    pthread_mutex_unlock(&job->lock);
+}
+
+/*============================================================================
+ * Pool
+ *============================================================================*/
+
+static void *pool_worker(void *arg)
+{
+    mco_job_pool *pool = (mco_job_pool *)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->head && !pool->stopping) {
+            pthread_cond_wait(&pool->ready, &pool->lock);
+        }
+
+        /* Stopping with the queue drained */
+        mco_job *job = pool->head;
+        if (!job) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        pool->head = job->next;
+        if (!pool->head) pool->tail = NULL;
+        pthread_mutex_unlock(&pool->lock);
+
+        job_run(job);
+    }
+}
+
+static void pool_stop(mco_job_pool *pool, uint32_t started)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (uint32_t i = 0; i < started; ++i) {
+        pthread_join(pool->workers[i], NULL);
+    }
+}
+
+static mco_job_pool *pool_new(uint32_t num_workers, mco_error *error)
+{
+    *error = MCO_ERR_NOMEM;
+
+    mco_job_pool *pool = (mco_job_pool *)mco_calloc(1, sizeof(mco_job_pool));
+    if (!pool) return NULL;
+
+    pool->workers = (pthread_t *)mco_malloc(num_workers * sizeof(pthread_t));
+    if (!pool->workers) {
+        mco_free(pool);
+        return NULL;
+    }
+
+    *error = MCO_ERR_THREAD;
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        mco_free(pool->workers);
+        mco_free(pool);
+        return NULL;
+    }
+    if (pthread_cond_init(&pool->ready, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        mco_free(pool->workers);
+        mco_free(pool);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < num_workers; ++i) {
+        if (pthread_create(&pool->workers[i], NULL, pool_worker, pool) != 0) {
+            pool_stop(pool, i);
+            pthread_cond_destroy(&pool->ready);
+            pthread_mutex_destroy(&pool->lock);
+            mco_free(pool->workers);
+            mco_free(pool);
+            return NULL;
+        }
+    }
+    pool->num_workers = num_workers;
+
+    *error = MCO_OK;
+    return pool;
+}
+
+void mco_job_pool_free(mco_job_pool *pool)
+{
+    if (!pool) return;
+
+    pool_stop(pool, pool->num_workers);
+    pthread_cond_destroy(&pool->ready);
+    pthread_mutex_destroy(&pool->lock);
+    mco_free(pool->workers);
+    mco_free(pool);
+}
+
+/*============================================================================
+ * Public API
+ *============================================================================*/
+
+mco_job *mco_submit(mco_ctx *ctx, const mco_job_desc *desc)
+{
+    if (!ctx) return NULL;
+
+    int kind = desc ? (int)desc->kind : -1;
+    if (kind < (int)MCO_JOB_EUROPEAN || kind > (int)MCO_JOB_DIGITAL
+        || (desc->type != MCO_CALL && desc->type != MCO_PUT)) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return NULL;
+    }
+
+    if (!ctx->job_pool) {
+        mco_error error;
+        uint32_t num_workers = ctx->num_threads ? ctx->num_threads : 1;
+        ctx->job_pool = pool_new(num_workers, &error);
+        if (!ctx->job_pool) {
+            ctx->last_error = error;
+            return NULL;
+        }
+    }
+
+    mco_job *job = (mco_job *)mco_calloc(1, sizeof(mco_job));
+    if (!job) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return NULL;
+    }
+    if (pthread_mutex_init(&job->lock, NULL) != 0) {
+        mco_free(job);
+        ctx->last_error = MCO_ERR_THREAD;
+        return NULL;
+    }
+    if (pthread_cond_init(&job->changed, NULL) != 0) {
+        pthread_mutex_destroy(&job->lock);
+        mco_free(job);
+        ctx->last_error = MCO_ERR_THREAD;
+        return NULL;
+    }
+
+    job->desc = *desc;
+    job->ctx = *ctx;
+    job->ctx.num_threads = 1;
+    job->ctx.job_pool = NULL;
+    job->ctx.last_error = MCO_OK;
+    job->ctx.last_std_error = 0.0;
+    job->state = JOB_QUEUED;
+
+    mco_job_pool *pool = ctx->job_pool;
+    pthread_mutex_lock(&pool->lock);
+    if (pool->tail) {
+        pool->tail->next = job;
+    } else {
+        pool->head = job;
+    }
+    pool->tail = job;
+    pthread_cond_signal(&pool->ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    return job;
+}
+
+int mco_job_poll(mco_job *job)
+{
+    if (!job) return 0;
+
+    pthread_mutex_lock(&job->lock);
+    int done = job->state >= JOB_DONE;
+    pthread_mutex_unlock(&job->lock);
+
+    return done;
+}
+
+double mco_job_wait(mco_job *job)
+{
+    if (!job) return 0.0;
+
+    job_wait_state(job, JOB_DONE);
+    return job->price;
+}
+
+mco_error mco_job_error(mco_job *job)
+{
+    if (!job) return MCO_ERR_INVALID_ARG;
+
+    job_wait_state(job, JOB_DONE);
+    return job->error;
+}
+
+double mco_job_std_error(mco_job *job)
+{
+    if (!job) return 0.0;
+
+    job_wait_state(job, JOB_DONE);
+    return job->std_error;
+}
+
+void mco_job_free(mco_job *job)
+{
+    if (!job) return;
+
+    pthread_mutex_lock(&job->lock);
+
+    /* From the job's own callback: the worker frees it on return */
+    if (job->state == JOB_DONE && pthread_equal(job->worker, pthread_self())) {
+        job->free_requested = 1;
+        pthread_mutex_unlock(&job->lock);
+        return;
+    }
+
+    while (job->state < JOB_FINISHED) {
+        pthread_cond_wait(&job->changed, &job->lock);
+    }
+    pthread_mutex_unlock(&job->lock);
+
+    job_destroy(job);
+}
@@ -0,0 +1,517 @@
+/*
+ * Vector Kernels Implementation
+ *
+ * Compiled once per instruction-set level. The build passes the
+ * level's -m flags with -DMCO_KERNEL_LEVEL=<name> (sse42, avx2, avx512)
+ * and -DMCO_KERNEL_CPU=<mco_cpu_level>; without them this is the
+ * generic table, which also holds the selector.
+ */
+
+#include "internal/methods/kernels.h"
+#include "internal/instruments/barrier_analytic.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef MCO_KERNEL_LEVEL
+#define MCO_KERNEL_LEVEL generic
+#define MCO_KERNEL_CPU MCO_CPU_GENERIC
+#define MCO_KERNEL_GENERIC 1
+#endif
+
+#define KERNEL_CAT_(a, b) a##_##b
+#define KERNEL_CAT(a, b) KERNEL_CAT_(a, b)
+#define KERNEL_TABLE KERNEL_CAT(mco_kernels, MCO_KERNEL_LEVEL)
+
+/*============================================================================
+ * Lattice Sweeps
+ *============================================================================*/
+
+static double binomial_sweep(size_t n,
+                             const unsigned char *flags,
+                             double strike,
+                             mco_option_type type,
+                             double inv_d,
+                             double pu,
+                             double pd,
+                             double *values,
+                             double *spots)
+{
+    double phi = (type == MCO_CALL) ? 1.0 : -1.0;
+
+    for (size_t i = n; i-- > 0; ) {
+        if (flags[i]) {
+            for (size_t j = 0; j <= i; ++j) {
+                spots[j] *= inv_d;
+                double cont = pu * values[j + 1] + pd * values[j];
+                double exercise = phi * (spots[j] - strike);
+                values[j] = (exercise > cont) ? exercise : cont;
+            }
+        } else {
+            for (size_t j = 0; j <= i; ++j) {
+                spots[j] *= inv_d;
+                values[j] = pu * values[j + 1] + pd * values[j];
+            }
+        }
+    }
+
+    return values[0];
+}
+
+static void trinomial_sweep(size_t n,
+                            const unsigned char *flags,
+                            const double *spots,
+                            double strike,
+                            mco_option_type type,
+                            double wd,
+                            double wm,
+                            double wu,
+                            double *values)
+{
+    double phi = (type == MCO_CALL) ? 1.0 : -1.0;
+    double signed_strike = phi * strike;
+
+    for (size_t i = n; i-- > 0; ) {
+        const double *level_spots = spots + (n - i);
+        if (flags[i]) {
+            for (size_t j = 0; j <= 2 * i; ++j) {
+                double cont = wd * values[j] + wm * values[j + 1] + wu * values[j + 2];
+                double exercise = phi * level_spots[j] - signed_strike;
+                values[j] = (exercise > cont) ? exercise : cont;
+            }
+        } else {
+            for (size_t j = 0; j <= 2 * i; ++j) {
+                values[j] = wd * values[j] + wm * values[j + 1] + wu * values[j + 2];
+            }
+        }
+    }
+}
+
+/*============================================================================
+ * Crank-Nicolson Block Step
+ *============================================================================*/
+
+/*
+ * Right-hand side of row i, (I + explicit·½Δτ·L)·V
+ */
+static inline double step_rhs(const mco_pde_block *blk, size_t e, size_t B, double explicit)
+{
+    const double *v = blk->values;
+    return v[e] + explicit * (blk->ha[e] * v[e - B] + blk->hb[e] * v[e] + blk->hc[e] * v[e + B]);
+}
+
+/*
+ * With project set, the substitution takes V = max(V, payoff) node by
+ * node as it goes (Brennan-Schwartz). Starting from the exercise side -
+ * S = 0 for a put, the top for a call - each node is floored before the
+ * next one is solved from it, which is the exact solution of the
+ * discrete obstacle problem when the exercise region is one interval
+ * at that edge, rather than the O(Δτ) splitting of projecting after
+ * the step.
+ *
+ * Called with constant widths, so each is compiled with fixed-length
+ * inner loops.
+ */
+static inline void block_step(mco_pde_block *blk, size_t n, size_t B, int downward,
+                              double explicit, int project, const double *lower_bv,
+                              const int *lower_fixed, const double *upper_bv)
+{
+    double *v = blk->values;
+    double *d = blk->work;
+    const double *ex = blk->exercise;
+
+    if (downward) {
+        /* Eliminate from the Dirichlet top row down */
+        for (size_t j = 0; j < B; ++j) d[(n - 1) * B + j] = upper_bv[j];
+        for (size_t i = n - 1; i-- > 1; ) {
+            const double *hc = blk->hc + i * B;
+            const double *w = blk->w + i * B;
+            const double *dp = d + (i + 1) * B;
+            double *d0 = d + i * B;
+            for (size_t j = 0; j < B; ++j) {
+                d0[j] = (step_rhs(blk, i * B + j, B, explicit) + hc[j] * dp[j]) * w[j];
+            }
+        }
+        for (size_t j = 0; j < B; ++j) {
+            v[j] = lower_fixed[j] ? lower_bv[j]
+                                  : (v[j] + explicit * blk->hb[j] * v[j]) * blk->w[j];
+            if (project && ex[j] > v[j]) v[j] = ex[j];
+        }
+
+        /* Substitute upwards */
+        for (size_t i = 1; i < n; ++i) {
+            const double *cp = blk->cp + i * B;
+            const double *d0 = d + i * B;
+            const double *vm = v + (i - 1) * B;
+            const double *e0 = ex + i * B;
+            double *v0 = v + i * B;
+            if (project) {
+                for (size_t j = 0; j < B; ++j) {
+                    double x = d0[j] - cp[j] * vm[j];
+                    v0[j] = (e0[j] > x) ? e0[j] : x;
+                }
+            } else {
+                for (size_t j = 0; j < B; ++j) v0[j] = d0[j] - cp[j] * vm[j];
+            }
+        }
+        return;
+    }
+
+    /* Eliminate from the bottom row up, forming the right-hand side on the fly */
+    for (size_t j = 0; j < B; ++j) {
+        d[j] = lower_fixed[j] ? lower_bv[j]
+                              : (v[j] + explicit * blk->hb[j] * v[j]) * blk->w[j];
+    }
+    for (size_t i = 1; i + 1 < n; ++i) {
+        const double *ha = blk->ha + i * B;
+        const double *w = blk->w + i * B;
+        const double *dm = d + (i - 1) * B;
+        double *d0 = d + i * B;
+        for (size_t j = 0; j < B; ++j) {
+            d0[j] = (step_rhs(blk, i * B + j, B, explicit) + ha[j] * dm[j]) * w[j];
+        }
+    }
+
+    /* Substitute downwards from the Dirichlet top row */
+    for (size_t j = 0; j < B; ++j) {
+        double x = upper_bv[j];
+        size_t e = (n - 1) * B + j;
+        v[e] = (project && ex[e] > x) ? ex[e] : x;
+    }
+    for (size_t i = n - 1; i-- > 0; ) {
+        const double *cp = blk->cp + i * B;
+        const double *d0 = d + i * B;
+        const double *vp = v + (i + 1) * B;
+        const double *e0 = ex + i * B;
+        double *v0 = v + i * B;
+        if (project) {
+            for (size_t j = 0; j < B; ++j) {
+                double x = d0[j] - cp[j] * vp[j];
+                v0[j] = (e0[j] > x) ? e0[j] : x;
+            }
+        } else {
+            for (size_t j = 0; j < B; ++j) v0[j] = d0[j] - cp[j] * vp[j];
+        }
+    }
+}
+
+static void pde_step(mco_pde_block *blk, size_t n, int downward, double explicit,
+                     int project, const double *lower_bv, const int *lower_fixed,
+                     const double *upper_bv)
+{
+    block_step(blk, n, MCO_PDE_BLOCK, downward, explicit, project,
+               lower_bv, lower_fixed, upper_bv);
+}
+
+static void pde_step_lane(mco_pde_block *blk, size_t n, int downward, double explicit,
+                          int project, const double *lower_bv, const int *lower_fixed,
+                          const double *upper_bv)
+{
+    block_step(blk, n, 1, downward, explicit, project, lower_bv, lower_fixed, upper_bv);
+}
+
+/*============================================================================
+ * Single-Precision Paths
+ *============================================================================*/
+
+#define L MCO_FAST_LANES
+
+/*
+ * Spec fields in float
+ */
+typedef struct {
+    float spot;
+    float drift_dt;
+    float diffusion_dt;
+    float inv_var;          /* 1/(σ²Δt) for the bridge */
+    float log_barrier;      /* log(H/S₀) */
+    float phi;
+    float strike;
+    float payout;
+    float rebate;
+    float inv_n;            /* 1/num_steps */
+    size_t num_steps;
+    int knock_in;
+} fast_consts;
+
+/*
+ * Lane state: x = log(S/S₀), a = sum, log sum or min, b = max,
+ * alive = 1 until the barrier is crossed
+ */
+typedef struct {
+    float x[L];
+    float a[L];
+    float b[L];
+    float alive[L];
+} fast_lanes;
+
+MCO_SPECIALISE void fast_walk(const fast_consts *c, mco_fast_rng *rng, fast_lanes *st,
+                              mco_fast_walk walk)
+{
+    int barrier = walk == MCO_FAST_WALK_BARRIER_DOWN || walk == MCO_FAST_WALK_BARRIER_UP;
+    int up = walk == MCO_FAST_WALK_BARRIER_UP;
+    uint64_t draw[L];
+    float prev[L];
+
+    for (int l = 0; l < L; ++l) {
+        st->x[l] = 0.0f;
+        st->a[l] = 0.0f;
+        st->b[l] = 0.0f;
+        st->alive[l] = 1.0f;
+    }
+
+    for (size_t i = 0; i < c->num_steps; ++i) {
+        mco_fast_rng_next(rng, draw);
+        for (int l = 0; l < L; ++l) {
+            float x = st->x[l];
+            prev[l] = x;
+            x = x + (c->drift_dt + c->diffusion_dt * mco_fast_normal(draw[l]));
+            st->x[l] = x;
+
+            if (walk == MCO_FAST_WALK_SUM) {
+                st->a[l] += mco_fast_expf(x);
+            } else if (walk == MCO_FAST_WALK_LOG_SUM) {
+                st->a[l] += x;
+            } else if (walk == MCO_FAST_WALK_EXTREMA) {
+                st->a[l] = (x < st->a[l]) ? x : st->a[l];
+                st->b[l] = (x > st->b[l]) ? x : st->b[l];
+            }
+        }
+
+        if (barrier) {
+            /* Bridge crossing: hit with probability exp(-2·d₁·d₂/(σ²Δt)) */
+            mco_fast_rng_next(rng, draw);
+            float any = 0.0f;
+            for (int l = 0; l < L; ++l) {
+                float d1 = up ? c->log_barrier - prev[l] : prev[l] - c->log_barrier;
+                float d2 = up ? c->log_barrier - st->x[l] : st->x[l] - c->log_barrier;
+                int inside = (d1 > 0.0f) & (d2 > 0.0f);
+                float p_bridge = mco_fast_expf(-2.0f * d1 * d2 * c->inv_var);
+                float p = inside ? p_bridge : 1.0f;
+                st->alive[l] = (mco_fast_uniform(draw[l]) < p) ? 0.0f : st->alive[l];
+                any += st->alive[l];
+            }
+
+            /* A knock-out block is decided once every lane is knocked */
+            if (!c->knock_in && !(any > 0.0f)) break;
+        }
+    }
+}
+
+/*
+ * Lane values of a payoff operand
+ */
+MCO_SPECIALISE void fast_operand(const fast_consts *c, const fast_lanes *st,
+                                 mco_fast_operand operand, mco_fast_walk walk, float *out)
+{
+    switch (operand) {
+        case MCO_FAST_SPOT:
+            for (int l = 0; l < L; ++l) out[l] = c->spot * mco_fast_expf(st->x[l]);
+            break;
+        case MCO_FAST_AVERAGE:
+            if (walk == MCO_FAST_WALK_SUM) {
+                for (int l = 0; l < L; ++l) out[l] = c->spot * (st->a[l] * c->inv_n);
+            } else {
+                for (int l = 0; l < L; ++l) out[l] = c->spot * mco_fast_expf(st->a[l] * c->inv_n);
+            }
+            break;
+        case MCO_FAST_MIN:
+            for (int l = 0; l < L; ++l) out[l] = c->spot * mco_fast_expf(st->a[l]);
+            break;
+        case MCO_FAST_MAX:
+            for (int l = 0; l < L; ++l) out[l] = c->spot * mco_fast_expf(st->b[l]);
+            break;
+        case MCO_FAST_STRIKE:
+        default:
+            for (int l = 0; l < L; ++l) out[l] = c->strike;
+            break;
+    }
+}
+
+MCO_SPECIALISE void fast_paths_walk(const mco_fast_spec *spec, mco_fast_rng *rng,
+                                    uint64_t n_paths, mco_fast_sums *sums,
+                                    mco_fast_walk walk)
+{
+    fast_consts c;
+    c.spot = (float)spec->spot;
+    c.drift_dt = (float)spec->drift_dt;
+    c.diffusion_dt = (float)spec->diffusion_dt;
+    c.inv_var = (float)(1.0 / (spec->diffusion_dt * spec->diffusion_dt));
+    c.log_barrier = (float)log(spec->barrier / spec->spot);
+    c.phi = (float)spec->phi;
+    c.strike = (float)spec->strike;
+    c.payout = (float)spec->payout;
+    c.rebate = (float)spec->rebate;
+    c.inv_n = (float)(1.0 / (double)spec->num_steps);
+    c.num_steps = spec->num_steps;
+    c.knock_in = spec->knock_in;
+
+    int barrier = walk == MCO_FAST_WALK_BARRIER_DOWN || walk == MCO_FAST_WALK_BARRIER_UP;
+    fast_lanes st;
+    float x[L], y[L];
+    double v[L], v_sq[L];
+
+    for (uint64_t done = 0; done < n_paths; done += L) {
+        uint64_t left = n_paths - done;
+        fast_walk(&c, rng, &st, walk);
+        fast_operand(&c, &st, spec->x, walk, x);
+        fast_operand(&c, &st, spec->y, walk, y);
+
+        for (int l = 0; l < L; ++l) {
+            float d = c.phi * (x[l] - y[l]);
+            float paid = (spec->pay == MCO_FAST_PAY_CASH) ? c.payout
+                       : (spec->pay == MCO_FAST_PAY_ASSET) ? x[l] : d;
+            float payoff = (d > 0.0f) ? paid : 0.0f;
+            if (barrier) {
+                payoff = c.knock_in ? payoff * (1.0f - st.alive[l])
+                                    : payoff * st.alive[l] + c.rebate * (1.0f - st.alive[l]);
+            }
+
+            /* Lanes past the end of the range add nothing */
+            v[l] = ((uint64_t)l < left) ? (double)payoff : 0.0;
+            v_sq[l] = v[l] * v[l];
+        }
+
+        mco_sum_add_n(&sums->sum, v, L);
+        mco_sum_add_n(&sums->sq, v_sq, L);
+    }
+}
+
+static void fast_paths(const mco_fast_spec *spec, mco_fast_rng *rng, uint64_t n_paths,
+                       mco_fast_sums *sums)
+{
+    switch (spec->walk) {
+        case MCO_FAST_WALK_TERMINAL:
+            fast_paths_walk(spec, rng, n_paths, sums, MCO_FAST_WALK_TERMINAL);
+            break;
+        case MCO_FAST_WALK_SUM:
+            fast_paths_walk(spec, rng, n_paths, sums, MCO_FAST_WALK_SUM);
+            break;
+        case MCO_FAST_WALK_LOG_SUM:
+            fast_paths_walk(spec, rng, n_paths, sums, MCO_FAST_WALK_LOG_SUM);
+            break;
+        case MCO_FAST_WALK_EXTREMA:
+            fast_paths_walk(spec, rng, n_paths, sums, MCO_FAST_WALK_EXTREMA);
+            break;
+        case MCO_FAST_WALK_BARRIER_DOWN:
+            fast_paths_walk(spec, rng, n_paths, sums, MCO_FAST_WALK_BARRIER_DOWN);
+            break;
+        case MCO_FAST_WALK_BARRIER_UP:
+            fast_paths_walk(spec, rng, n_paths, sums, MCO_FAST_WALK_BARRIER_UP);
+            break;
+        default:
+            break;
+    }
+}
+
+#undef L
+
+/*============================================================================
+ * Normals and Sobol Points
+ *============================================================================*/
+
+#define INV_NORMAL_BLOCK 64
+
+/*
+ * Every lane takes the central rational first - no branch and no libm
+ * call, so it vectorises - then the tail lanes (|x| >= 0.42, about 16%)
+ * are redone with the scalar log-log form.
+ */
+static void inv_normal(double *u, size_t n)
+{
+    double in[INV_NORMAL_BLOCK];
+
+    for (size_t done = 0; done < n; done += INV_NORMAL_BLOCK) {
+        size_t m = (n - done < INV_NORMAL_BLOCK) ? n - done : INV_NORMAL_BLOCK;
+        double *z = u + done;
+
+        memcpy(in, z, m * sizeof(double));
+        for (size_t i = 0; i < m; ++i) {
+            z[i] = mco_moro_central(in[i] - 0.5);
+        }
+        for (size_t i = 0; i < m; ++i) {
+            double x = in[i] - 0.5;
+            if (!(fabs(x) < MCO_MORO_CENTRAL)) z[i] = mco_moro_tail(in[i], x);
+        }
+    }
+}
+
+static void sobol_next(uint32_t dim, const uint32_t *v, int c, uint32_t *x, double *point)
+{
+    double scale = 1.0 / (double)(1ULL << MCO_SOBOL_BITS);
+
+    for (uint32_t d = 0; d < dim; ++d) {
+        x[d] ^= v[(size_t)d * MCO_SOBOL_BITS + (size_t)c];
+    }
+
+    /* Separate pass, through an exact signed convert, so it vectorises below AVX-512 */
+    for (uint32_t d = 0; d < dim; ++d) {
+        point[d] = ((double)(int32_t)(x[d] ^ 0x80000000u) + 2147483648.0) * scale;
+    }
+}
+
+/*============================================================================
+ * Analytic Barrier Batch
+ *============================================================================*/
+
+static void barrier_values(const double *spot, const double *strike, const double *barrier,
+                           const double *rebate, const double *rate, const double *volatility,
+                           const double *time, size_t n, size_t monitor_dates,
+                           mco_barrier_values *out)
+{
+    static const mco_barrier_values zero = { { 0.0 }, { 0.0 }, 0.0 };
+    double key[3] = { 0.0, 0.0, 0.0 };
+    mco_rr_market m = { 0.0, 0.0, 0.0, 1.0, 1.0, 0 };
+    int have = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!mco_barrier_analytic_valid(spot[i], strike[i], barrier[i], volatility[i],
+                                        time[i])) {
+            out[i] = zero;
+            continue;
+        }
+
+        /* Bitwise match: the market terms are reused only for identical inputs */
+        double next[3] = { rate[i], volatility[i], time[i] };
+        if (!have || memcmp(next, key, sizeof key) != 0) {
+            memcpy(key, next, sizeof key);
+            mco_rr_market_init(&m, key[0], key[1], key[2], monitor_dates);
+            have = 1;
+        }
+
+        mco_rr_values(&m, spot[i], strike[i], barrier[i], rebate ? rebate[i] : 0.0, &out[i]);
+    }
+}
+
+/*============================================================================
+ * Table
+ *============================================================================*/
+
+const mco_kernels KERNEL_TABLE = {
+    MCO_KERNEL_CPU,
+    binomial_sweep,
+    trinomial_sweep,
+    pde_step,
+    pde_step_lane,
+    fast_paths,
+    inv_normal,
+    sobol_next,
+    barrier_values
+};
+
+#ifdef MCO_KERNEL_GENERIC
+const mco_kernels *mco_kernels_get(mco_cpu_level level)
+{
+#if defined(__x86_64__)
+    switch (level) {
+        case MCO_CPU_AVX512:  return &mco_kernels_avx512;
+        case MCO_CPU_AVX2:    return &mco_kernels_avx2;
+        case MCO_CPU_SSE42:   return &mco_kernels_sse42;
+        case MCO_CPU_GENERIC: return &mco_kernels_generic;
+        default:              return &mco_kernels_generic;
+    }
+#else
+    (void)level;
+    return &mco_kernels_generic;
+#endif
+}
+#endif
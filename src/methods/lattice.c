@@ -0,0 +1,284 @@
+/*
+ * Lattice Pricing Implementation
+ *
+ * Leisen-Reimer binomial and Boyle trinomial trees with in-place
+ * backward induction, Bermudan exercise levels and Richardson
+ * extrapolation.
+ */
+
+#include "internal/methods/lattice.h"
+#include "internal/methods/kernels.h"
+#include "internal/allocator.h"
+#include <math.h>
+#include <string.h>
+
+/*============================================================================
+ * Setup
+ *============================================================================*/
+
+void mco_lattice_spec_init(mco_lattice_spec *spec, const mco_ctx *ctx)
+{
+    spec->engine = (mco_american_engine)ctx->american_engine;
+    spec->steps = ctx->lattice_steps;
+    spec->richardson = ctx->lattice_richardson;
+    spec->exercise_times = NULL;
+    spec->num_exercise = 0;
+    spec->cpu_level = (mco_cpu_level)ctx->cpu_level;
+}
+
+/*
+ * Exercise flag per level 0..steps: every level for an American, else
+ * the level nearest each date plus maturity.
+ */
+static unsigned char *exercise_levels(const mco_lattice_spec *spec,
+                                      size_t steps,
+                                      double time)
+{
+    unsigned char *flags = (unsigned char *)mco_calloc(steps + 1, 1);
+    if (!flags) return NULL;
+
+    if (!spec->exercise_times) {
+        memset(flags, 1, steps + 1);
+        return flags;
+    }
+
+    double dt = time / (double)steps;
+    flags[steps] = 1;
+    for (size_t i = 0; i < spec->num_exercise; ++i) {
+        double level = floor(spec->exercise_times[i] / dt + 0.5);
+        if (level < 0.0) level = 0.0;
+        flags[level < (double)steps ? (size_t)level : steps] = 1;
+    }
+    return flags;
+}
+
+/*============================================================================
+ * Leisen-Reimer Binomial
+ *============================================================================*/
+
+/*
+ * Peizer-Pratt method 2 inversion: the probability h(z) that makes an
+ * n-step binomial match the normal CDF at z.
+ */
+static double peizer_pratt(double z, double n)
+{
+    double a = z / (n + 1.0 / 3.0 + 0.1 / (n + 1.0));
+    return 0.5 + copysign(0.5 * sqrt(-expm1(-a * a * (n + 1.0 / 6.0))), z);
+}
+
+/*
+ * One strike on an n-step tree (n odd). values and spots hold n + 1
+ * entries.
+ */
+static double binomial_price(mco_binomial_sweep_fn sweep,
+                             size_t n,
+                             const unsigned char *flags,
+                             double spot,
+                             double strike,
+                             double rate,
+                             double volatility,
+                             double time,
+                             mco_option_type type,
+                             double *values,
+                             double *spots)
+{
+    double dt = time / (double)n;
+    double growth = exp(rate * dt);
+    double vol_sqrt_t = volatility * sqrt(time);
+
+    double d1 = (log(spot / strike) + (rate + 0.5 * volatility * volatility) * time) / vol_sqrt_t;
+    double d2 = d1 - vol_sqrt_t;
+    double p = peizer_pratt(d2, (double)n);
+    double u = growth * peizer_pratt(d1, (double)n) / p;
+    double d = (growth - p * u) / (1.0 - p);
+
+    /* Terminal level: node j has j up-moves */
+    double log_d = log(d);
+    double log_ud = log(u) - log_d;
+    double log_base = log(spot) + (double)n * log_d;
+    for (size_t j = 0; j <= n; ++j) {
+        spots[j] = exp(log_base + (double)j * log_ud);
+        values[j] = mco_payoff(spots[j], strike, type);
+    }
+
+    /* Node (i, j) = node (i+1, j) / d */
+    return sweep(n, flags, strike, type, 1.0 / d, p / growth, (1.0 - p) / growth,
+                 values, spots);
+}
+
+static int binomial_run(const mco_lattice_spec *spec,
+                        size_t n,
+                        double spot,
+                        const double *strikes,
+                        size_t num_strikes,
+                        double rate,
+                        double volatility,
+                        double time,
+                        mco_option_type type,
+                        double *out)
+{
+    const mco_kernels *kernels = mco_kernels_get(spec->cpu_level);
+    unsigned char *flags = exercise_levels(spec, n, time);
+    double *values = (double *)mco_malloc((n + 1) * sizeof(double));
+    double *spots = (double *)mco_malloc((n + 1) * sizeof(double));
+
+    if (!flags || !values || !spots) {
+        mco_free(flags);
+        mco_free(values);
+        mco_free(spots);
+        return -1;
+    }
+
+    for (size_t k = 0; k < num_strikes; ++k) {
+        out[k] = binomial_price(kernels->binomial_sweep, n, flags, spot, strikes[k],
+                                rate, volatility, time, type, values, spots);
+    }
+
+    mco_free(flags);
+    mco_free(values);
+    mco_free(spots);
+    return 0;
+}
+
+/*============================================================================
+ * Trinomial
+ *============================================================================*/
+
+static int trinomial_run(const mco_lattice_spec *spec,
+                         size_t n,
+                         double spot,
+                         const double *strikes,
+                         size_t num_strikes,
+                         double rate,
+                         double volatility,
+                         double time,
+                         mco_option_type type,
+                         double *out)
+{
+    const mco_kernels *kernels = mco_kernels_get(spec->cpu_level);
+    size_t width = 2 * n + 1;
+
+    unsigned char *flags = exercise_levels(spec, n, time);
+    double *values = (double *)mco_malloc(width * sizeof(double));
+    double *spots = (double *)mco_malloc(width * sizeof(double));
+
+    if (!flags || !values || !spots) {
+        mco_free(flags);
+        mco_free(values);
+        mco_free(spots);
+        return -1;
+    }
+
+    double dt = time / (double)n;
+    double dx = volatility * sqrt(2.0 * dt);
+
+    /* Moment-matched probabilities over half a step (Boyle) */
+    double eu = exp(0.5 * dx);
+    double ed = 1.0 / eu;
+    double er = exp(0.5 * rate * dt);
+    double pu = (er - ed) / (eu - ed);
+    double pd = (eu - er) / (eu - ed);
+    pu *= pu;
+    pd *= pd;
+
+    double df = exp(-rate * dt);
+    double wu = df * pu;
+    double wd = df * pd;
+    double wm = df * (1.0 - pu - pd);
+
+    /* spots[c] = S·u^(c - n); level i node j sits at c = n - i + j */
+    double log_spot = log(spot);
+    for (size_t c = 0; c < width; ++c) {
+        spots[c] = exp(log_spot + ((double)c - (double)n) * dx);
+    }
+
+    /* Grid, probabilities and exercise levels are shared by the strip */
+    for (size_t k = 0; k < num_strikes; ++k) {
+        for (size_t j = 0; j < width; ++j) {
+            values[j] = mco_payoff(spots[j], strikes[k], type);
+        }
+        kernels->trinomial_sweep(n, flags, spots, strikes[k], type, wd, wm, wu, values);
+        out[k] = values[0];
+    }
+
+    mco_free(flags);
+    mco_free(values);
+    mco_free(spots);
+    return 0;
+}
+
+/*============================================================================
+ * Pricing
+ *============================================================================*/
+
+static int lattice_run(const mco_lattice_spec *spec,
+                       size_t n,
+                       double spot,
+                       const double *strikes,
+                       size_t num_strikes,
+                       double rate,
+                       double volatility,
+                       double time,
+                       mco_option_type type,
+                       double *out)
+{
+    if (spec->engine == MCO_ENGINE_TRINOMIAL) {
+        return trinomial_run(spec, n, spot, strikes, num_strikes, rate,
+                             volatility, time, type, out);
+    }
+    return binomial_run(spec, n, spot, strikes, num_strikes, rate,
+                        volatility, time, type, out);
+}
+
+int mco_lattice_price(const mco_lattice_spec *spec,
+                      double spot,
+                      const double *strikes,
+                      size_t num_strikes,
+                      double rate,
+                      double volatility,
+                      double time,
+                      mco_option_type type,
+                      double *out)
+{
+    if (num_strikes == 0) return 0;
+
+    /* No diffusion: immediate exercise or the discounted forward payoff */
+    if (time <= 0.0 || volatility <= 0.0) {
+        double df = exp(-rate * time);
+        double fwd = spot * exp(rate * time);
+        for (size_t k = 0; k < num_strikes; ++k) {
+            out[k] = fmax(mco_payoff(spot, strikes[k], type),
+                          df * mco_payoff(fwd, strikes[k], type));
+        }
+        return 0;
+    }
+
+    /* Leisen-Reimer needs an odd number of steps */
+    int binomial = spec->engine != MCO_ENGINE_TRINOMIAL;
+    size_t n = spec->steps > 0 ? spec->steps : 1;
+    if (binomial) n |= 1;
+
+    if (lattice_run(spec, n, spot, strikes, num_strikes, rate, volatility,
+                    time, type, out) != 0) {
+        return -1;
+    }
+
+    size_t half = binomial ? ((n / 2) | 1) : n / 2;
+    if (!spec->richardson || half == 0 || half >= n) return 0;
+
+    double *coarse = (double *)mco_malloc(num_strikes * sizeof(double));
+    if (!coarse || lattice_run(spec, half, spot, strikes, num_strikes, rate,
+                               volatility, time, type, coarse) != 0) {
+        mco_free(coarse);
+        return -1;
+    }
+
+    double fn = (double)n;
+    double fh = (double)half;
+    for (size_t k = 0; k < num_strikes; ++k) {
+        out[k] = (fn * out[k] - fh * coarse[k]) / (fn - fh);
+    }
+
+    mco_free(coarse);
+    return 0;
+}
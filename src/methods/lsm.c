@@ -5,104 +5,173 @@
  */
 
 #include "internal/methods/lsm.h"
-#include "internal/models/gbm.h"
+#include "internal/methods/exercise_cache.h"
+#include "internal/models/gbm_schedule.h"
+#include "internal/variance_reduction/importance.h"
 #include "internal/allocator.h"
 #include "internal/rng.h"
 #include <math.h>
-#include <string.h>
 
 /*============================================================================
- * Least Squares Regression (Normal Equations)
+ * Regression Basis
  *============================================================================*/
 
-/*
- * Solve the normal equations (A'A)x = A'b for least squares.
- *
- * For our small 3x3 system, we use direct computation rather than
- * a general-purpose solver. This is faster and avoids dependencies.
- */
-int mco_lsm_regress(const double *A,
-                    const double *b,
-                    double *coeffs,
-                    size_t n_samples,
-                    size_t n_basis)
+void mco_lsm_basis_init(mco_lsm_basis *basis,
+                        const mco_ctx *ctx,
+                        double strike,
+                        double volatility,
+                        double time_to_maturity)
 {
-    /* Compute A'A (n_basis × n_basis) and A'b (n_basis) */
-    double AtA[MCO_LSM_NUM_BASIS * MCO_LSM_NUM_BASIS] = {0};
-    double Atb[MCO_LSM_NUM_BASIS] = {0};
-
-    for (size_t i = 0; i < n_samples; ++i) {
-        const double *row = A + i * n_basis;
-        double bi = b[i];
-
-        for (size_t j = 0; j < n_basis; ++j) {
-            Atb[j] += row[j] * bi;
-            for (size_t k = 0; k < n_basis; ++k) {
-                AtA[j * n_basis + k] += row[j] * row[k];
-            }
-        }
+    double scale = volatility * sqrt(time_to_maturity);
+
+    basis->kind = ctx->lsm_basis;
+    basis->degree = ctx->lsm_degree;
+    basis->payoff = ctx->lsm_payoff_regressor;
+    basis->num_basis = basis->degree + 1 + (basis->payoff ? 1u : 0u);
+    basis->inv_strike = 1.0 / strike;
+    basis->inv_scale = (scale > 0.0) ? 1.0 / scale : 1.0;
+    basis->ridge = ctx->lsm_ridge;
+}
+
+/*============================================================================
+ * Exercise Policy
+ *============================================================================*/
+
+int mco_exercise_policy_init(mco_exercise_policy *policy,
+                             const mco_lsm_basis *basis,
+                             size_t num_dates)
+{
+    policy->basis = *basis;
+    policy->num_dates = num_dates;
+    policy->coeffs = (double *)mco_calloc(num_dates * MCO_LSM_MAX_BASIS, sizeof(double));
+    policy->fitted = (unsigned char *)mco_calloc(num_dates, 1);
+
+    if (!policy->coeffs || !policy->fitted) {
+        mco_exercise_policy_free(policy);
+        return -1;
     }
 
-    /*
-     * Solve 3x3 system using Gaussian elimination with partial pivoting.
-     * For production, consider using LAPACK, but this works for small systems.
-     */
-    double aug[MCO_LSM_NUM_BASIS][MCO_LSM_NUM_BASIS + 1];
+    return 0;
+}
 
-    /* Build augmented matrix [AtA | Atb] */
-    for (size_t i = 0; i < n_basis; ++i) {
-        for (size_t j = 0; j < n_basis; ++j) {
-            aug[i][j] = AtA[i * n_basis + j];
-        }
-        aug[i][n_basis] = Atb[i];
+void mco_exercise_policy_free(mco_exercise_policy *policy)
+{
+    mco_free(policy->coeffs);
+    mco_free(policy->fitted);
+    policy->coeffs = NULL;
+    policy->fitted = NULL;
+}
+
+/*============================================================================
+ * Least Squares Regression (Scaled Cholesky)
+ *============================================================================*/
+
+int mco_lsm_solve(const mco_lsm_normal *ne, double ridge, double *coeffs)
+{
+    size_t n = ne->num_basis;
+    double scale[MCO_LSM_MAX_BASIS];
+    double L[MCO_LSM_MAX_BASIS][MCO_LSM_MAX_BASIS];
+    double y[MCO_LSM_MAX_BASIS];
+
+    for (size_t j = 0; j < n; ++j) {
+        coeffs[j] = 0.0;
     }
+    if (ne->count < n) return -1;
 
-    /* Forward elimination with partial pivoting */
-    for (size_t col = 0; col < n_basis; ++col) {
-        /* Find pivot */
-        size_t max_row = col;
-        double max_val = fabs(aug[col][col]);
-        for (size_t row = col + 1; row < n_basis; ++row) {
-            if (fabs(aug[row][col]) > max_val) {
-                max_val = fabs(aug[row][col]);
-                max_row = row;
+    /* Unit diagonal: the ridge and the pivot test become scale-free */
+    for (size_t j = 0; j < n; ++j) {
+        double d = ne->ata[j * MCO_LSM_MAX_BASIS + j];
+        if (!(d > 0.0)) return -1;  /* Column identically zero */
+        scale[j] = 1.0 / sqrt(d);
+    }
+
+    /* Cholesky of D·A'A·D + λI, lower triangle */
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t i = j; i < n; ++i) {
+            double sum = ne->ata[i * MCO_LSM_MAX_BASIS + j] * scale[i] * scale[j];
+            if (i == j) sum += ridge;
+
+            for (size_t k = 0; k < j; ++k) {
+                sum -= L[i][k] * L[j][k];
             }
-        }
 
-        /* Swap rows if needed */
-        if (max_row != col) {
-            for (size_t j = 0; j <= n_basis; ++j) {
-                double tmp = aug[col][j];
-                aug[col][j] = aug[max_row][j];
-                aug[max_row][j] = tmp;
+            if (i == j) {
+                if (!(sum > 0.0)) return -1;  /* Not positive definite */
+                L[j][j] = sqrt(sum);
+            } else {
+                L[i][j] = sum / L[j][j];
             }
         }
+    }
 
-        /* Check for singularity */
-        if (fabs(aug[col][col]) < 1e-12) {
-            /* Matrix is singular - return zeros */
-            for (size_t i = 0; i < n_basis; ++i) {
-                coeffs[i] = 0.0;
-            }
-            return -1;
+    /* L·y = D·A'b */
+    for (size_t i = 0; i < n; ++i) {
+        double sum = ne->atb[i] * scale[i];
+        for (size_t k = 0; k < i; ++k) {
+            sum -= L[i][k] * y[k];
         }
+        y[i] = sum / L[i][i];
+    }
 
-        /* Eliminate below */
-        for (size_t row = col + 1; row < n_basis; ++row) {
-            double factor = aug[row][col] / aug[col][col];
-            for (size_t j = col; j <= n_basis; ++j) {
-                aug[row][j] -= factor * aug[col][j];
-            }
+    /* L'·z = y, β = D·z */
+    for (size_t i = n; i-- > 0;) {
+        double sum = y[i];
+        for (size_t k = i + 1; k < n; ++k) {
+            sum -= L[k][i] * y[k];
+        }
+        y[i] = sum / L[i][i];
+    }
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = y[i] * scale[i];
+    }
+
+    return 0;
+}
+
+/*============================================================================
+ * Backward Induction Step
+ *============================================================================*/
+
+int mco_lsm_exercise_step(const mco_lsm_basis *basis,
+                          const double *spots,
+                          size_t stride,
+                          double *cashflow,
+                          uint64_t n_paths,
+                          double strike,
+                          mco_option_type type,
+                          double *coeffs)
+{
+    size_t n_basis = basis->num_basis;
+    double phi[MCO_LSM_MAX_BASIS];
+    mco_lsm_normal ne;
+
+    /* Regression over in-the-money paths, accumulated on the fly */
+    mco_lsm_normal_reset(&ne, n_basis);
+    for (uint64_t i = 0; i < n_paths; ++i) {
+        double s_t = spots[i * stride];
+        double exercise_value = mco_payoff(s_t, strike, type);
+
+        if (exercise_value > 0.0) {
+            mco_lsm_basis_eval(basis, s_t, exercise_value, phi);
+            mco_lsm_normal_add(&ne, phi, cashflow[i]);
         }
     }
 
-    /* Back substitution */
-    for (int i = (int)n_basis - 1; i >= 0; --i) {
-        coeffs[i] = aug[i][n_basis];
-        for (size_t j = (size_t)i + 1; j < n_basis; ++j) {
-            coeffs[i] -= aug[i][j] * coeffs[j];
+    if (mco_lsm_solve(&ne, basis->ridge, coeffs) != 0) {
+        return -1;
+    }
+
+    /* Exercise where immediate value beats the fitted continuation */
+    for (uint64_t i = 0; i < n_paths; ++i) {
+        double s_t = spots[i * stride];
+        double exercise_value = mco_payoff(s_t, strike, type);
+
+        if (exercise_value > 0.0) {
+            mco_lsm_basis_eval(basis, s_t, exercise_value, phi);
+            if (exercise_value > mco_lsm_continuation(coeffs, phi, n_basis)) {
+                cashflow[i] = exercise_value;
+            }
         }
-        coeffs[i] /= aug[i][i];
     }
 
     return 0;
@@ -112,176 +181,351 @@ int mco_lsm_regress(const double *A,
  * LSM American Option Pricing
  *============================================================================*/
 
-double mco_lsm_american(mco_ctx *ctx,
-                        double spot,
-                        double strike,
-                        double rate,
-                        double volatility,
-                        double time_to_maturity,
-                        size_t num_steps,
-                        mco_option_type type)
+double mco_lsm_price(const double *cashflow,
+                     double discount,
+                     const double *terminal,
+                     size_t stride,
+                     uint64_t n_paths,
+                     const mco_path_controls *pc,
+                     mco_mcv_stats *stats,
+                     double *std_error)
 {
-    if (!ctx || num_steps == 0) return 0.0;
+    if (!pc || pc->k == 0) {
+        mco_is_stats plain;
+        mco_is_init(&plain);
+        for (uint64_t i = 0; i < n_paths; ++i) {
+            mco_is_add(&plain, cashflow[i]);
+        }
+        if (std_error) *std_error = discount * mco_is_std_error(&plain);
+        return discount * mco_is_mean(&plain);
+    }
 
-    uint64_t n_paths = ctx->num_simulations;
-    double dt = time_to_maturity / (double)num_steps;
-    double df = exp(-rate * dt);  /* Per-step discount factor */
+    for (uint64_t i = 0; i < n_paths; ++i) {
+        mco_path_state st;
+        double z[MCO_MCV_MAX];
+        mco_path_state_init(&st, terminal[i * stride], 0u);
+        mco_path_controls_eval(pc, &st, 0.0, z);
+        mco_mcv_add(stats, discount * cashflow[i], z);
+    }
+    if (std_error) *std_error = mco_mcv_std_error(stats);
+    return mco_mcv_estimate(stats);
+}
 
-    /* Allocate memory for paths and cash flows */
-    /* paths[i * (num_steps + 1) + j] = spot price of path i at step j */
-    double *paths = (double *)mco_malloc(n_paths * (num_steps + 1) * sizeof(double));
-    /* cashflow[i] = present value of optimal exercise for path i */
-    double *cashflow = (double *)mco_calloc(n_paths, sizeof(double));
-    /* exercise_time[i] = step at which path i is exercised (num_steps = at maturity) */
-    size_t *exercise_time = (size_t *)mco_malloc(n_paths * sizeof(size_t));
+/*
+ * Simulate n_paths paths on the schedule, date-major:
+ * paths[j * n_paths + i] = spot of path i at step j + 1, so each
+ * backward step reads its spots contiguously. NULL on allocation
+ * failure; free with mco_free.
+ */
+static double *lsm_simulate(const mco_gbm_schedule *sched, mco_rng rng, uint64_t n_paths)
+{
+    size_t num_steps = sched->num_dates;
+    double *paths = (double *)mco_malloc(n_paths * num_steps * sizeof(double));
+    double *path = (double *)mco_malloc(num_steps * sizeof(double));
 
-    if (!paths || !cashflow || !exercise_time) {
+    if (!paths || !path) {
         mco_free(paths);
-        mco_free(cashflow);
-        mco_free(exercise_time);
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
+        mco_free(path);
+        return NULL;
+    }
+
+    for (uint64_t i = 0; i < n_paths; ++i) {
+        mco_gbm_schedule_simulate(sched, &rng, path);
+        for (size_t j = 0; j < num_steps; ++j) {
+            paths[j * n_paths + i] = path[j];
+        }
     }
 
-    /* Initialize GBM path model */
-    mco_gbm_path model;
-    mco_gbm_path_init(&model, spot, rate, volatility, time_to_maturity, num_steps);
+    mco_free(path);
+    return paths;
+}
+
+/*
+ * Backward LSM on a uniform schedule, recording each date's regression
+ * into policy when it is non-NULL. Writes the price and its standard
+ * error. Returns 0, or -1 on allocation failure.
+ */
+static int lsm_fit(const mco_gbm_schedule *sched,
+                   const mco_lsm_basis *basis,
+                   mco_rng rng,
+                   uint64_t n_paths,
+                   double strike,
+                   mco_option_type type,
+                   const mco_path_controls *pc,
+                   mco_mcv_stats *cv_stats,
+                   mco_exercise_policy *policy,
+                   double *price,
+                   double *std_error)
+{
+    size_t num_steps = sched->num_dates;
+    double df = exp(-sched->rate * sched->maturity / (double)num_steps);  /* Per-step discount */
 
     /*=========================================================================
      * Step 1: Generate all paths forward
      *=========================================================================*/
-    mco_rng rng = ctx->rng;  /* Copy RNG state */
+    double *paths = lsm_simulate(sched, rng, n_paths);
+    /* cashflow[i] = value of optimal exercise for path i, discounted to the current step */
+    double *cashflow = (double *)mco_calloc(n_paths, sizeof(double));
 
-    for (uint64_t i = 0; i < n_paths; ++i) {
-        double *path = paths + i * (num_steps + 1);
-        mco_gbm_simulate_path(&model, &rng, path);
-        exercise_time[i] = num_steps;  /* Default: exercise at maturity */
+    if (!paths || !cashflow) {
+        mco_free(paths);
+        mco_free(cashflow);
+        return -1;
     }
 
     /*=========================================================================
      * Step 2: Initialize with terminal payoffs
      *=========================================================================*/
     for (uint64_t i = 0; i < n_paths; ++i) {
-        double s_T = paths[i * (num_steps + 1) + num_steps];
+        double s_T = paths[(num_steps - 1) * n_paths + i];
         cashflow[i] = mco_payoff(s_T, strike, type);
     }
 
     /*=========================================================================
      * Step 3: Backward induction with regression
      *=========================================================================*/
-    
-    /* Temporary arrays for regression */
-    double *A = (double *)mco_malloc(n_paths * MCO_LSM_NUM_BASIS * sizeof(double));
-    double *Y = (double *)mco_malloc(n_paths * sizeof(double));
-    uint64_t *itm_indices = (uint64_t *)mco_malloc(n_paths * sizeof(uint64_t));
-
-    if (!A || !Y || !itm_indices) {
-        mco_free(paths);
-        mco_free(cashflow);
-        mco_free(exercise_time);
-        mco_free(A);
-        mco_free(Y);
-        mco_free(itm_indices);
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
-    }
 
     /* Work backwards from step (num_steps - 1) to step 1 */
     for (size_t step = num_steps - 1; step >= 1; --step) {
-        /*
-         * Discount all cash flows one step back
-         */
+        /* Discount all cash flows one step back */
         for (uint64_t i = 0; i < n_paths; ++i) {
             cashflow[i] *= df;
         }
 
-        /*
-         * Find in-the-money paths at this step
-         */
-        size_t n_itm = 0;
-        for (uint64_t i = 0; i < n_paths; ++i) {
-            double s_t = paths[i * (num_steps + 1) + step];
-            double exercise_value = mco_payoff(s_t, strike, type);
+        /* Regress and exercise; a skipped step keeps every path alive */
+        double coeffs[MCO_LSM_MAX_BASIS];
+        int rc = mco_lsm_exercise_step(basis, paths + (step - 1) * n_paths, 1, cashflow,
+                                       n_paths, strike, type, coeffs);
+        if (policy) {
+            mco_exercise_policy_record(policy, step - 1, rc == 0 ? coeffs : NULL, strike);
+        }
+    }
 
-            if (exercise_value > 0.0) {
-                itm_indices[n_itm] = i;
+    /*=========================================================================
+     * Step 4: Discount remaining cash flows to time 0 and average
+     *=========================================================================*/
+    
+    /* One more step to time 0, against S(T) for the controls */
+    *price = mco_lsm_price(cashflow, df, paths + (num_steps - 1) * n_paths, 1,
+                           n_paths, pc, cv_stats, std_error);
 
-                /* Build design matrix row: basis functions of S/K */
-                double x = s_t / strike;
-                mco_lsm_basis(x, A + n_itm * MCO_LSM_NUM_BASIS);
+    /* Cleanup */
+    mco_free(paths);
+    mco_free(cashflow);
 
-                /* Target: discounted future cashflow */
-                Y[n_itm] = cashflow[i];
+    return 0;
+}
 
-                n_itm++;
-            }
-        }
+double mco_lsm_american_policy(mco_ctx *ctx,
+                               double spot,
+                               double strike,
+                               double rate,
+                               double volatility,
+                               double time_to_maturity,
+                               size_t num_steps,
+                               mco_option_type type,
+                               mco_exercise_policy *policy_out)
+{
+    if (policy_out) {
+        policy_out->coeffs = NULL;
+        policy_out->fitted = NULL;
+    }
+    if (!ctx || num_steps == 0) return 0.0;
 
-        /* Need at least as many samples as basis functions */
-        if (n_itm < MCO_LSM_NUM_BASIS) {
-            continue;
-        }
+    /* Exercise dates tᵢ = i·T/n, sampled exactly */
+    mco_gbm_schedule sched;
+    if (mco_gbm_schedule_init_uniform(&sched, spot, rate, volatility,
+                                      time_to_maturity, num_steps) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
 
-        /*
-         * Regression: estimate continuation value
-         */
-        double coeffs[MCO_LSM_NUM_BASIS];
-        int rc = mco_lsm_regress(A, Y, coeffs, n_itm, MCO_LSM_NUM_BASIS);
+    mco_lsm_basis basis;
+    mco_lsm_basis_init(&basis, ctx, strike, volatility, time_to_maturity);
 
-        if (rc != 0) {
-            /* Regression failed - skip this step */
-            continue;
-        }
+    /* A policy is kept when the caller wants it or the cache will */
+    mco_exercise_cache *cache = ctx->exercise_cache;
+    mco_exercise_policy local = {0};
+    mco_exercise_policy *policy = policy_out ? policy_out : (cache ? &local : NULL);
 
-        /*
-         * Exercise decision: compare immediate vs continuation
-         */
-        for (size_t j = 0; j < n_itm; ++j) {
-            uint64_t i = itm_indices[j];
-            double s_t = paths[i * (num_steps + 1) + step];
-            double exercise_value = mco_payoff(s_t, strike, type);
-
-            /* Estimated continuation value from regression */
-            double x = s_t / strike;
-            double basis[MCO_LSM_NUM_BASIS];
-            mco_lsm_basis(x, basis);
-
-            double continuation = 0.0;
-            for (size_t k = 0; k < MCO_LSM_NUM_BASIS; ++k) {
-                continuation += coeffs[k] * basis[k];
-            }
+    if (policy && mco_exercise_policy_init(policy, &basis, num_steps) != 0) {
+        mco_gbm_schedule_free(&sched);
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
 
-            /* Exercise if immediate value exceeds continuation */
-            if (exercise_value > continuation) {
-                cashflow[i] = exercise_value;
-                exercise_time[i] = step;
-            }
-        }
+    /* European payoff and terminal spot are known-mean controls on the fit */
+    mco_path_controls controls;
+    mco_mcv_stats cv_stats;
+    mco_path_controls_init(&controls, &cv_stats, ctx->control_variates,
+                           MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA,
+                           spot, strike, 0.0, 0, rate, volatility,
+                           time_to_maturity, num_steps, type);
+
+    double price = 0.0;
+    double std_error = 0.0;
+    mco_exercise_key key;
+    if (cache) {
+        mco_exercise_key_init(&key, &sched, strike, volatility, type, &basis);
     }
 
-    /*=========================================================================
-     * Step 4: Discount remaining cash flows to time 0 and average
-     *=========================================================================*/
-    
-    /* Final discount to time 0 */
+    if (cache && mco_exercise_cache_get(cache, &key, policy)) {
+        /* Known contract: forward pass under the cached policy */
+        price = mco_exercise_forward_price(ctx, &sched, policy, strike, type,
+                                           &controls, &cv_stats);
+    } else if (lsm_fit(&sched, &basis, ctx->rng, ctx->num_simulations, strike, type,
+                       &controls, &cv_stats, policy, &price, &std_error) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        if (policy) mco_exercise_policy_free(policy);
+    } else {
+        ctx->last_std_error = std_error;
+        if (cache) mco_exercise_cache_put(cache, &key, policy);
+    }
+
+    mco_gbm_schedule_free(&sched);
+    if (policy == &local) mco_exercise_policy_free(&local);
+
+    return price;
+}
+
+double mco_lsm_american(mco_ctx *ctx,
+                        double spot,
+                        double strike,
+                        double rate,
+                        double volatility,
+                        double time_to_maturity,
+                        size_t num_steps,
+                        mco_option_type type)
+{
+    return mco_lsm_american_policy(ctx, spot, strike, rate, volatility,
+                                   time_to_maturity, num_steps, type, NULL);
+}
+
+/*============================================================================
+ * Strike Strip
+ *============================================================================*/
+
+/*
+ * One backward step for one strike of a strip. phis holds the shared
+ * basis of every path (row stride MCO_LSM_MAX_BASIS); with a payoff
+ * regressor its last slot is rewritten here for this strike.
+ */
+static void strip_exercise_step(const mco_lsm_basis *basis,
+                                const double *spots,
+                                double *phis,
+                                double *cashflow,
+                                uint64_t n_paths,
+                                double strike,
+                                mco_option_type type)
+{
+    size_t n_basis = basis->num_basis;
+    size_t slot = basis->degree + 1;
+    double inv_strike = 1.0 / strike;
+    double coeffs[MCO_LSM_MAX_BASIS];
+    mco_lsm_normal ne;
+
+    mco_lsm_normal_reset(&ne, n_basis);
     for (uint64_t i = 0; i < n_paths; ++i) {
-        cashflow[i] *= df;  /* One more step */
+        double exercise_value = mco_payoff(spots[i], strike, type);
+
+        if (exercise_value > 0.0) {
+            double *phi = phis + i * MCO_LSM_MAX_BASIS;
+            if (basis->payoff) phi[slot] = exercise_value * inv_strike;
+            mco_lsm_normal_add(&ne, phi, cashflow[i]);
+        }
+    }
+
+    if (mco_lsm_solve(&ne, basis->ridge, coeffs) != 0) {
+        return;
     }
 
-    double sum = 0.0;
     for (uint64_t i = 0; i < n_paths; ++i) {
-        sum += cashflow[i];
+        double exercise_value = mco_payoff(spots[i], strike, type);
+
+        if (exercise_value > 0.0 &&
+            exercise_value > mco_lsm_continuation(coeffs, phis + i * MCO_LSM_MAX_BASIS, n_basis)) {
+            cashflow[i] = exercise_value;
+        }
     }
+}
 
-    double price = sum / (double)n_paths;
+void mco_lsm_american_strip(mco_ctx *ctx,
+                            double spot,
+                            const double *strikes,
+                            size_t num_strikes,
+                            double rate,
+                            double volatility,
+                            double time_to_maturity,
+                            size_t num_steps,
+                            mco_option_type type,
+                            double *out)
+{
+    if (!ctx || num_steps == 0 || num_strikes == 0) return;
+
+    mco_gbm_schedule sched;
+    if (mco_gbm_schedule_init_uniform(&sched, spot, rate, volatility,
+                                      time_to_maturity, num_steps) != 0) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return;
+    }
+
+    /* Basis in S/S₀, shared by every strike */
+    mco_lsm_basis basis;
+    mco_lsm_basis_init(&basis, ctx, spot, volatility, time_to_maturity);
+
+    uint64_t n_paths = ctx->num_simulations;
+    double df = exp(-rate * time_to_maturity / (double)num_steps);
+
+    double *paths = lsm_simulate(&sched, ctx->rng, n_paths);
+    double *phis = (double *)mco_malloc(n_paths * MCO_LSM_MAX_BASIS * sizeof(double));
+    double *cashflow = (double *)mco_malloc(num_strikes * n_paths * sizeof(double));
+
+    if (!paths || !phis || !cashflow) {
+        mco_free(paths);
+        mco_free(phis);
+        mco_free(cashflow);
+        mco_gbm_schedule_free(&sched);
+        ctx->last_error = MCO_ERR_NOMEM;
+        return;
+    }
+
+    /* cashflow[k * n_paths + i]: path i under strike k */
+    const double *terminal = paths + (num_steps - 1) * n_paths;
+    for (size_t k = 0; k < num_strikes; ++k) {
+        for (uint64_t i = 0; i < n_paths; ++i) {
+            cashflow[k * n_paths + i] = mco_payoff(terminal[i], strikes[k], type);
+        }
+    }
+
+    /* One backward pass: basis once per date, then each strike's fit */
+    for (size_t step = num_steps - 1; step >= 1; --step) {
+        const double *spots = paths + (step - 1) * n_paths;
+
+        for (uint64_t i = 0; i < num_strikes * n_paths; ++i) {
+            cashflow[i] *= df;
+        }
+        for (uint64_t i = 0; i < n_paths; ++i) {
+            mco_lsm_basis_eval(&basis, spots[i], 0.0, phis + i * MCO_LSM_MAX_BASIS);
+        }
+        for (size_t k = 0; k < num_strikes; ++k) {
+            strip_exercise_step(&basis, spots, phis, cashflow + k * n_paths,
+                                n_paths, strikes[k], type);
+        }
+    }
+
+    for (size_t k = 0; k < num_strikes; ++k) {
+        mco_path_controls controls;
+        mco_mcv_stats cv_stats;
+        mco_path_controls_init(&controls, &cv_stats, ctx->control_variates,
+                               MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA,
+                               spot, strikes[k], 0.0, 0, rate, volatility,
+                               time_to_maturity, num_steps, type);
+        out[k] = mco_lsm_price(cashflow + k * n_paths, df, terminal, 1,
+                               n_paths, &controls, &cv_stats, NULL);
+    }
 
-    /* Cleanup */
     mco_free(paths);
+    mco_free(phis);
     mco_free(cashflow);
-    mco_free(exercise_time);
-    mco_free(A);
-    mco_free(Y);
-    mco_free(itm_indices);
-
-    return price;
+    mco_gbm_schedule_free(&sched);
 }
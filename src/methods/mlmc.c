@@ -0,0 +1,741 @@
+/*
+ * Multilevel Monte Carlo Implementation
+ */
+
+#include "internal/methods/mlmc.h"
+#include "internal/methods/thread_pool.h"
+#include "internal/models/gbm.h"
+#include "internal/models/heston.h"
+#include "internal/instruments/barrier.h"
+#include "internal/instruments/payoff.h"
+#include "internal/allocator.h"
+#include "internal/sum.h"
+#include "mcoptions.h"
+#include <math.h>
+
+#ifndef M_SQRT1_2
+#define M_SQRT1_2 0.70710678118654752440
+#endif
+
+/*============================================================================
+ * Level Batches
+ *============================================================================*/
+
+/*
+ * Moments of a level: the pairwise sum for the mean, Welford's mean and
+ * M2 for the variance. Level 0 of an in-the-money contract has a mean
+ * far above its spread, where Σ Y² / n - mean² would cancel.
+ */
+typedef struct {
+    mco_sum sum;                /* Σ Y */
+    double mean;                /* Running mean (Welford) */
+    double m2;                  /* Σ (Y - mean)² */
+    uint64_t n;
+} mlmc_moments;
+
+static void mlmc_moments_init(mlmc_moments *m)
+{
+    mco_sum_init(&m->sum);
+    m->mean = 0.0;
+    m->m2 = 0.0;
+    m->n = 0;
+}
+
+static void mlmc_moments_add(mlmc_moments *m, double y)
+{
+    mco_sum_add(&m->sum, y);
+    m->n++;
+
+    double dy = y - m->mean;
+    m->mean += dy / (double)m->n;
+    m->m2 += dy * (y - m->mean);
+}
+
+/*
+ * Merge src into dst (Chan et al. pairwise update, as mco_cv_merge)
+ */
+static void mlmc_moments_merge(mlmc_moments *dst, const mlmc_moments *src)
+{
+    if (src->n == 0) return;
+
+    mco_sum_merge(&dst->sum, &src->sum);
+    if (dst->n == 0) {
+        dst->mean = src->mean;
+        dst->m2 = src->m2;
+        dst->n = src->n;
+        return;
+    }
+
+    double na = (double)dst->n;
+    double nb = (double)src->n;
+    double n = na + nb;
+    double dy = src->mean - dst->mean;
+
+    dst->mean += dy * nb / n;
+    dst->m2 += src->m2 + dy * dy * (na * nb / n);
+    dst->n += src->n;
+}
+
+static double mlmc_moments_mean(const mlmc_moments *m)
+{
+    return (m->n > 0) ? mco_sum_value(&m->sum) / (double)m->n : 0.0;
+}
+
+/* Sample variance, n - 1 divisor */
+static double mlmc_moments_variance(const mlmc_moments *m)
+{
+    return (m->n > 1) ? m->m2 / ((double)m->n - 1.0) : 0.0;
+}
+
+typedef struct {
+    mlmc_moments moments;
+    int failed;
+} mlmc_slot;
+
+typedef struct {
+    const mco_mlmc_problem *problem;
+    size_t level;
+    size_t scratch_len;
+    mlmc_slot *slots;           /* One per thread */
+} mlmc_batch;
+
+static void mlmc_batch_worker(void *arg, uint32_t thread_id, mco_rng *rng,
+                              uint64_t start, uint64_t end)
+{
+    mlmc_batch *batch = (mlmc_batch *)arg;
+    mlmc_slot *slot = &batch->slots[thread_id];
+
+    double *scratch = (double *)mco_malloc(batch->scratch_len * sizeof(double));
+    if (!scratch) {
+        slot->failed = 1;
+        return;
+    }
+
+    for (uint64_t i = start; i < end; ++i) {
+        double y = batch->problem->sample(batch->problem->problem, batch->level,
+                                          rng, scratch);
+        mlmc_moments_add(&slot->moments, y);
+    }
+
+    mco_free(scratch);
+}
+
+/*
+ * Sample num_paths more paths at a level, merging into its moments.
+ * Advances *stream past every thread stream it used.
+ */
+static int mlmc_run_batch(mco_ctx *ctx, const mco_mlmc_problem *problem,
+                          size_t level, uint64_t num_paths, mco_rng *stream,
+                          mlmc_slot *slots, uint32_t num_threads,
+                          mlmc_moments *moments)
+{
+    size_t fine_steps = problem->base_steps << level;
+
+    mlmc_batch batch = {
+        .problem     = problem,
+        .level       = level,
+        .scratch_len = problem->scratch_per_step * fine_steps + 2,
+        .slots       = slots
+    };
+
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mlmc_moments_init(&slots[t].moments);
+        slots[t].failed = 0;
+    }
+
+    uint32_t used = mco_parallel_for_rng(ctx, stream, num_paths,
+                                         mlmc_batch_worker, &batch);
+    if (used == 0) return -1;
+
+    for (uint32_t t = 0; t < used; ++t) {
+        if (slots[t].failed) {
+            ctx->last_error = MCO_ERR_NOMEM;
+            return -1;
+        }
+        mlmc_moments_merge(moments, &slots[t].moments);
+    }
+
+    /* Next batch starts beyond every stream this one touched */
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mco_rng_jump(stream);
+    }
+
+    return 0;
+}
+
+/*============================================================================
+ * MLMC Driver
+ *============================================================================*/
+
+/*
+ * Least-squares slope of -log₂ x_l against l over levels 1..L.
+ */
+static double mlmc_decay_rate(const double *x, size_t num_levels)
+{
+    double sl = 0.0, sy = 0.0, sll = 0.0, sly = 0.0;
+    double n = 0.0;
+
+    for (size_t l = 1; l < num_levels; ++l) {
+        if (!(x[l] > 0.0)) continue;
+        double y = -log2(x[l]);
+        double dl = (double)l;
+        sl += dl;
+        sy += y;
+        sll += dl * dl;
+        sly += dl * y;
+        n += 1.0;
+    }
+
+    double denom = n * sll - sl * sl;
+    if (n < 2.0 || denom <= 0.0) return 0.0;
+
+    return (n * sly - sl * sy) / denom;
+}
+
+int mco_mlmc_run(mco_ctx *ctx,
+                 const mco_mlmc_problem *problem,
+                 double target_rmse,
+                 mco_mlmc_result *result)
+{
+    if (!(target_rmse > 0.0) || problem->base_steps == 0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return -1;
+    }
+
+    uint32_t num_threads = ctx->num_threads ? ctx->num_threads : 1;
+    mlmc_slot *slots = (mlmc_slot *)mco_calloc(num_threads, sizeof(mlmc_slot));
+    if (!slots) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return -1;
+    }
+
+    mlmc_moments moments[MCO_MLMC_MAX_LEVELS];
+    double mean[MCO_MLMC_MAX_LEVELS] = {0};
+    double var[MCO_MLMC_MAX_LEVELS] = {0};
+    double cost[MCO_MLMC_MAX_LEVELS] = {0};
+    uint64_t paths[MCO_MLMC_MAX_LEVELS] = {0};
+    uint64_t extra[MCO_MLMC_MAX_LEVELS] = {0};
+
+    for (size_t l = 0; l < MCO_MLMC_MAX_LEVELS; ++l) {
+        mlmc_moments_init(&moments[l]);
+        double steps = (double)(problem->base_steps << l);
+        cost[l] = (l == 0) ? steps : 1.5 * steps;
+    }
+
+    size_t num_levels = MCO_MLMC_MIN_LEVELS;
+    for (size_t l = 0; l < num_levels; ++l) {
+        extra[l] = MCO_MLMC_WARMUP;
+    }
+
+    mco_rng stream = ctx->rng;
+    double eps2 = target_rmse * target_rmse;
+    double alpha = 1.0;
+    double beta = 1.0;
+    double bias = 0.0;
+
+    for (;;) {
+        /* Sample the outstanding paths */
+        int pending = 0;
+        for (size_t l = 0; l < num_levels; ++l) {
+            if (extra[l] == 0) continue;
+            pending = 1;
+            if (mlmc_run_batch(ctx, problem, l, extra[l], &stream, slots,
+                               num_threads, &moments[l]) != 0) {
+                mco_free(slots);
+                return -1;
+            }
+            paths[l] += extra[l];
+            extra[l] = 0;
+        }
+        if (!pending) break;
+
+        /* Level statistics */
+        for (size_t l = 0; l < num_levels; ++l) {
+            mean[l] = fabs(mlmc_moments_mean(&moments[l]));
+            var[l] = mlmc_moments_variance(&moments[l]);
+        }
+
+        /* Fitted decay rates, floored so a noisy fit cannot stall */
+        alpha = fmax(mlmc_decay_rate(mean, num_levels), 0.5);
+        beta = fmax(mlmc_decay_rate(var, num_levels), 0.5);
+
+        /* Guard against a level whose sample mean/variance is ~0 by chance */
+        for (size_t l = 2; l < num_levels; ++l) {
+            mean[l] = fmax(mean[l], 0.5 * mean[l - 1] / pow(2.0, alpha));
+            var[l] = fmax(var[l], 0.5 * var[l - 1] / pow(2.0, beta));
+        }
+
+        for (int add_level = 1; add_level; ) {
+            add_level = 0;
+
+            /* Optimal paths per level */
+            double sum_vc = 0.0;
+            for (size_t l = 0; l < num_levels; ++l) {
+                sum_vc += sqrt(var[l] * cost[l]);
+            }
+
+            int settled = 1;
+            for (size_t l = 0; l < num_levels; ++l) {
+                double target = ceil(2.0 / eps2 * sqrt(var[l] / cost[l]) * sum_vc);
+                uint64_t want = (target > 0.0) ? (uint64_t)target : 0;
+                extra[l] = (want > paths[l]) ? want - paths[l] : 0;
+                if ((double)extra[l] > 0.01 * (double)paths[l]) settled = 0;
+            }
+
+            /* Near convergence: test the weak error */
+            if (settled) {
+                size_t last = num_levels - 1;
+                double rate = pow(2.0, alpha);
+                bias = fmax(mean[last], mean[last - 1] / rate) / (rate - 1.0);
+
+                /* Past the cap the bias stays as estimated (mco_mlmc_asian doc) */
+                if (bias > target_rmse * M_SQRT1_2 && num_levels < MCO_MLMC_MAX_LEVELS) {
+                    var[num_levels] = var[last] / pow(2.0, beta);
+                    mean[num_levels] = mean[last] / rate;
+                    num_levels++;
+                    add_level = 1;
+                }
+            }
+        }
+    }
+
+    mco_free(slots);
+
+    /* Assemble the estimate from the level moments */
+    double estimate = 0.0;
+    double variance = 0.0;
+    double total_cost = 0.0;
+
+    result->num_levels = num_levels;
+    for (size_t l = 0; l < num_levels; ++l) {
+        double n = (double)paths[l];
+        double m = mlmc_moments_mean(&moments[l]);
+        double v = mlmc_moments_variance(&moments[l]);
+
+        result->paths[l] = paths[l];
+        result->mean[l] = m;
+        result->variance[l] = v;
+        result->cost[l] = cost[l];
+
+        estimate += m;
+        variance += v / n;
+        total_cost += n * cost[l];
+    }
+
+    result->estimate = estimate;
+    result->std_error = sqrt(variance);
+    result->bias = bias;
+    result->total_cost = total_cost;
+
+    ctx->last_std_error = result->std_error;
+
+    return 0;
+}
+
+/*============================================================================
+ * GBM Path Payoffs
+ *============================================================================*/
+
+typedef enum {
+    MLMC_ASIAN,
+    MLMC_LOOKBACK,
+    MLMC_BARRIER
+} mlmc_gbm_payoff;
+
+typedef struct {
+    mlmc_gbm_payoff kind;
+    double spot;
+    double strike;
+    double barrier;
+    double rebate;
+    double rate;
+    double volatility;
+    double time;
+    mco_option_type option_type;
+    mco_barrier_style barrier_type;
+    int floating_strike;
+
+    /* Set by mlmc_gbm_price before sampling */
+    double discount;
+    mco_gbm_path steps[MCO_MLMC_MAX_LEVELS];    /* BASE_STEPS · 2ˡ steps */
+} mlmc_gbm_problem;
+
+/*
+ * Discounted payoff of one discretised path.
+ *
+ * Each payoff converges to its continuously monitored value as the
+ * step shrinks:
+ *   Asian    - trapezoidal time average of S
+ *   Lookback - the path's Brownian-bridge extremum, sampled exactly per
+ *              step by the caller (the side the payoff needs)
+ *   Barrier  - Brownian-bridge survival probability Π(1 - pᵢ), used as
+ *              a conditional expectation rather than sampled, which
+ *              keeps the fine - coarse difference smooth
+ */
+static double mlmc_gbm_payoff_eval(const mlmc_gbm_problem *p, const double *path,
+                                   size_t n, double dt, double extremum)
+{
+    double discount = p->discount;
+    double terminal = path[n];
+
+    switch (p->kind) {
+        case MLMC_ASIAN: {
+            double sum = 0.5 * (path[0] + path[n]);
+            for (size_t i = 1; i < n; ++i) {
+                sum += path[i];
+            }
+            return discount * mco_payoff(sum / (double)n, p->strike, p->option_type);
+        }
+
+        case MLMC_LOOKBACK: {
+            /* extremum is the minimum for floating calls and fixed puts */
+            double payoff;
+            if (p->floating_strike) {
+                payoff = (p->option_type == MCO_CALL) ? terminal - extremum
+                                                      : extremum - terminal;
+            } else {
+                payoff = (p->option_type == MCO_CALL) ? fmax(extremum - p->strike, 0.0)
+                                                      : fmax(p->strike - extremum, 0.0);
+            }
+            return discount * payoff;
+        }
+
+        case MLMC_BARRIER: {
+            int is_up = (p->barrier_type == MCO_BARRIER_UP_IN
+                         || p->barrier_type == MCO_BARRIER_UP_OUT);
+            int is_knock_in = (p->barrier_type == MCO_BARRIER_DOWN_IN
+                               || p->barrier_type == MCO_BARRIER_UP_IN);
+
+            double survival = 1.0;
+            for (size_t i = 0; i < n && survival > 0.0; ++i) {
+                survival *= 1.0 - mco_barrier_bridge_hit_prob(path[i], path[i + 1],
+                                                              p->barrier, p->volatility,
+                                                              dt, is_up);
+            }
+
+            double vanilla = mco_payoff(terminal, p->strike, p->option_type);
+            double payoff = is_knock_in
+                          ? vanilla * (1.0 - survival)
+                          : vanilla * survival + p->rebate * (1.0 - survival);
+            return discount * payoff;
+        }
+    }
+
+    return 0.0;
+}
+
+/*
+ * Extremum of the log-Brownian bridge from x0 to x1 with variance v =
+ * σ²Δt: P(max ≥ m) = exp(-2(m - x0)(m - x1)/v), inverted at u in (0, 1].
+ */
+static double mlmc_bridge_extremum(double x0, double x1, double variance, double u,
+                                   int upper)
+{
+    double dx = x1 - x0;
+    double half_root = 0.5 * sqrt(dx * dx - 2.0 * variance * log(u));
+    return upper ? 0.5 * (x0 + x1) + half_root : 0.5 * (x0 + x1) - half_root;
+}
+
+/*
+ * Coupled GBM level sample: the coarse path takes one step per pair of
+ * fine steps, driven by the pair's summed increment.
+ *
+ * Lookbacks draw the bridge extremum of every fine step (one uniform
+ * each). The coarse bridge across a pair is sampled as the extremum of
+ * its two fine bridges - the fine midpoint is itself a draw from the
+ * coarse bridge - so both levels share the extremum and differ only in
+ * S(T). Every level is then the continuously monitored contract.
+ */
+static double mlmc_gbm_sample(const void *arg, size_t level, mco_rng *rng,
+                              double *scratch)
+{
+    const mlmc_gbm_problem *p = (const mlmc_gbm_problem *)arg;
+    size_t nf = (size_t)MCO_MLMC_BASE_STEPS << level;
+    double *fine = scratch;
+
+    const mco_gbm_path *fine_model = &p->steps[level];
+    fine[0] = p->spot;
+
+    /* Lookback: running log-extremum, the side the payoff needs */
+    int bridge = p->kind == MLMC_LOOKBACK;
+    int upper = (p->option_type == MCO_CALL) != (p->floating_strike != 0);
+    double variance = fine_model->diffusion_dt * fine_model->diffusion_dt;
+    double x_prev = bridge ? log(p->spot) : 0.0;
+    double ext = x_prev;
+
+    if (level == 0) {
+        for (size_t i = 0; i < nf; ++i) {
+            fine[i + 1] = mco_gbm_step(fine_model, fine[i], mco_rng_normal(rng));
+            if (bridge) {
+                double x = log(fine[i + 1]);
+                double m = mlmc_bridge_extremum(x_prev, x, variance,
+                                                1.0 - mco_rng_uniform(rng), upper);
+                ext = upper ? fmax(ext, m) : fmin(ext, m);
+                x_prev = x;
+            }
+        }
+        return mlmc_gbm_payoff_eval(p, fine, nf, fine_model->dt, exp(ext));
+    }
+
+    size_t nc = nf / 2;
+    double *coarse = scratch + nf + 1;
+
+    const mco_gbm_path *coarse_model = &p->steps[level - 1];
+    coarse[0] = p->spot;
+
+    for (size_t i = 0; i < nc; ++i) {
+        double z1 = mco_rng_normal(rng);
+        double z2 = mco_rng_normal(rng);
+        fine[2 * i + 1] = mco_gbm_step(fine_model, fine[2 * i], z1);
+        fine[2 * i + 2] = mco_gbm_step(fine_model, fine[2 * i + 1], z2);
+        coarse[i + 1] = mco_gbm_step(coarse_model, coarse[i], (z1 + z2) * M_SQRT1_2);
+
+        if (bridge) {
+            double x_mid = log(fine[2 * i + 1]);
+            double x_end = log(fine[2 * i + 2]);
+            double m1 = mlmc_bridge_extremum(x_prev, x_mid, variance,
+                                             1.0 - mco_rng_uniform(rng), upper);
+            double m2 = mlmc_bridge_extremum(x_mid, x_end, variance,
+                                             1.0 - mco_rng_uniform(rng), upper);
+            ext = upper ? fmax(ext, fmax(m1, m2)) : fmin(ext, fmin(m1, m2));
+            x_prev = x_end;
+        }
+    }
+
+    double extremum = exp(ext);
+    return mlmc_gbm_payoff_eval(p, fine, nf, fine_model->dt, extremum)
+         - mlmc_gbm_payoff_eval(p, coarse, nc, coarse_model->dt, extremum);
+}
+
+static double mlmc_gbm_price(mco_ctx *ctx, mlmc_gbm_problem *p,
+                             double target_rmse)
+{
+    /* A floating-strike lookback has no strike */
+    int has_strike = !(p->kind == MLMC_LOOKBACK && p->floating_strike);
+
+    if (p->spot <= 0.0 || p->volatility < 0.0 || p->time <= 0.0
+        || (has_strike && p->strike <= 0.0)
+        || (p->kind == MLMC_BARRIER && p->barrier <= 0.0)) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
+
+    /* Step constants of every level, shared by the samples of all threads */
+    p->discount = exp(-p->rate * p->time);
+    for (size_t l = 0; l < MCO_MLMC_MAX_LEVELS; ++l) {
+        mco_gbm_path_init(&p->steps[l], p->spot, p->rate, p->volatility, p->time,
+                          (size_t)MCO_MLMC_BASE_STEPS << l);
+    }
+
+    mco_mlmc_problem problem = {
+        .sample           = mlmc_gbm_sample,
+        .problem          = p,
+        .base_steps       = MCO_MLMC_BASE_STEPS,
+        .scratch_per_step = 2       /* Fine path + coarse path */
+    };
+
+    mco_mlmc_result result;
+    if (mco_mlmc_run(ctx, &problem, target_rmse, &result) != 0) {
+        return 0.0;
+    }
+    return result.estimate;
+}
+
+/*============================================================================
+ * Heston European
+ *============================================================================*/
+
+typedef struct {
+    double spot;
+    double strike;
+    double rate;
+    double time;
+    double v0;
+    double kappa;
+    double theta;
+    double sigma;
+    double rho;
+    mco_option_type option_type;
+
+    /* Set by mco_mlmc_heston_european before sampling */
+    mco_heston_path steps[MCO_MLMC_MAX_LEVELS];
+} mlmc_heston_problem;
+
+/*
+ * Coupled Heston level sample (full-truncation Euler). Both correlated
+ * increments of the coarse step are the scaled sums of the fine pair,
+ * which preserves their correlation.
+ */
+static double mlmc_heston_sample(const void *arg, size_t level, mco_rng *rng,
+                                 double *scratch)
+{
+    const mlmc_heston_problem *p = (const mlmc_heston_problem *)arg;
+    size_t nf = (size_t)MCO_MLMC_BASE_STEPS << level;
+    (void)scratch;
+
+    const mco_heston_path *fine_model = &p->steps[level];
+
+    double s_f = p->spot;
+    double v_f = p->v0;
+
+    if (level == 0) {
+        for (size_t i = 0; i < nf; ++i) {
+            double w1, w2;
+            mco_heston_correlated_normals(rng, p->rho, fine_model->sqrt_rho, &w1, &w2);
+            mco_heston_step_euler(fine_model, &s_f, &v_f, w1, w2);
+        }
+        return fine_model->discount * mco_payoff(s_f, p->strike, p->option_type);
+    }
+
+    size_t nc = nf / 2;
+    const mco_heston_path *coarse_model = &p->steps[level - 1];
+
+    double s_c = p->spot;
+    double v_c = p->v0;
+
+    for (size_t i = 0; i < nc; ++i) {
+        double w1a, w2a, w1b, w2b;
+        mco_heston_correlated_normals(rng, p->rho, fine_model->sqrt_rho, &w1a, &w2a);
+        mco_heston_correlated_normals(rng, p->rho, fine_model->sqrt_rho, &w1b, &w2b);
+
+        mco_heston_step_euler(fine_model, &s_f, &v_f, w1a, w2a);
+        mco_heston_step_euler(fine_model, &s_f, &v_f, w1b, w2b);
+        mco_heston_step_euler(coarse_model, &s_c, &v_c,
+                              (w1a + w1b) * M_SQRT1_2, (w2a + w2b) * M_SQRT1_2);
+    }
+
+    return fine_model->discount * (mco_payoff(s_f, p->strike, p->option_type)
+                                   - mco_payoff(s_c, p->strike, p->option_type));
+}
+
+/*============================================================================
+ * Public API
+ *============================================================================*/
+
+double mco_mlmc_asian(mco_ctx *ctx,
+                      double spot,
+                      double strike,
+                      double rate,
+                      double volatility,
+                      double time,
+                      mco_option_type type,
+                      double target_rmse)
+{
+    if (!ctx) return 0.0;
+
+    mlmc_gbm_problem p = {
+        .kind        = MLMC_ASIAN,
+        .spot        = spot,
+        .strike      = strike,
+        .rate        = rate,
+        .volatility  = volatility,
+        .time        = time,
+        .option_type = type
+    };
+    return mlmc_gbm_price(ctx, &p, target_rmse);
+}
+
+double mco_mlmc_lookback(mco_ctx *ctx,
+                         double spot,
+                         double strike,
+                         double rate,
+                         double volatility,
+                         double time,
+                         int floating_strike,
+                         mco_option_type type,
+                         double target_rmse)
+{
+    if (!ctx) return 0.0;
+
+    mlmc_gbm_problem p = {
+        .kind            = MLMC_LOOKBACK,
+        .spot            = spot,
+        .strike          = strike,
+        .rate            = rate,
+        .volatility      = volatility,
+        .time            = time,
+        .option_type     = type,
+        .floating_strike = floating_strike ? 1 : 0
+    };
+    return mlmc_gbm_price(ctx, &p, target_rmse);
+}
+
+double mco_mlmc_barrier(mco_ctx *ctx,
+                        double spot,
+                        double strike,
+                        double barrier,
+                        double rebate,
+                        double rate,
+                        double volatility,
+                        double time,
+                        mco_barrier_style barrier_type,
+                        mco_option_type type,
+                        double target_rmse)
+{
+    if (!ctx) return 0.0;
+
+    mlmc_gbm_problem p = {
+        .kind         = MLMC_BARRIER,
+        .spot         = spot,
+        .strike       = strike,
+        .barrier      = barrier,
+        .rebate       = rebate,
+        .rate         = rate,
+        .volatility   = volatility,
+        .time         = time,
+        .option_type  = type,
+        .barrier_type = barrier_type
+    };
+    return mlmc_gbm_price(ctx, &p, target_rmse);
+}
+
+double mco_mlmc_heston_european(mco_ctx *ctx,
+                                double spot,
+                                double strike,
+                                double rate,
+                                double time,
+                                double v0,
+                                double kappa,
+                                double theta,
+                                double sigma,
+                                double rho,
+                                mco_option_type type,
+                                double target_rmse)
+{
+    if (!ctx) return 0.0;
+
+    if (spot <= 0.0 || strike <= 0.0 || time <= 0.0 || v0 < 0.0 || sigma < 0.0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
+
+    mlmc_heston_problem p = {
+        .spot        = spot,
+        .strike      = strike,
+        .rate        = rate,
+        .time        = time,
+        .v0          = v0,
+        .kappa       = kappa,
+        .theta       = theta,
+        .sigma       = sigma,
+        .rho         = rho,
+        .option_type = type
+    };
+    for (size_t l = 0; l < MCO_MLMC_MAX_LEVELS; ++l) {
+        mco_heston_path_init(&p.steps[l], spot, v0, kappa, theta, sigma, rho, rate, time,
+                             (size_t)MCO_MLMC_BASE_STEPS << l);
+    }
+
+    mco_mlmc_problem problem = {
+        .sample           = mlmc_heston_sample,
+        .problem          = &p,
+        .base_steps       = MCO_MLMC_BASE_STEPS,
+        .scratch_per_step = 0
+    };
+
+    mco_mlmc_result result;
+    if (mco_mlmc_run(ctx, &problem, target_rmse, &result) != 0) {
+        return 0.0;
+    }
+    return result.estimate;
+}
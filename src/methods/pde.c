@@ -0,0 +1,516 @@
+/*
+ * Crank-Nicolson Implementation
+ *
+ * Non-uniform spot grids, Rannacher start-up and Thomas sweeps
+ * vectorised across a block of contracts.
+ */
+
+#include "internal/methods/pde.h"
+#include "internal/methods/kernels.h"
+#include "internal/allocator.h"
+#include <math.h>
+#include <string.h>
+
+/* Grid concentration width, in units of B·σ√T around each point B */
+#define MCO_PDE_CONCENTRATION 0.25
+
+/*============================================================================
+ * Setup
+ *============================================================================*/
+
+void mco_pde_spec_init(mco_pde_spec *spec,
+                       const mco_ctx *ctx,
+                       mco_pde_payoff payoff,
+                       mco_option_type type)
+{
+    spec->payoff = payoff;
+    spec->type = type;
+    spec->american = 0;
+    spec->exercise_times = NULL;
+    spec->num_exercise = 0;
+    spec->space_nodes = ctx->pde_space_nodes;
+    spec->time_steps = ctx->pde_time_steps;
+    spec->cpu_level = (mco_cpu_level)ctx->cpu_level;
+}
+
+int mco_pde_contract_valid(const mco_pde_contract *c)
+{
+    if (!(c->spot > 0.0 && c->strike > 0.0 && c->volatility > 0.0 && c->time > 0.0)) {
+        return 0;
+    }
+    if (c->lower_barrier > 0.0 && !(c->spot > c->lower_barrier)) return 0;
+    if (c->upper_barrier > 0.0 && !(c->spot < c->upper_barrier)) return 0;
+    return 1;
+}
+
+/*============================================================================
+ * Grid
+ *============================================================================*/
+
+/*
+ * ξ(S) = Σₖ asinh((S - Bₖ)/αₖ), strictly increasing
+ */
+typedef struct {
+    double point[3];
+    double width[3];
+    size_t count;
+} grid_map;
+
+static double grid_xi(const grid_map *g, double s, double *slope)
+{
+    double xi = 0.0;
+    double d = 0.0;
+    for (size_t k = 0; k < g->count; ++k) {
+        double u = (s - g->point[k]) / g->width[k];
+        double root = sqrt(1.0 + u * u);
+        xi += (u < 0.0) ? -log(root - u) : log(root + u);
+        d += 1.0 / (g->width[k] * root);
+    }
+    *slope = d;
+    return xi;
+}
+
+static void grid_add(grid_map *g, double point, double spread)
+{
+    g->point[g->count] = point;
+    g->width[g->count] = MCO_PDE_CONCENTRATION * point * spread;
+    g->count++;
+}
+
+/*
+ * Nodes of one contract into nodes[i·stride], i < n. Returns the index
+ * of the node moved onto the strike, or n if the strike is off the grid.
+ */
+static size_t grid_build(const mco_pde_contract *c, size_t n, double *nodes, size_t stride)
+{
+    double spread = c->volatility * sqrt(c->time);
+    double lo = (c->lower_barrier > 0.0) ? c->lower_barrier : 0.0;
+    double hi = c->upper_barrier;
+    if (!(hi > 0.0)) {
+        double base = (c->spot > c->strike) ? c->spot : c->strike;
+        hi = base * exp(fabs(c->rate) * c->time + MCO_PDE_STDDEVS * spread);
+    }
+
+    grid_map g = { {0.0}, {0.0}, 0 };
+    int strike_inside = c->strike > lo && c->strike < hi;
+    if (strike_inside) grid_add(&g, c->strike, spread);
+    if (c->lower_barrier > 0.0) grid_add(&g, c->lower_barrier, spread);
+    if (c->upper_barrier > 0.0) grid_add(&g, c->upper_barrier, spread);
+    if (g.count == 0) grid_add(&g, c->spot, spread);
+
+    double slope;
+    double xi_lo = grid_xi(&g, lo, &slope);
+    double xi_hi = grid_xi(&g, hi, &slope);
+
+    nodes[0] = lo;
+    nodes[(n - 1) * stride] = hi;
+
+    /* One point inverts in closed form, S = B + α·sinh(ξ) */
+    if (g.count == 1) {
+        for (size_t i = 1; i + 1 < n; ++i) {
+            double xi = xi_lo + (xi_hi - xi_lo) * (double)i / (double)(n - 1);
+            nodes[i * stride] = g.point[0] + g.width[0] * sinh(xi);
+        }
+    }
+
+    /*
+     * Otherwise invert ξ at uniform targets by safeguarded Newton, starting from
+     * the last node plus the last spacing (the spacing varies slowly, so
+     * this is a few iterations from the root).
+     */
+    double prev = lo;
+    double s = lo;
+    for (size_t i = 1; i + 1 < n && g.count > 1; ++i) {
+        double target = xi_lo + (xi_hi - xi_lo) * (double)i / (double)(n - 1);
+        double a = s;
+        double b = hi;
+        double x = s + (s - prev);
+        if (!(x > a && x < b)) x = s;
+        for (int iter = 0; iter < 100; ++iter) {
+            double f = grid_xi(&g, x, &slope) - target;
+            if (f < 0.0) a = x; else b = x;
+            double next = x - f / slope;
+            if (!(next > a && next < b)) next = 0.5 * (a + b);
+            double step = fabs(next - x);
+            x = next;
+            if (step <= 1e-12 * hi) break;
+        }
+        prev = s;
+        s = x;
+        nodes[i * stride] = s;
+    }
+
+    if (!strike_inside) return n;
+
+    /* Put the payoff kink (or jump) on a node */
+    size_t k = 1;
+    for (size_t i = 2; i + 1 < n; ++i) {
+        if (fabs(nodes[i * stride] - c->strike) < fabs(nodes[k * stride] - c->strike)) k = i;
+    }
+    nodes[k * stride] = c->strike;
+    return k;
+}
+
+/*
+ * Quadratic through nodes i-1, i, i+1 evaluated at x: weights for the
+ * value, first and second derivative.
+ */
+typedef struct {
+    size_t index;
+    double value[3];
+    double first[3];
+    double second[3];
+} grid_interp;
+
+static void grid_interp_init(grid_interp *gi, const double *nodes, size_t n,
+                             size_t stride, double x)
+{
+    size_t lo = 0;
+    size_t hi = n - 1;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (nodes[mid * stride] <= x) lo = mid; else hi = mid;
+    }
+    size_t i = (x - nodes[lo * stride] < nodes[hi * stride] - x) ? lo : hi;
+    if (i < 1) i = 1;
+    if (i > n - 2) i = n - 2;
+
+    double x0 = nodes[(i - 1) * stride];
+    double x1 = nodes[i * stride];
+    double x2 = nodes[(i + 1) * stride];
+    double den[3] = { (x0 - x1) * (x0 - x2), (x1 - x0) * (x1 - x2), (x2 - x0) * (x2 - x1) };
+    double other[3][2] = { { x1, x2 }, { x0, x2 }, { x0, x1 } };
+
+    gi->index = i;
+    for (int k = 0; k < 3; ++k) {
+        double p = x - other[k][0];
+        double q = x - other[k][1];
+        gi->value[k] = p * q / den[k];
+        gi->first[k] = (p + q) / den[k];
+        gi->second[k] = 2.0 / den[k];
+    }
+}
+
+/*============================================================================
+ * Block Solver
+ *============================================================================*/
+
+/*
+ * Dirichlet edge value c0 + c1·e^(-rτ)
+ */
+typedef struct {
+    double c0;
+    double c1;
+} pde_edge;
+
+static double terminal_value(const mco_pde_spec *spec, double s, double strike, double payout)
+{
+    double phi = (spec->type == MCO_CALL) ? 1.0 : -1.0;
+    int in_money = phi * (s - strike) > 0.0;
+
+    switch (spec->payoff) {
+        case MCO_PDE_CASH:  return in_money ? payout : 0.0;
+        case MCO_PDE_ASSET: return in_money ? s : 0.0;
+        case MCO_PDE_VANILLA:
+        default:            return mco_payoff(s, strike, spec->type);
+    }
+}
+
+/*
+ * Far-field value as S → ∞: discounted forward payoff for calls, 0 for
+ * puts.
+ */
+static pde_edge far_edge(const mco_pde_spec *spec, double s_max, double strike, double payout)
+{
+    if (spec->type == MCO_PUT) return (pde_edge){ 0.0, 0.0 };
+
+    switch (spec->payoff) {
+        case MCO_PDE_CASH:  return (pde_edge){ 0.0, payout };
+        case MCO_PDE_ASSET: return (pde_edge){ s_max, 0.0 };
+        case MCO_PDE_VANILLA:
+        default:            return (pde_edge){ s_max, -strike };
+    }
+}
+
+/*
+ * Grid, operator, factorisation, payoff and edges for lane j.
+ */
+static void setup_lane(const mco_pde_spec *spec, const mco_pde_contract *c, size_t n,
+                       double dt, mco_pde_block *blk, size_t B, size_t j, pde_edge *lower,
+                       int *lower_fixed, pde_edge *upper, grid_interp *gi)
+{
+    double *nodes = blk->nodes + j;
+    size_t strike_node = grid_build(c, n, nodes, B);
+
+    double r = c->rate;
+    double var = c->volatility * c->volatility;
+    double half_dt = 0.5 * dt;
+
+    /* Interior rows: three-point non-uniform differences */
+    for (size_t i = 1; i + 1 < n; ++i) {
+        double s = nodes[i * B];
+        double hm = s - nodes[(i - 1) * B];
+        double hp = nodes[(i + 1) * B] - s;
+        double diff = var * s * s;
+        double a = (diff - r * s * hp) / (hm * (hm + hp));
+        double cc = (diff + r * s * hm) / (hp * (hm + hp));
+        double b = (-diff + r * s * (hp - hm)) / (hm * hp) - r;
+        blk->ha[i * B + j] = half_dt * a;
+        blk->hb[i * B + j] = half_dt * b;
+        blk->hc[i * B + j] = half_dt * cc;
+    }
+
+    /* Lower edge: knock-out rebate, or the S = 0 row V_τ = -rV */
+    *lower_fixed = c->lower_barrier > 0.0;
+    *lower = (pde_edge){ 0.0, *lower_fixed ? c->rebate : 0.0 };
+    blk->ha[j] = 0.0;
+    blk->hb[j] = *lower_fixed ? 0.0 : -half_dt * r;
+    blk->hc[j] = 0.0;
+
+    /* Upper edge: knock-out rebate or far field */
+    double s_max = nodes[(n - 1) * B];
+    *upper = (c->upper_barrier > 0.0) ? (pde_edge){ 0.0, c->rebate }
+                                      : far_edge(spec, s_max, c->strike, c->payout);
+    blk->ha[(n - 1) * B + j] = 0.0;
+    blk->hb[(n - 1) * B + j] = 0.0;
+    blk->hc[(n - 1) * B + j] = 0.0;
+
+    /*
+     * Thomas elimination of I - ½Δτ·L, fixed for the whole solve. Puts
+     * eliminate from the top down and substitute upwards, so the
+     * substitution starts on their exercise side (see block_step).
+     */
+    if (spec->type == MCO_PUT) {
+        size_t top = (n - 1) * B + j;
+        blk->cp[top] = 0.0;
+        blk->w[top] = 1.0;
+        for (size_t i = n - 1; i-- > 0; ) {
+            size_t e = i * B + j;
+            double pivot = 1.0 - blk->hb[e] + blk->hc[e] * blk->cp[e + B];
+            blk->w[e] = 1.0 / pivot;
+            blk->cp[e] = -blk->ha[e] * blk->w[e];
+        }
+    } else {
+        blk->cp[j] = 0.0;
+        blk->w[j] = 1.0 / (1.0 - blk->hb[j]);
+        for (size_t i = 1; i < n; ++i) {
+            size_t e = i * B + j;
+            double pivot = 1.0 - blk->hb[e] + blk->ha[e] * blk->cp[e - B];
+            blk->w[e] = 1.0 / pivot;
+            blk->cp[e] = -blk->hc[e] * blk->w[e];
+        }
+    }
+
+    /* Payoff; a digital's jump takes its midpoint on the strike node */
+    for (size_t i = 0; i < n; ++i) {
+        blk->values[i * B + j] = terminal_value(spec, nodes[i * B], c->strike, c->payout);
+    }
+    if (strike_node < n && spec->payoff != MCO_PDE_VANILLA) {
+        double jump = (spec->payoff == MCO_PDE_CASH) ? c->payout : c->strike;
+        blk->values[strike_node * B + j] = 0.5 * jump;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        blk->exercise[i * B + j] = blk->values[i * B + j];
+    }
+    if (*lower_fixed) blk->values[j] = lower->c0 + lower->c1;
+    blk->values[(n - 1) * B + j] = upper->c0 + upper->c1;
+
+    grid_interp_init(gi, nodes, n, B, c->spot);
+}
+
+static void lane_exercise(mco_pde_block *blk, size_t n, size_t B, size_t j)
+{
+    for (size_t i = 0; i < n; ++i) {
+        size_t e = i * B + j;
+        if (blk->exercise[e] > blk->values[e]) blk->values[e] = blk->exercise[e];
+    }
+}
+
+static double lane_eval(const mco_pde_block *blk, const grid_interp *gi,
+                        const double *weights, size_t B, size_t j)
+{
+    const double *v = blk->values + (gi->index - 1) * B + j;
+    return weights[0] * v[0]
+         + weights[1] * v[B]
+         + weights[2] * v[2 * B];
+}
+
+/*
+ * Solve contracts[idx[0..count)] in lanes of a block of the given width
+ * (count ≤ width ≤ MCO_PDE_BLOCK). Unused lanes repeat the first
+ * contract. Called with constant widths, so each is compiled with
+ * fixed-length inner loops.
+ */
+static inline void solve_block(const mco_pde_spec *spec, const mco_pde_contract *contracts,
+                               const size_t *idx, size_t count, size_t n, size_t steps,
+                               mco_pde_block *blk, size_t B, unsigned char *allow,
+                               const mco_kernels *kernels, mco_pde_result *out)
+{
+    mco_pde_step_fn step = (B == MCO_PDE_BLOCK) ? kernels->pde_step : kernels->pde_step_lane;
+    double dt[MCO_PDE_BLOCK];
+    double rate[MCO_PDE_BLOCK];
+    pde_edge lower[MCO_PDE_BLOCK];
+    pde_edge upper[MCO_PDE_BLOCK];
+    int lower_fixed[MCO_PDE_BLOCK];
+    grid_interp gi[MCO_PDE_BLOCK];
+
+    for (size_t j = 0; j < B; ++j) {
+        const mco_pde_contract *c = &contracts[idx[j < count ? j : 0]];
+        dt[j] = c->time / (double)steps;
+        rate[j] = c->rate;
+        setup_lane(spec, c, n, dt[j], blk, B, j, &lower[j], &lower_fixed[j], &upper[j], &gi[j]);
+    }
+
+    /* Bermudan: exercise after the step nearest each date, τ = T - t */
+    int bermudan = spec->exercise_times != NULL;
+    if (bermudan) {
+        memset(allow, 0, (steps + 1) * B);
+        for (size_t j = 0; j < B; ++j) {
+            const mco_pde_contract *c = &contracts[idx[j < count ? j : 0]];
+            for (size_t k = 0; k < spec->num_exercise; ++k) {
+                double level = floor((c->time - spec->exercise_times[k]) / dt[j] + 0.5);
+                if (level < 0.0) level = 0.0;
+                allow[(level < (double)steps ? (size_t)level : steps) * B + j] = 1;
+            }
+        }
+    }
+
+    int downward = spec->type == MCO_PUT;
+    int american = spec->american && !bermudan;
+    size_t rannacher = (steps < MCO_PDE_RANNACHER_STEPS) ? steps : MCO_PDE_RANNACHER_STEPS;
+    double prev[MCO_PDE_BLOCK] = { 0 };
+    double lower_bv[MCO_PDE_BLOCK];
+    double upper_bv[MCO_PDE_BLOCK];
+
+    for (size_t s = 1; s <= steps; ++s) {
+        if (s == steps) {
+            for (size_t j = 0; j < B; ++j) prev[j] = lane_eval(blk, &gi[j], gi[j].value, B, j);
+        }
+
+        int halves = s <= rannacher;
+        for (int h = halves ? 1 : 2; h <= 2; ++h) {
+            for (size_t j = 0; j < B; ++j) {
+                double tau = ((double)(s - 1) + 0.5 * (double)h) * dt[j];
+                double df = exp(-rate[j] * tau);
+                lower_bv[j] = lower[j].c0 + lower[j].c1 * df;
+                upper_bv[j] = upper[j].c0 + upper[j].c1 * df;
+            }
+            step(blk, n, downward, halves ? 0.0 : 1.0, american,
+                 lower_bv, lower_fixed, upper_bv);
+        }
+
+        if (bermudan) {
+            for (size_t j = 0; j < B; ++j) {
+                if (allow[s * B + j]) lane_exercise(blk, n, B, j);
+            }
+        }
+    }
+
+    for (size_t j = 0; j < count; ++j) {
+        mco_pde_result *res = &out[idx[j]];
+        res->price = lane_eval(blk, &gi[j], gi[j].value, B, j);
+        res->delta = lane_eval(blk, &gi[j], gi[j].first, B, j);
+        res->gamma = lane_eval(blk, &gi[j], gi[j].second, B, j);
+        res->theta = (prev[j] - res->price) / dt[j];
+    }
+}
+
+/*============================================================================
+ * Pricing
+ *============================================================================*/
+
+int mco_pde_solve(const mco_pde_spec *spec,
+                  const mco_pde_contract *contracts,
+                  size_t n,
+                  mco_pde_result *out)
+{
+    const size_t B = MCO_PDE_BLOCK;
+    const mco_kernels *kernels = mco_kernels_get(spec->cpu_level);
+    size_t nodes = spec->space_nodes < 5 ? 5 : spec->space_nodes;
+    size_t steps = spec->time_steps < 1 ? 1 : spec->time_steps;
+    size_t lane = nodes * B;
+
+    double *buf = (double *)mco_malloc(9 * lane * sizeof(double));
+    unsigned char *allow = spec->exercise_times
+                         ? (unsigned char *)mco_malloc((steps + 1) * B) : NULL;
+    if (!buf || (spec->exercise_times && !allow)) {
+        mco_free(buf);
+        mco_free(allow);
+        return -1;
+    }
+
+    mco_pde_block blk = {
+        buf, buf + lane, buf + 2 * lane, buf + 3 * lane, buf + 4 * lane,
+        buf + 5 * lane, buf + 6 * lane, buf + 7 * lane, buf + 8 * lane
+    };
+
+    /* Gather valid contracts into full blocks */
+    size_t idx[MCO_PDE_BLOCK];
+    size_t count = 0;
+    for (size_t k = 0; k < n; ++k) {
+        if (!mco_pde_contract_valid(&contracts[k])) {
+            out[k] = (mco_pde_result){ 0.0, 0.0, 0.0, 0.0 };
+            continue;
+        }
+        idx[count++] = k;
+        if (count == B) {
+            solve_block(spec, contracts, idx, count, nodes, steps, &blk, MCO_PDE_BLOCK, allow, kernels, out);
+            count = 0;
+        }
+    }
+
+    /*
+     * A padded block costs about as much as MCO_PDE_BLOCK/4 single
+     * solves; below that the remainder goes one contract at a time.
+     */
+    if (count >= MCO_PDE_BLOCK / 4) {
+        solve_block(spec, contracts, idx, count, nodes, steps, &blk, MCO_PDE_BLOCK, allow, kernels, out);
+    } else {
+        for (size_t j = 0; j < count; ++j) {
+            solve_block(spec, contracts, &idx[j], 1, nodes, steps, &blk, 1, allow, kernels, out);
+        }
+    }
+
+    mco_free(buf);
+    mco_free(allow);
+    return 0;
+}
+
+mco_pde_contract *mco_pde_contracts_new(const double *spot,
+                                        const double *strike,
+                                        const double *rate,
+                                        const double *volatility,
+                                        const double *time,
+                                        size_t n)
+{
+    mco_pde_contract *c = (mco_pde_contract *)mco_malloc((n > 0 ? n : 1) * sizeof(*c));
+    if (!c) return NULL;
+
+    for (size_t k = 0; k < n; ++k) {
+        c[k] = (mco_pde_contract){ spot[k], strike[k], rate[k], volatility[k], time[k],
+                                   0.0, 0.0, 0.0, 0.0 };
+    }
+    return c;
+}
+
+void mco_pde_run(mco_ctx *ctx,
+                 const mco_pde_spec *spec,
+                 const mco_pde_contract *contracts,
+                 size_t n,
+                 mco_pde_result *out)
+{
+    for (size_t k = 0; k < n; ++k) {
+        const mco_pde_contract *c = &contracts[k];
+        if (!(c->spot > 0.0 && c->strike > 0.0 && c->volatility > 0.0 && c->time > 0.0)) {
+            ctx->last_error = MCO_ERR_INVALID_ARG;
+            break;
+        }
+    }
+
+    if (mco_pde_solve(spec, contracts, n, out) != 0) {
+        for (size_t k = 0; k < n; ++k) {
+            out[k] = (mco_pde_result){ 0.0, 0.0, 0.0, 0.0 };
+        }
+        ctx->last_error = MCO_ERR_NOMEM;
+    }
+}
@@ -6,6 +6,8 @@
  */
 
 #include "internal/methods/sobol.h"
+#include "internal/methods/kernels.h"
+#include "internal/cpu.h"
 #include <string.h>
 #include <math.h>
 
@@ -183,12 +185,8 @@ void mco_sobol_next(mco_sobol *sobol, double *point)
     int c = rightmost_zero(sobol->count);
 
     /* XOR in the appropriate direction number */
-    double scale = 1.0 / (double)(1ULL << MCO_SOBOL_BITS);
-
-    for (uint32_t d = 0; d < sobol->dim; ++d) {
-        sobol->x[d] ^= sobol->v[d][c];
-        point[d] = (double)sobol->x[d] * scale;
-    }
+    mco_kernels_get(mco_cpu_default_level())->sobol_next(sobol->dim, &sobol->v[0][0], c,
+                                                         sobol->x, point);
 
     sobol->count++;
 }
@@ -219,60 +217,18 @@ void mco_sobol_reset(mco_sobol *sobol)
 double mco_sobol_inv_normal(double u)
 {
     /* Moro's algorithm for inverse normal CDF */
-    static const double a[] = {
-        2.50662823884,
-        -18.61500062529,
-        41.39119773534,
-        -25.44106049637
-    };
-    static const double b[] = {
-        -8.47351093090,
-        23.08336743743,
-        -21.06224101826,
-        3.13082909833
-    };
-    static const double c[] = {
-        0.3374754822726147,
-        0.9761690190917186,
-        0.1607979714918209,
-        0.0276438810333863,
-        0.0038405729373609,
-        0.0003951896511919,
-        0.0000321767881768,
-        0.0000002888167364,
-        0.0000003960315187
-    };
-
     double x = u - 0.5;
-    double r;
-
-    if (fabs(x) < 0.42) {
-        /* Central region */
-        r = x * x;
-        r = x * (((a[3] * r + a[2]) * r + a[1]) * r + a[0])
-              / ((((b[3] * r + b[2]) * r + b[1]) * r + b[0]) * r + 1.0);
-    } else {
-        /* Tail region */
-        r = (x > 0.0) ? 1.0 - u : u;
-        r = log(-log(r));
-        r = c[0] + r * (c[1] + r * (c[2] + r * (c[3] + r * (c[4]
-            + r * (c[5] + r * (c[6] + r * (c[7] + r * c[8])))))));
-        if (x < 0.0) r = -r;
-    }
-
-    return r;
+    return (fabs(x) < MCO_MORO_CENTRAL) ? mco_moro_central(x) : mco_moro_tail(u, x);
 }
 
 void mco_sobol_next_normal(mco_sobol *sobol, double *normal)
 {
-    double uniform[MCO_SOBOL_MAX_DIM];
-    mco_sobol_next(sobol, uniform);
+    mco_sobol_next(sobol, normal);
 
     for (uint32_t d = 0; d < sobol->dim; ++d) {
         /* Clamp to avoid infinity at 0 and 1 */
-        double u = uniform[d];
-        if (u < 1e-10) u = 1e-10;
-        if (u > 1.0 - 1e-10) u = 1.0 - 1e-10;
-        normal[d] = mco_sobol_inv_normal(u);
+        if (normal[d] < 1e-10) normal[d] = 1e-10;
+        if (normal[d] > 1.0 - 1e-10) normal[d] = 1.0 - 1e-10;
     }
+    mco_kernels_get(mco_cpu_default_level())->inv_normal(normal, sobol->dim);
 }
@@ -5,7 +5,7 @@
  *   - Spawn N threads, each processes 1/N of simulations
  *   - Each thread has its own RNG (jumped from base for reproducibility)
  *   - No locks during simulation - each thread writes to its own slot
- *   - Single reduction at the end to sum partial results
+ *   - Single reduction at the end to merge the partial sums
  *
  * Reproducibility:
  *   - Same seed + same thread count = same results
@@ -16,6 +16,7 @@
 #include "internal/models/gbm.h"
 #include "internal/instruments/payoff.h"
 #include "internal/variance_reduction/antithetic.h"
+#include "internal/variance_reduction/stratified.h"
 #include "internal/allocator.h"
 
 #include <pthread.h>
@@ -44,7 +45,7 @@ void mco_thread_work_init(mco_thread_work *work,
         work[i].rng = rng;
         work[i].start_sim = start;
         work[i].end_sim = start + count;
-        work[i].partial_sum = 0.0;
+        mco_sum_init(&work[i].partial_sum);
         work[i].partial_sum_sq = 0.0;
 
         start += count;
@@ -69,15 +70,38 @@ static void *worker_european_basic(void *arg)
     mco_gbm_init(&model, work->spot, work->rate, work->volatility, 
                  work->time_to_maturity);
 
-    double sum = 0.0;
     mco_option_type type = (mco_option_type)work->option_type;
 
     for (uint64_t i = work->start_sim; i < work->end_sim; ++i) {
         double s_t = mco_gbm_simulate(&model, &work->rng);
-        sum += mco_payoff(s_t, work->strike, type);
+        mco_sum_add(&work->partial_sum, mco_payoff(s_t, work->strike, type));
+    }
+
+    return NULL;
+}
+
+/*
+ * Worker function for European pricing with a stratified terminal normal.
+ *
+ * Strata are global path indices, so this thread's [start, end) range is
+ * also its set of strata and the threads together cover each exactly once.
+ */
+static void *worker_european_stratified(void *arg)
+{
+    mco_thread_work *work = (mco_thread_work *)arg;
+
+    mco_gbm model;
+    mco_gbm_init(&model, work->spot, work->rate, work->volatility,
+                 work->time_to_maturity);
+
+    mco_option_type type = (mco_option_type)work->option_type;
+
+    for (uint64_t i = work->start_sim; i < work->end_sim; ++i) {
+        double z = mco_stratified_normal(&work->rng, i, work->num_strata);
+        double s_t = mco_gbm_terminal(&model, z);
+        mco_sum_add(&work->partial_sum, mco_payoff(s_t, work->strike, type));
     }
 
-    work->partial_sum = sum;
     return NULL;
 }
 
@@ -99,10 +123,9 @@ static void *worker_european_antithetic(void *arg)
     uint64_t num_pairs = n / 2;
     if (num_pairs == 0) num_pairs = 1;
 
-    double sum = mco_antithetic_european_sum(&model, &work->rng, work->strike,
-                                              type, num_pairs);
+    mco_antithetic_european_sum(&model, &work->rng, work->strike, type, num_pairs,
+                                &work->partial_sum);
 
-    work->partial_sum = sum;
     /* Store actual number of paths simulated (2 per pair) */
     work->end_sim = work->start_sim + (2 * num_pairs);
     return NULL;
@@ -151,10 +174,14 @@ double mco_parallel_european(mco_ctx *ctx,
         work[i].time_to_maturity = time_to_maturity;
         work[i].option_type = type;
         work[i].antithetic = ctx->antithetic_enabled;
+        work[i].stratified = ctx->stratified_enabled;
+        work[i].num_strata = total_sims;
     }
 
     /* Select worker function */
-    void *(*worker_fn)(void *) = ctx->antithetic_enabled 
+    void *(*worker_fn)(void *) = ctx->stratified_enabled
+                                  ? worker_european_stratified
+                                  : ctx->antithetic_enabled 
                                   ? worker_european_antithetic 
                                   : worker_european_basic;
 
@@ -178,18 +205,19 @@ double mco_parallel_european(mco_ctx *ctx,
         pthread_join(threads[i], NULL);
     }
 
-    /* Reduce results */
-    double total_sum = 0.0;
+    /* Reduce results, in thread order */
+    mco_sum total_sum;
+    mco_sum_init(&total_sum);
     uint64_t total_paths = 0;
 
     for (uint32_t i = 0; i < num_threads; ++i) {
-        total_sum += work[i].partial_sum;
+        mco_sum_merge(&total_sum, &work[i].partial_sum);
         total_paths += (work[i].end_sim - work[i].start_sim);
     }
 
     /* Calculate discount factor and final price */
     double discount = exp(-rate * time_to_maturity);
-    double price = discount * (total_sum / (double)total_paths);
+    double price = discount * (mco_sum_value(&total_sum) / (double)total_paths);
 
     /* Cleanup */
     mco_free(threads);
@@ -197,3 +225,95 @@ double mco_parallel_european(mco_ctx *ctx,
 
     return price;
 }
+
+/*============================================================================
+ * Generic Parallel Loop
+ *============================================================================*/
+
+typedef struct {
+    mco_parallel_fn fn;
+    void *arg;
+    mco_thread_work *work;
+    uint32_t thread_id;
+} parallel_for_task;
+
+static void *worker_parallel_for(void *arg)
+{
+    parallel_for_task *task = (parallel_for_task *)arg;
+    mco_thread_work *work = task->work;
+
+    task->fn(task->arg, task->thread_id, &work->rng,
+             work->start_sim, work->end_sim);
+    return NULL;
+}
+
+uint32_t mco_parallel_for(mco_ctx *ctx,
+                          uint64_t total_sims,
+                          mco_parallel_fn fn,
+                          void *arg)
+{
+    return mco_parallel_for_rng(ctx, &ctx->rng, total_sims, fn, arg);
+}
+
+uint32_t mco_parallel_for_rng(mco_ctx *ctx,
+                              const mco_rng *base_rng,
+                              uint64_t total_sims,
+                              mco_parallel_fn fn,
+                              void *arg)
+{
+    uint32_t num_threads = ctx->num_threads;
+    if (num_threads == 0) num_threads = 1;
+
+    /* Single-threaded: no pthread overhead */
+    if (num_threads == 1) {
+        mco_rng rng = *base_rng;
+        fn(arg, 0, &rng, 0, total_sims);
+        return 1;
+    }
+
+    mco_thread_work *work = (mco_thread_work *)mco_calloc(num_threads,
+                                                          sizeof(mco_thread_work));
+    parallel_for_task *tasks = (parallel_for_task *)mco_calloc(num_threads,
+                                                              sizeof(parallel_for_task));
+    pthread_t *threads = (pthread_t *)mco_malloc(num_threads * sizeof(pthread_t));
+    if (!work || !tasks || !threads) {
+        mco_free(threads);
+        mco_free(tasks);
+        mco_free(work);
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0;
+    }
+
+    mco_thread_work_init(work, num_threads, base_rng, total_sims);
+
+    for (uint32_t i = 0; i < num_threads; ++i) {
+        tasks[i].fn = fn;
+        tasks[i].arg = arg;
+        tasks[i].work = &work[i];
+        tasks[i].thread_id = i;
+    }
+
+    for (uint32_t i = 0; i < num_threads; ++i) {
+        int rc = pthread_create(&threads[i], NULL, worker_parallel_for, &tasks[i]);
+        if (rc != 0) {
+            for (uint32_t j = 0; j < i; ++j) {
+                pthread_join(threads[j], NULL);
+            }
+            mco_free(threads);
+            mco_free(tasks);
+            mco_free(work);
+            ctx->last_error = MCO_ERR_THREAD;
+            return 0;
+        }
+    }
+
+    for (uint32_t i = 0; i < num_threads; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    mco_free(threads);
+    mco_free(tasks);
+    mco_free(work);
+
+    return num_threads;
+}
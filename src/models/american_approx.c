@@ -0,0 +1,499 @@
+/*
+ * Analytic American Option Approximations Implementation
+ *
+ * Both methods are homogeneous of degree one in (spot, strike), so the
+ * exercise boundary is computed once at unit strike and reused for
+ * every contract with the same (r, b, σ, T):
+ *
+ *   V(S, K) = K·V(S/K, 1)
+ */
+
+#include "internal/models/american_approx.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef M_SQRT1_2
+#define M_SQRT1_2 0.7071067811865475244  /* 1/sqrt(2) */
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Newton iterations for the BAW critical price */
+#define MCO_BAW_MAX_ITER 100
+#define MCO_BAW_TOLERANCE 1e-10
+
+/*============================================================================
+ * Normal Distribution
+ *============================================================================*/
+
+static double norm_cdf(double x)
+{
+    return 0.5 * erfc(-x * M_SQRT1_2);
+}
+
+static double norm_pdf(double x)
+{
+    return exp(-0.5 * x * x) / sqrt(2.0 * M_PI);
+}
+
+/*
+ * Bivariate normal CDF P(X < a, Y < b) with correlation rho.
+ *
+ * Genz (2004) "Numerical computation of rectangular bivariate and
+ * trivariate normal and t probabilities": Gauss-Legendre quadrature
+ * of Plackett's identity, 3/6/10 points by |ρ|, with an asymptotic
+ * expansion for |ρ| ≥ 0.925. Accurate to about 1e-15.
+ */
+static const double bvn_w[3][10] = {
+    { 0.1713244923791705, 0.3607615730481384, 0.4679139345726904 },
+    { 0.04717533638651177, 0.1069393259953183, 0.1600783285433464,
+      0.2031674267230659, 0.2334925365383547, 0.2491470458134029 },
+    { 0.01761400713915212, 0.04060142980038694, 0.06267204833410906,
+      0.08327674157670475, 0.1019301198172404, 0.1181945319615184,
+      0.1316886384491766, 0.1420961093183821, 0.1491729864726037,
+      0.1527533871307259 }
+};
+
+static const double bvn_x[3][10] = {
+    { -0.9324695142031522, -0.6612093864662647, -0.2386191860831970 },
+    { -0.9815606342467191, -0.9041172563704750, -0.7699026741943050,
+      -0.5873179542866171, -0.3678314989981802, -0.1252334085114692 },
+    { -0.9931285991850949, -0.9639719272779138, -0.9122344282513259,
+      -0.8391169718222188, -0.7463319064601508, -0.6360536807265150,
+      -0.5108670019508271, -0.3737060887154196, -0.2277858511416451,
+      -0.07652652113349733 }
+};
+
+static double bivariate_normal_cdf(double a, double b, double rho)
+{
+    size_t ng, lg;
+    if (fabs(rho) < 0.3) {
+        ng = 0; lg = 3;
+    } else if (fabs(rho) < 0.75) {
+        ng = 1; lg = 6;
+    } else {
+        ng = 2; lg = 10;
+    }
+
+    /* Genz works with upper tails: P(X > h, Y > k) */
+    double h = -a;
+    double k = -b;
+    double hk = h * k;
+    double bvn = 0.0;
+
+    if (fabs(rho) < 0.925) {
+        double hs = 0.5 * (h * h + k * k);
+        double asr = asin(rho);
+        for (size_t i = 0; i < lg; ++i) {
+            double sn = sin(0.5 * asr * (bvn_x[ng][i] + 1.0));
+            bvn += bvn_w[ng][i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+            sn = sin(0.5 * asr * (1.0 - bvn_x[ng][i]));
+            bvn += bvn_w[ng][i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+        }
+        return bvn * asr / (4.0 * M_PI) + norm_cdf(-h) * norm_cdf(-k);
+    }
+
+    if (rho < 0.0) {
+        k = -k;
+        hk = -hk;
+    }
+
+    if (fabs(rho) < 1.0) {
+        double as = (1.0 - rho) * (1.0 + rho);
+        double aa = sqrt(as);
+        double bs = (h - k) * (h - k);
+        double c = (4.0 - hk) / 8.0;
+        double d = (12.0 - hk) / 16.0;
+
+        bvn = aa * exp(-0.5 * (bs / as + hk))
+            * (1.0 - c * (bs - as) * (1.0 - d * bs / 5.0) / 3.0 + c * d * as * as / 5.0);
+        if (hk > -160.0) {
+            double bb = sqrt(bs);
+            bvn -= exp(-0.5 * hk) * sqrt(2.0 * M_PI) * norm_cdf(-bb / aa) * bb
+                 * (1.0 - c * bs * (1.0 - d * bs / 5.0) / 3.0);
+        }
+
+        aa *= 0.5;
+        for (size_t i = 0; i < lg; ++i) {
+            for (int side = 0; side < 2; ++side) {
+                double xi = side ? -bvn_x[ng][i] : bvn_x[ng][i];
+                double xs = aa * (xi + 1.0);
+                xs *= xs;
+                double rs = sqrt(1.0 - xs);
+                double asr = -0.5 * (bs / xs + hk);
+                if (asr > -100.0) {
+                    bvn += aa * bvn_w[ng][i] * exp(asr)
+                         * (exp(-hk * (1.0 - rs) / (2.0 * (1.0 + rs))) / rs
+                            - (1.0 + c * xs * (1.0 + d * xs)));
+                }
+            }
+        }
+        bvn = -bvn / (2.0 * M_PI);
+    }
+
+    if (rho > 0.0) {
+        return bvn + norm_cdf(-fmax(h, k));
+    }
+
+    bvn = -bvn;
+    if (k > h) {
+        bvn += (h < 0.0) ? norm_cdf(k) - norm_cdf(h) : norm_cdf(-h) - norm_cdf(-k);
+    }
+    return bvn;
+}
+
+/*============================================================================
+ * Generalised Black-Scholes
+ *============================================================================*/
+
+double mco_gbs_price(double spot, double strike, double rate, double carry,
+                     double volatility, double time, mco_option_type type)
+{
+    if (time <= 0.0) {
+        return mco_payoff(spot, strike, type);
+    }
+
+    double df = exp(-rate * time);
+    double fwd = spot * exp(carry * time);
+
+    if (volatility <= 0.0) {
+        return df * mco_payoff(fwd, strike, type);
+    }
+
+    double vol_sqrt_t = volatility * sqrt(time);
+    double d1 = (log(fwd / strike) + 0.5 * volatility * volatility * time) / vol_sqrt_t;
+    double d2 = d1 - vol_sqrt_t;
+
+    if (type == MCO_CALL) {
+        return df * (fwd * norm_cdf(d1) - strike * norm_cdf(d2));
+    }
+    return df * (strike * norm_cdf(-d2) - fwd * norm_cdf(-d1));
+}
+
+/*
+ * Early exercise is never optimal: call with b ≥ r, put with r ≤ 0,
+ * or no time or volatility left to trade against.
+ */
+static int american_is_european(double rate, double carry, double volatility,
+                                double time, mco_option_type type)
+{
+    if (time <= 0.0 || volatility <= 0.0) return 1;
+    return (type == MCO_CALL) ? carry >= rate : rate <= 0.0;
+}
+
+/*============================================================================
+ * Barone-Adesi-Whaley
+ *============================================================================*/
+
+/*
+ * Exercise boundary at unit strike
+ */
+typedef struct {
+    double key[4];      /* (r, b, σ, T) the boundary was solved for */
+    int european;
+    double q;           /* q₂ (call) or q₁ (put) */
+    double critical;    /* S* per unit strike */
+    double premium;     /* A₂ (call) or A₁ (put) per unit strike */
+} baw_boundary;
+
+static void baw_boundary_init(baw_boundary *bd, double rate, double carry,
+                              double volatility, double time, mco_option_type type)
+{
+    bd->key[0] = rate;
+    bd->key[1] = carry;
+    bd->key[2] = volatility;
+    bd->key[3] = time;
+    bd->european = american_is_european(rate, carry, volatility, time, type);
+    bd->q = 0.0;
+    bd->critical = (type == MCO_CALL) ? HUGE_VAL : 0.0;
+    bd->premium = 0.0;
+    if (bd->european) return;
+
+    double var = volatility * volatility;
+    double vol_sqrt_t = volatility * sqrt(time);
+    double nn = 2.0 * carry / var;
+    double mm = 2.0 * rate / var;
+    double carry_df = exp((carry - rate) * time);
+
+    /* M/K with K = 1 - e^(-rT); tends to 2/(σ²T) as r → 0 */
+    double rt = rate * time;
+    double m_over_k = (fabs(rt) < 1e-12) ? 2.0 / (var * time) : mm / -expm1(-rt);
+
+    double disc = (nn - 1.0) * (nn - 1.0);
+    double si;
+    double q;
+
+    if (type == MCO_CALL) {
+        q = 0.5 * (-(nn - 1.0) + sqrt(disc + 4.0 * m_over_k));
+
+        /* Seed from the perpetual boundary (Barone-Adesi & Whaley eq. 24) */
+        double q_inf = 0.5 * (-(nn - 1.0) + sqrt(disc + 4.0 * mm));
+        double s_inf = 1.0 / (1.0 - 1.0 / q_inf);
+        double h2 = -(carry * time + 2.0 * vol_sqrt_t) / (s_inf - 1.0);
+        si = 1.0 + (s_inf - 1.0) * (1.0 - exp(h2));
+
+        for (int iter = 0; iter < MCO_BAW_MAX_ITER; ++iter) {
+            double d1 = (log(si) + (carry + 0.5 * var) * time) / vol_sqrt_t;
+            double rhs = mco_gbs_price(si, 1.0, rate, carry, volatility, time, MCO_CALL)
+                       + (1.0 - carry_df * norm_cdf(d1)) * si / q;
+            if (fabs(si - 1.0 - rhs) < MCO_BAW_TOLERANCE) break;
+
+            double slope = carry_df * norm_cdf(d1) * (1.0 - 1.0 / q)
+                         + (1.0 - carry_df * norm_pdf(d1) / vol_sqrt_t) / q;
+            si = (1.0 + rhs - slope * si) / (1.0 - slope);
+        }
+
+        double d1 = (log(si) + (carry + 0.5 * var) * time) / vol_sqrt_t;
+        bd->premium = (si / q) * (1.0 - carry_df * norm_cdf(d1));
+    } else {
+        q = 0.5 * (-(nn - 1.0) - sqrt(disc + 4.0 * m_over_k));
+
+        double q_inf = 0.5 * (-(nn - 1.0) - sqrt(disc + 4.0 * mm));
+        double s_inf = 1.0 / (1.0 - 1.0 / q_inf);
+        double h1 = (carry * time - 2.0 * vol_sqrt_t) / (1.0 - s_inf);
+        si = s_inf + (1.0 - s_inf) * exp(h1);
+
+        for (int iter = 0; iter < MCO_BAW_MAX_ITER; ++iter) {
+            double d1 = (log(si) + (carry + 0.5 * var) * time) / vol_sqrt_t;
+            double rhs = mco_gbs_price(si, 1.0, rate, carry, volatility, time, MCO_PUT)
+                       - (1.0 - carry_df * norm_cdf(-d1)) * si / q;
+            if (fabs(1.0 - si - rhs) < MCO_BAW_TOLERANCE) break;
+
+            double slope = -carry_df * norm_cdf(-d1) * (1.0 - 1.0 / q)
+                         - (1.0 + carry_df * norm_pdf(-d1) / vol_sqrt_t) / q;
+            si = (1.0 - rhs + slope * si) / (1.0 + slope);
+        }
+
+        double d1 = (log(si) + (carry + 0.5 * var) * time) / vol_sqrt_t;
+        bd->premium = -(si / q) * (1.0 - carry_df * norm_cdf(-d1));
+    }
+
+    bd->q = q;
+    bd->critical = si;
+}
+
+static double baw_eval(const baw_boundary *bd, double spot, double strike,
+                       mco_option_type type)
+{
+    double rate = bd->key[0], carry = bd->key[1];
+    double volatility = bd->key[2], time = bd->key[3];
+
+    double european = mco_gbs_price(spot, strike, rate, carry, volatility, time, type);
+    if (bd->european) {
+        /* Immediate exercise still bounds the price from below */
+        return fmax(european, mco_payoff(spot, strike, type));
+    }
+
+    double s = spot / strike;
+    if (type == MCO_CALL ? s >= bd->critical : s <= bd->critical) {
+        return mco_payoff(spot, strike, type);
+    }
+    return european + strike * bd->premium * pow(s / bd->critical, bd->q);
+}
+
+double mco_baw_price(double spot, double strike, double rate, double carry,
+                     double volatility, double time, mco_option_type type)
+{
+    baw_boundary bd;
+    baw_boundary_init(&bd, rate, carry, volatility, time, type);
+    return baw_eval(&bd, spot, strike, type);
+}
+
+/*============================================================================
+ * Bjerksund-Stensland 2002
+ *============================================================================*/
+
+/*
+ * Flat-boundary call at unit strike. Puts are stored transformed
+ * (r' = r - b, b' = -b) and evaluated as C(K/S, 1) scaled by S.
+ */
+typedef struct {
+    double key[4];      /* Untransformed (r, b, σ, T) */
+    int european;
+    double rate;        /* Call-side r and b */
+    double carry;
+    double volatility;
+    double time;
+    double t1;          /* (√5 - 1)/2·T */
+    double beta;
+    double i1, i2;      /* Triggers on [t₁, T] and [0, t₁] */
+    double alpha1, alpha2;
+} bjs_boundary;
+
+/* φ(S, T, γ, H, I) of Bjerksund & Stensland */
+static double bjs_phi(const bjs_boundary *bd, double s, double t,
+                      double gamma, double h, double i)
+{
+    double v = bd->volatility, b = bd->carry;
+    double var = v * v;
+    double vol_sqrt_t = v * sqrt(t);
+
+    double lambda = (-bd->rate + gamma * b + 0.5 * gamma * (gamma - 1.0) * var) * t;
+    double d = -(log(s / h) + (b + (gamma - 0.5) * var) * t) / vol_sqrt_t;
+    double kappa = 2.0 * b / var + 2.0 * gamma - 1.0;
+
+    return exp(lambda) * pow(s, gamma)
+         * (norm_cdf(d) - pow(i / s, kappa) * norm_cdf(d - 2.0 * log(i / s) / vol_sqrt_t));
+}
+
+/* ψ(S, T, γ, H, I₂, I₁, t₁): the two-period analogue of φ */
+static double bjs_psi(const bjs_boundary *bd, double s, double gamma, double h)
+{
+    double v = bd->volatility, b = bd->carry;
+    double t1 = bd->t1, t2 = bd->time;
+    double i1 = bd->i1, i2 = bd->i2;
+    double var = v * v;
+    double drift = b + (gamma - 0.5) * var;
+    double vst1 = v * sqrt(t1);
+    double vst2 = v * sqrt(t2);
+
+    double e1 = (log(s / i1) + drift * t1) / vst1;
+    double e2 = (log(i2 * i2 / (s * i1)) + drift * t1) / vst1;
+    double e3 = (log(s / i1) - drift * t1) / vst1;
+    double e4 = (log(i2 * i2 / (s * i1)) - drift * t1) / vst1;
+
+    double f1 = (log(s / h) + drift * t2) / vst2;
+    double f2 = (log(i2 * i2 / (s * h)) + drift * t2) / vst2;
+    double f3 = (log(i1 * i1 / (s * h)) + drift * t2) / vst2;
+    double f4 = (log(s * i1 * i1 / (h * i2 * i2)) + drift * t2) / vst2;
+
+    double rho = sqrt(t1 / t2);
+    double lambda = -bd->rate + gamma * b + 0.5 * gamma * (gamma - 1.0) * var;
+    double kappa = 2.0 * b / var + 2.0 * gamma - 1.0;
+
+    return exp(lambda * t2) * pow(s, gamma)
+         * (bivariate_normal_cdf(-e1, -f1, rho)
+            - pow(i2 / s, kappa) * bivariate_normal_cdf(-e2, -f2, rho)
+            - pow(i1 / s, kappa) * bivariate_normal_cdf(-e3, -f3, -rho)
+            + pow(i1 / i2, kappa) * bivariate_normal_cdf(-e4, -f4, -rho));
+}
+
+static void bjs_boundary_init(bjs_boundary *bd, double rate, double carry,
+                              double volatility, double time, mco_option_type type)
+{
+    bd->key[0] = rate;
+    bd->key[1] = carry;
+    bd->key[2] = volatility;
+    bd->key[3] = time;
+    bd->european = american_is_european(rate, carry, volatility, time, type);
+    if (bd->european) return;
+
+    /* Put-call transformation */
+    if (type == MCO_PUT) {
+        rate -= carry;
+        carry = -carry;
+    }
+    bd->rate = rate;
+    bd->carry = carry;
+    bd->volatility = volatility;
+    bd->time = time;
+
+    double var = volatility * volatility;
+    double t1 = 0.5 * (sqrt(5.0) - 1.0) * time;
+    double beta = (0.5 - carry / var)
+                + sqrt((carry / var - 0.5) * (carry / var - 0.5) + 2.0 * rate / var);
+    double b_inf = beta / (beta - 1.0);
+    double b_0 = fmax(1.0, rate / (rate - carry));
+    double spread = (b_inf - b_0) * b_0;
+
+    double h1 = -(carry * t1 + 2.0 * volatility * sqrt(t1)) / spread;
+    double h2 = -(carry * time + 2.0 * volatility * sqrt(time)) / spread;
+
+    bd->t1 = t1;
+    bd->beta = beta;
+    bd->i1 = b_0 + (b_inf - b_0) * (1.0 - exp(h1));
+    bd->i2 = b_0 + (b_inf - b_0) * (1.0 - exp(h2));
+    bd->alpha1 = (bd->i1 - 1.0) * pow(bd->i1, -beta);
+    bd->alpha2 = (bd->i2 - 1.0) * pow(bd->i2, -beta);
+}
+
+/* Call at unit strike under the (possibly transformed) parameters */
+static double bjs_call_unit(const bjs_boundary *bd, double s)
+{
+    if (s >= bd->i2) return s - 1.0;
+
+    double t1 = bd->t1, beta = bd->beta;
+    double i1 = bd->i1, i2 = bd->i2;
+    double a1 = bd->alpha1, a2 = bd->alpha2;
+
+    return a2 * pow(s, beta)
+         - a2 * bjs_phi(bd, s, t1, beta, i2, i2)
+         + bjs_phi(bd, s, t1, 1.0, i2, i2)
+         - bjs_phi(bd, s, t1, 1.0, i1, i2)
+         - bjs_phi(bd, s, t1, 0.0, i2, i2)
+         + bjs_phi(bd, s, t1, 0.0, i1, i2)
+         + a1 * bjs_phi(bd, s, t1, beta, i1, i2)
+         - a1 * bjs_psi(bd, s, beta, i1)
+         + bjs_psi(bd, s, 1.0, i1)
+         - bjs_psi(bd, s, 1.0, 1.0)
+         - bjs_psi(bd, s, 0.0, i1)
+         + bjs_psi(bd, s, 0.0, 1.0);
+}
+
+static double bjs_eval(const bjs_boundary *bd, double spot, double strike,
+                       mco_option_type type)
+{
+    if (bd->european) {
+        double european = mco_gbs_price(spot, strike, bd->key[0], bd->key[1],
+                                        bd->key[2], bd->key[3], type);
+        return fmax(european, mco_payoff(spot, strike, type));
+    }
+
+    return (type == MCO_CALL)
+         ? strike * bjs_call_unit(bd, spot / strike)
+         : spot * bjs_call_unit(bd, strike / spot);
+}
+
+double mco_bjs2002_price(double spot, double strike, double rate, double carry,
+                         double volatility, double time, mco_option_type type)
+{
+    bjs_boundary bd;
+    bjs_boundary_init(&bd, rate, carry, volatility, time, type);
+    return bjs_eval(&bd, spot, strike, type);
+}
+
+/*============================================================================
+ * Batch Evaluation
+ *============================================================================*/
+
+void mco_american_approx_batch(mco_american_approx method,
+                               const double *spot,
+                               const double *strike,
+                               const double *rate,
+                               const double *volatility,
+                               const double *time,
+                               size_t n,
+                               mco_option_type type,
+                               double *out)
+{
+    baw_boundary baw;
+    bjs_boundary bjs;
+    int have = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!(spot[i] > 0.0 && strike[i] > 0.0 && volatility[i] >= 0.0 && time[i] >= 0.0)) {
+            out[i] = 0.0;
+            continue;
+        }
+
+        /* Cost of carry = r: no dividends in this model */
+        double key[4] = { rate[i], rate[i], volatility[i], time[i] };
+        const double *cached = (method == MCO_AMERICAN_BAW) ? baw.key : bjs.key;
+
+        /* Bitwise match: the boundary is reused only for identical inputs */
+        if (!have || memcmp(key, cached, sizeof key) != 0) {
+            if (method == MCO_AMERICAN_BAW) {
+                baw_boundary_init(&baw, key[0], key[1], key[2], key[3], type);
+            } else {
+                bjs_boundary_init(&bjs, key[0], key[1], key[2], key[3], type);
+            }
+            have = 1;
+        }
+
+        out[i] = (method == MCO_AMERICAN_BAW)
+               ? baw_eval(&baw, spot[i], strike[i], type)
+               : bjs_eval(&bjs, spot[i], strike[i], type);
+    }
+}
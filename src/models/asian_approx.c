@@ -0,0 +1,320 @@
+/*
+ * Analytic Arithmetic Asian Approximations Implementation
+ *
+ * Turnbull-Wakeman and Levy are Black-76 on a moment-matched lognormal;
+ * Curran conditions on the geometric average. Calls are priced
+ * directly and puts by parity on the exact first moment.
+ */
+
+#include "internal/models/asian_approx.h"
+#include <math.h>
+#include <string.h>
+
+#ifndef M_SQRT1_2
+#define M_SQRT1_2 0.7071067811865475244  /* 1/sqrt(2) */
+#endif
+
+/*============================================================================
+ * Helpers
+ *============================================================================*/
+
+static double norm_cdf(double x)
+{
+    return 0.5 * erfc(-x * M_SQRT1_2);
+}
+
+/*
+ * (eˣ - 1)/x, the average of e^(xu) over u in [0, 1]
+ */
+static double expm1_ratio(double x)
+{
+    return (fabs(x) < 1e-8) ? 1.0 + 0.5 * x : expm1(x) / x;
+}
+
+/*
+ * Derivative of expm1_ratio, (eˣ·(x - 1) + 1)/x²
+ */
+static double expm1_ratio_slope(double x)
+{
+    return (fabs(x) < 1e-4) ? 0.5 + x / 3.0 : (exp(x) * (x - 1.0) + 1.0) / (x * x);
+}
+
+/*============================================================================
+ * Moments
+ *============================================================================*/
+
+void mco_asian_moments(double rate, double volatility, double time,
+                       size_t num_obs, double *m1, double *m2)
+{
+    double n = (double)num_obs;
+    double dt = time / n;
+    double g = exp(rate * dt);                                 /* e^(r·Δt) */
+    double q = exp((rate + volatility * volatility) * dt);     /* e^((r + σ²)·Δt) */
+
+    /* total = Σⱼ e^(r·tⱼ) */
+    double total = 0.0;
+    double gi = 1.0;
+    for (size_t i = 0; i < num_obs; ++i) {
+        gi *= g;
+        total += gi;
+    }
+
+    /* Σᵢ e^((r + σ²)·tᵢ)·(e^(r·tᵢ) + 2·Σ_{j>i} e^(r·tⱼ)) */
+    double sum = 0.0;
+    double cum = 0.0;
+    double qi = 1.0;
+    gi = 1.0;
+    for (size_t i = 0; i < num_obs; ++i) {
+        gi *= g;
+        qi *= q;
+        cum += gi;
+        sum += qi * (gi + 2.0 * (total - cum));
+    }
+
+    *m1 = total / n;
+    *m2 = sum / (n * n);
+}
+
+/*
+ * Moments of the continuous average (1/T)·∫ S(t) dt per unit spot:
+ *
+ *   m₁ = E(rT),   m₂ = 2·(E((2r + σ²)T) - E(rT)) / ((r + σ²)T)
+ *
+ * with E(x) = (eˣ - 1)/x. m₂ is a divided difference of E, taken as
+ * its slope when the two points nearly coincide.
+ */
+static void levy_moments(double rate, double volatility, double time,
+                         double *m1, double *m2)
+{
+    double x1 = rate * time;
+    double x2 = (2.0 * rate + volatility * volatility) * time;
+    double h = x2 - x1;
+
+    *m1 = expm1_ratio(x1);
+    *m2 = (fabs(h) < 1e-6)
+        ? 2.0 * expm1_ratio_slope(0.5 * (x1 + x2))
+        : 2.0 * (expm1_ratio(x2) - expm1_ratio(x1)) / h;
+}
+
+static void approx_moments(mco_asian_approx method, double rate, double volatility,
+                           double time, size_t num_obs, double *m1, double *m2)
+{
+    if (method == MCO_ASIAN_LEVY) {
+        levy_moments(rate, volatility, time, m1, m2);
+    } else {
+        mco_asian_moments(rate, volatility, time, num_obs, m1, m2);
+    }
+}
+
+/*============================================================================
+ * Pricing
+ *============================================================================*/
+
+/*
+ * Black-76 call on the lognormal with mean m1 and second moment m2
+ */
+static double lognormal_call(double df, double m1, double m2, double strike)
+{
+    double v = log(m2 / (m1 * m1));
+    if (!(v > 0.0)) {
+        return df * fmax(m1 - strike, 0.0);
+    }
+
+    double sd = sqrt(v);
+    double d1 = (log(m1 / strike) + 0.5 * v) / sd;
+    return df * (m1 * norm_cdf(d1) - strike * norm_cdf(d1 - sd));
+}
+
+/*
+ * Conditioning on ln G, normal with mean μ_G and variance v_G, and
+ * Cov(ln S(tᵢ), ln G) = cᵢ for tᵢ = i·Δt.
+ */
+typedef struct {
+    double spot;
+    double log_spot;
+    double growth;      /* e^(r·Δt) */
+    double drift_dt;    /* (r - σ²/2)·Δt */
+    double var_dt;      /* σ²·Δt */
+    double mu_g;
+    double var_g;
+    double sd_g;
+    double n;
+    size_t num_obs;
+} curran_terms;
+
+static void curran_init(curran_terms *ct, double spot, double rate,
+                        double volatility, double time, size_t num_obs)
+{
+    double n = (double)num_obs;
+    double dt = time / n;
+
+    ct->spot = spot;
+    ct->log_spot = log(spot);
+    ct->growth = exp(rate * dt);
+    ct->drift_dt = (rate - 0.5 * volatility * volatility) * dt;
+    ct->var_dt = volatility * volatility * dt;
+    ct->mu_g = ct->log_spot + ct->drift_dt * 0.5 * (n + 1.0);
+    ct->var_g = ct->var_dt * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n);
+    ct->sd_g = sqrt(ct->var_g);
+    ct->n = n;
+    ct->num_obs = num_obs;
+}
+
+static double curran_cov(const curran_terms *ct, double i)
+{
+    return ct->var_dt * (i * (ct->n + 0.5) - 0.5 * i * i) / ct->n;
+}
+
+/*
+ * Undiscounted E[φ·(A - K)·1{φ·(G - L) > 0}], φ = +1 call, -1 put:
+ *
+ *   φ·((1/n)·Σ S·e^(r·tᵢ)·N(φ·(d + cᵢ/σ_G)) - K·N(φ·d)),
+ *   d = (μ_G - ln L)/σ_G
+ */
+static double curran_part(const curran_terms *ct, double level, double strike,
+                          mco_option_type type)
+{
+    double phi = (type == MCO_CALL) ? 1.0 : -1.0;
+    double d = (ct->mu_g - log(level)) / ct->sd_g;
+    double gi = 1.0;
+    double sum = 0.0;
+
+    for (size_t k = 1; k <= ct->num_obs; ++k) {
+        gi *= ct->growth;
+        sum += gi * norm_cdf(phi * (d + curran_cov(ct, (double)k) / ct->sd_g));
+    }
+
+    return phi * (ct->spot * sum / ct->n - strike * norm_cdf(phi * d));
+}
+
+/*
+ * Curran call; fwd1 = M₁ and fwd2 = M₂ for the fallback.
+ */
+static double curran_call(double spot, double strike, double rate, double volatility,
+                          double time, size_t num_obs, double df,
+                          double fwd1, double fwd2)
+{
+    curran_terms ct;
+    curran_init(&ct, spot, rate, volatility, time, num_obs);
+
+    /* Shifted strike: E[S(tᵢ) | G = K] averaged over i */
+    double slope = (log(strike) - ct.mu_g) / ct.var_g;
+    double shift = 0.0;
+    for (size_t k = 1; k <= num_obs; ++k) {
+        double i = (double)k;
+        double cov_i = curran_cov(&ct, i);
+        shift += exp(ct.log_spot + ct.drift_dt * i + cov_i * slope
+                     + 0.5 * (ct.var_dt * i - cov_i * cov_i / ct.var_g));
+    }
+    double k_hat = 2.0 * strike - shift / ct.n;
+
+    if (!(k_hat > 0.0)) {
+        return lognormal_call(df, fwd1, fwd2, strike);
+    }
+
+    return df * curran_part(&ct, k_hat, strike, MCO_CALL);
+}
+
+double mco_asian_curran_control_mean(double spot, double strike, double rate,
+                                     double volatility, double time,
+                                     size_t num_obs, mco_option_type type)
+{
+    double df = exp(-rate * time);
+
+    /* No diffusion: A and G are their forwards */
+    if (!(volatility > 0.0 && time > 0.0)) {
+        double m1, m2;
+        mco_asian_moments(rate, volatility, time, num_obs, &m1, &m2);
+        double geom = spot * exp((rate - 0.5 * volatility * volatility) * time
+                                 * 0.5 * ((double)num_obs + 1.0) / (double)num_obs);
+        double phi = (type == MCO_CALL) ? 1.0 : -1.0;
+        return (phi * (geom - strike) > 0.0) ? df * phi * (spot * m1 - strike) : 0.0;
+    }
+
+    curran_terms ct;
+    curran_init(&ct, spot, rate, volatility, time, num_obs);
+    return df * curran_part(&ct, strike, strike, type);
+}
+
+/*
+ * One contract from its unit moments
+ */
+static double approx_eval(mco_asian_approx method,
+                          double spot, double strike, double rate,
+                          double volatility, double time, size_t num_obs,
+                          double m1, double m2, mco_option_type type)
+{
+    double df = exp(-rate * time);
+    double fwd1 = spot * m1;
+    double fwd2 = spot * spot * m2;
+
+    double call;
+    if (method == MCO_ASIAN_CURRAN && volatility > 0.0 && time > 0.0) {
+        call = curran_call(spot, strike, rate, volatility, time, num_obs, df, fwd1, fwd2);
+    } else {
+        call = lognormal_call(df, fwd1, fwd2, strike);
+    }
+
+    return (type == MCO_CALL) ? call : call - df * (fwd1 - strike);
+}
+
+static int approx_valid(double spot, double strike, double volatility, double time,
+                        size_t num_obs)
+{
+    return spot > 0.0 && strike > 0.0 && volatility >= 0.0 && time >= 0.0 && num_obs > 0;
+}
+
+double mco_asian_approx_price(mco_asian_approx method,
+                              double spot,
+                              double strike,
+                              double rate,
+                              double volatility,
+                              double time,
+                              size_t num_obs,
+                              mco_option_type type)
+{
+    if (!approx_valid(spot, strike, volatility, time, num_obs)) return 0.0;
+
+    double m1, m2;
+    approx_moments(method, rate, volatility, time, num_obs, &m1, &m2);
+    return approx_eval(method, spot, strike, rate, volatility, time, num_obs,
+                       m1, m2, type);
+}
+
+/*============================================================================
+ * Batch Evaluation
+ *============================================================================*/
+
+void mco_asian_approx_price_batch(mco_asian_approx method,
+                                  const double *spot,
+                                  const double *strike,
+                                  const double *rate,
+                                  const double *volatility,
+                                  const double *time,
+                                  size_t n,
+                                  size_t num_obs,
+                                  mco_option_type type,
+                                  double *out)
+{
+    double key[3] = { 0.0, 0.0, 0.0 };
+    double m1 = 0.0, m2 = 0.0;
+    int have = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!approx_valid(spot[i], strike[i], volatility[i], time[i], num_obs)) {
+            out[i] = 0.0;
+            continue;
+        }
+
+        /* Bitwise match: the moments are reused only for identical inputs */
+        double next[3] = { rate[i], volatility[i], time[i] };
+        if (!have || memcmp(next, key, sizeof key) != 0) {
+            memcpy(key, next, sizeof key);
+            approx_moments(method, key[0], key[1], key[2], num_obs, &m1, &m2);
+            have = 1;
+        }
+
+        out[i] = approx_eval(method, spot[i], strike[i], rate[i], volatility[i],
+                             time[i], num_obs, m1, m2, type);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * GBM Schedule Implementation
+ */
+
+#include "internal/models/gbm_schedule.h"
+#include "internal/allocator.h"
+#include <math.h>
+
+/* Relative tolerance for recognising an evenly spaced schedule */
+#define SCHEDULE_UNIFORM_TOL 1e-12
+
+int mco_gbm_schedule_valid(const double *times, size_t num_dates)
+{
+    if (!times || num_dates == 0) return 0;
+
+    double prev = 0.0;
+    for (size_t i = 0; i < num_dates; ++i) {
+        if (!isfinite(times[i]) || times[i] < prev) return 0;
+        prev = times[i];
+    }
+
+    return 1;
+}
+
+int mco_gbm_schedule_init(mco_gbm_schedule *sched,
+                          double spot,
+                          double rate,
+                          double volatility,
+                          const double *times,
+                          size_t num_dates)
+{
+    sched->times = (double *)mco_malloc(num_dates * sizeof(double));
+    sched->drift = (double *)mco_malloc(num_dates * sizeof(double));
+    sched->diffusion = (double *)mco_malloc(num_dates * sizeof(double));
+
+    if (!sched->times || !sched->drift || !sched->diffusion) {
+        mco_gbm_schedule_free(sched);
+        return -1;
+    }
+
+    double mu = rate - 0.5 * volatility * volatility;
+    double maturity = times[num_dates - 1];
+    double prev = 0.0;
+    int uniform = 1;
+
+    for (size_t i = 0; i < num_dates; ++i) {
+        double dt = times[i] - prev;
+        if (dt < 0.0) dt = 0.0;
+
+        sched->times[i] = times[i];
+        sched->drift[i] = mu * dt;
+        sched->diffusion[i] = volatility * sqrt(dt);
+
+        double even = maturity * (double)(i + 1) / (double)num_dates;
+        if (fabs(times[i] - even) > SCHEDULE_UNIFORM_TOL * (1.0 + maturity)) {
+            uniform = 0;
+        }
+        prev = times[i];
+    }
+
+    sched->spot = spot;
+    sched->log_spot = log(spot);
+    sched->rate = rate;
+    sched->maturity = maturity;
+    sched->discount = exp(-rate * maturity);
+    sched->num_dates = num_dates;
+    sched->uniform = uniform;
+
+    return 0;
+}
+
+int mco_gbm_schedule_init_uniform(mco_gbm_schedule *sched,
+                                  double spot,
+                                  double rate,
+                                  double volatility,
+                                  double time,
+                                  size_t num_dates)
+{
+    double *times = (double *)mco_malloc(num_dates * sizeof(double));
+    if (!times) {
+        sched->times = sched->drift = sched->diffusion = NULL;
+        return -1;
+    }
+
+    for (size_t i = 0; i < num_dates; ++i) {
+        times[i] = time * (double)(i + 1) / (double)num_dates;
+    }
+
+    int rc = mco_gbm_schedule_init(sched, spot, rate, volatility, times, num_dates);
+    mco_free(times);
+    return rc;
+}
+
+void mco_gbm_schedule_free(mco_gbm_schedule *sched)
+{
+    mco_free(sched->times);
+    mco_free(sched->drift);
+    mco_free(sched->diffusion);
+    sched->times = NULL;
+    sched->drift = NULL;
+    sched->diffusion = NULL;
+}
@@ -5,8 +5,13 @@
  */
 
 #include "internal/models/heston.h"
+#include "internal/models/gbm.h"
 #include "internal/instruments/payoff.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/methods/thread_pool.h"
+#include "internal/allocator.h"
 #include "internal/context.h"
+#include "internal/sum.h"
 #include "mcoptions.h"
 #include <math.h>
 #include <complex.h>
@@ -69,6 +74,64 @@ void mco_heston_char_func(double u,
  * Monte Carlo Pricing
  *============================================================================*/
 
+/*
+ * Conditional Monte Carlo (Romano-Touzi / Willard)
+ *
+ * Given the variance path, log S(T) is Gaussian:
+ *
+ *   log S(T) = log S₀ + rT - ½∫v dt + ρ∫√v dW₂ + √(1-ρ²)∫√v dW⊥
+ *
+ * The ∫√v dW₂ term is recovered from the variance SDE itself:
+ *
+ *   ∫√v dW₂ = (v(T) - v₀ - κθT + κ∫v dt) / σ
+ *
+ * so each path collapses to a Black-Scholes price with
+ *
+ *   S_eff = S₀ · exp(ρ∫√v dW₂ - ½ρ²∫v dt)
+ *   σ_eff = √((1-ρ²)∫v dt / T)
+ *
+ * Only the variance is simulated (QE scheme), which removes the spot
+ * normal entirely and leaves only the variance noise in the estimator.
+ */
+static double price_heston_conditional(mco_ctx *ctx,
+                                       const mco_heston_path *model,
+                                       double strike,
+                                       double time,
+                                       mco_option_type type)
+{
+    uint64_t n_paths = ctx->num_simulations;
+    double dt = model->dt;
+    double rho_sq = model->rho * model->rho;
+
+    mco_sum sum_price;
+    mco_sum_init(&sum_price);
+    mco_rng rng = ctx->rng;
+
+    for (uint64_t i = 0; i < n_paths; ++i) {
+        double v = model->v0;
+        double int_v = 0.0;
+
+        for (size_t j = 0; j < model->num_steps; ++j) {
+            double v_next = mco_heston_qe_variance(model, v, &rng);
+            int_v += 0.5 * (v + v_next) * dt;
+            v = v_next;
+        }
+
+        double int_sqrt_v_dw2 = (v - model->v0 - model->kappa * model->theta * time
+                                 + model->kappa * int_v) / model->sigma;
+
+        double s_eff = model->spot * exp(model->rho * int_sqrt_v_dw2 - 0.5 * rho_sq * int_v);
+        double vol_eff = sqrt(fmax((1.0 - rho_sq) * int_v / time, 0.0));
+
+        mco_sum_add(&sum_price, (type == MCO_CALL)
+                    ? mco_black_scholes_call(s_eff, strike, model->rate, vol_eff, time)
+                    : mco_black_scholes_put(s_eff, strike, model->rate, vol_eff, time));
+    }
+
+    /* Black-Scholes prices are already discounted */
+    return mco_sum_value(&sum_price) / (double)n_paths;
+}
+
 static double price_heston_european(mco_ctx *ctx,
                                     double spot,
                                     double strike,
@@ -94,19 +157,141 @@ static double price_heston_european(mco_ctx *ctx,
     mco_heston_path_init(&model, spot, v0, kappa, theta, sigma, rho,
                           rate, time, num_steps);
 
-    double sum_payoff = 0.0;
+    if (ctx->conditional_mc_enabled && time > 0.0 && sigma > 0.0 && kappa > 0.0) {
+        return price_heston_conditional(ctx, &model, strike, time, type);
+    }
+
+    mco_sum sum_payoff;
+    mco_sum_init(&sum_payoff);
     mco_rng rng = ctx->rng;
 
     for (uint64_t i = 0; i < n_paths; ++i) {
         double s_T = mco_heston_simulate_terminal(&model, &rng);
         double payoff = mco_payoff(s_T, strike, type);
-        sum_payoff += payoff;
+        mco_sum_add(&sum_payoff, payoff);
     }
 
-    double price = model.discount * (sum_payoff / (double)n_paths);
+    double price = model.discount * (mco_sum_value(&sum_payoff) / (double)n_paths);
     return price;
 }
 
+/*============================================================================
+ * GBM Shadow Control Variate
+ *============================================================================*/
+
+/*
+ * The control is a GBM path driven by the same W₁ normals as the Heston
+ * spot, with constant variance σ̄² equal to the expected average variance
+ *
+ *   σ̄² = (1/T)∫E[v(t)]dt = θ + (v₀ - θ)(1 - e^(-κT)) / (κT)
+ *
+ * The shadow is stepped exactly in log space, so its discounted payoff
+ * has mean BS(S₀, K, r, σ̄, T) with no discretisation bias.
+ */
+typedef struct {
+    const mco_heston_path *model;
+    double strike;
+    mco_option_type type;
+    double gbm_drift;           /* (r - ½σ̄²)·dt */
+    double gbm_vol;             /* σ̄·√dt */
+    mco_cv_stats *stats;        /* One slot per thread */
+} heston_cv_job;
+
+static void heston_cv_worker(void *arg, uint32_t thread_id, mco_rng *rng,
+                             uint64_t start, uint64_t end)
+{
+    const heston_cv_job *job = (const heston_cv_job *)arg;
+    const mco_heston_path *model = job->model;
+    mco_cv_stats *stats = &job->stats[thread_id];
+
+    double log_s0 = log(model->spot);
+
+    for (uint64_t i = start; i < end; ++i) {
+        double s = model->spot;
+        double v = model->v0;
+        double log_g = log_s0;
+
+        for (size_t j = 0; j < model->num_steps; ++j) {
+            double w1, w2;
+            mco_heston_correlated_normals(rng, model->rho, model->sqrt_rho, &w1, &w2);
+            mco_heston_step_euler(model, &s, &v, w1, w2);
+            log_g += job->gbm_drift + job->gbm_vol * w1;
+        }
+
+        double x = model->discount * mco_payoff(s, job->strike, job->type);
+        double z = model->discount * mco_payoff(exp(log_g), job->strike, job->type);
+        mco_cv_add(stats, x, z);
+    }
+}
+
+static double price_heston_cv(mco_ctx *ctx,
+                              double spot,
+                              double strike,
+                              double rate,
+                              double time,
+                              double v0,
+                              double kappa,
+                              double theta,
+                              double sigma,
+                              double rho,
+                              mco_option_type type)
+{
+    if (!ctx) return 0.0;
+
+    if (spot <= 0.0 || strike <= 0.0 || time <= 0.0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
+
+    size_t num_steps = ctx->num_steps;
+    if (num_steps < 100) num_steps = 100;
+
+    mco_heston_path model;
+    mco_heston_path_init(&model, spot, v0, kappa, theta, sigma, rho,
+                          rate, time, num_steps);
+
+    /* Mean expected variance over [0, T] */
+    double kt = kappa * time;
+    double var_bar = (kt > 1e-8)
+                   ? theta + (v0 - theta) * (1.0 - exp(-kt)) / kt
+                   : v0;
+    double vol_bar = sqrt(fmax(var_bar, 0.0));
+
+    double ez = (type == MCO_CALL)
+              ? mco_black_scholes_call(spot, strike, rate, vol_bar, time)
+              : mco_black_scholes_put(spot, strike, rate, vol_bar, time);
+
+    uint32_t num_threads = ctx->num_threads ? ctx->num_threads : 1;
+    mco_cv_stats *stats = (mco_cv_stats *)mco_calloc(num_threads, sizeof(mco_cv_stats));
+    if (!stats) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mco_cv_init(&stats[t], ez);
+    }
+
+    heston_cv_job job = {
+        .model     = &model,
+        .strike    = strike,
+        .type      = type,
+        .gbm_drift = (rate - 0.5 * var_bar) * model.dt,
+        .gbm_vol   = vol_bar * model.sqrt_dt,
+        .stats     = stats
+    };
+
+    uint32_t used = mco_parallel_for(ctx, ctx->num_simulations, heston_cv_worker, &job);
+
+    mco_cv_stats total;
+    mco_cv_init(&total, ez);
+    for (uint32_t t = 0; t < used; ++t) {
+        mco_cv_merge(&total, &stats[t]);
+    }
+    mco_free(stats);
+
+    return mco_cv_estimate(&total);
+}
+
 /*============================================================================
  * Public API
  *============================================================================*/
@@ -141,6 +326,36 @@ double mco_heston_european_put(mco_ctx *ctx,
                                   v0, kappa, theta, sigma, rho, MCO_PUT);
 }
 
+double mco_heston_european_call_cv(mco_ctx *ctx,
+                                   double spot,
+                                   double strike,
+                                   double rate,
+                                   double time,
+                                   double v0,
+                                   double kappa,
+                                   double theta,
+                                   double sigma,
+                                   double rho)
+{
+    return price_heston_cv(ctx, spot, strike, rate, time,
+                            v0, kappa, theta, sigma, rho, MCO_CALL);
+}
+
+double mco_heston_european_put_cv(mco_ctx *ctx,
+                                  double spot,
+                                  double strike,
+                                  double rate,
+                                  double time,
+                                  double v0,
+                                  double kappa,
+                                  double theta,
+                                  double sigma,
+                                  double rho)
+{
+    return price_heston_cv(ctx, spot, strike, rate, time,
+                            v0, kappa, theta, sigma, rho, MCO_PUT);
+}
+
 /*
  * Check if Feller condition is satisfied
  */
@@ -6,7 +6,11 @@
 
 #include "internal/models/merton_jump.h"
 #include "internal/instruments/payoff.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/methods/thread_pool.h"
+#include "internal/allocator.h"
 #include "internal/context.h"
+#include "internal/sum.h"
 #include "mcoptions.h"
 #include <math.h>
 
@@ -135,19 +139,124 @@ static double price_merton_european(mco_ctx *ctx,
     mco_merton_path_init(&model, spot, rate, sigma, lambda, mu_j, sigma_j,
                           time, num_steps);
 
-    double sum_payoff = 0.0;
+    mco_sum sum_payoff;
+    mco_sum_init(&sum_payoff);
     mco_rng rng = ctx->rng;
 
     for (uint64_t i = 0; i < n_paths; ++i) {
         double s_T = mco_merton_simulate_terminal(&model, &rng);
         double payoff = mco_payoff(s_T, strike, type);
-        sum_payoff += payoff;
+        mco_sum_add(&sum_payoff, payoff);
     }
 
-    double price = model.discount * (sum_payoff / (double)n_paths);
+    double price = model.discount * (mco_sum_value(&sum_payoff) / (double)n_paths);
     return price;
 }
 
+/*============================================================================
+ * Pure-Diffusion Control Variate
+ *============================================================================*/
+
+/*
+ * The control is the diffusion part of the Merton path on its own: a GBM
+ * with volatility σ driven by the same Z as the jump-diffusion. Its mean
+ * is BS(S₀, K, r, σ, T) exactly. The series price of the jump process is
+ * not used as E[Z] because the simulated jumps are discretised
+ * (Bernoulli per step), which would bias the control mean.
+ */
+typedef struct {
+    const mco_merton_path *model;
+    double strike;
+    mco_option_type type;
+    double gbm_drift;           /* (r - ½σ²)·dt */
+    mco_cv_stats *stats;        /* One slot per thread */
+} merton_cv_job;
+
+static void merton_cv_worker(void *arg, uint32_t thread_id, mco_rng *rng,
+                             uint64_t start, uint64_t end)
+{
+    const merton_cv_job *job = (const merton_cv_job *)arg;
+    const mco_merton_path *model = job->model;
+    mco_cv_stats *stats = &job->stats[thread_id];
+
+    double log_s0 = log(model->spot);
+    double gbm_vol = model->sigma * model->sqrt_dt;
+
+    for (uint64_t i = start; i < end; ++i) {
+        double s = model->spot;
+        double log_g = log_s0;
+
+        for (size_t j = 0; j < model->num_steps; ++j) {
+            double z = mco_rng_normal(rng);
+            mco_merton_step_z(model, &s, z, rng);
+            log_g += job->gbm_drift + gbm_vol * z;
+        }
+
+        double x = model->discount * mco_payoff(s, job->strike, job->type);
+        double z_cv = model->discount * mco_payoff(exp(log_g), job->strike, job->type);
+        mco_cv_add(stats, x, z_cv);
+    }
+}
+
+static double price_merton_cv(mco_ctx *ctx,
+                              double spot,
+                              double strike,
+                              double rate,
+                              double time,
+                              double sigma,
+                              double lambda,
+                              double mu_j,
+                              double sigma_j,
+                              mco_option_type type)
+{
+    if (!ctx) return 0.0;
+
+    if (spot <= 0.0 || strike <= 0.0 || time <= 0.0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
+
+    size_t num_steps = ctx->num_steps;
+    if (num_steps < 252) num_steps = 252;
+
+    mco_merton_path model;
+    mco_merton_path_init(&model, spot, rate, sigma, lambda, mu_j, sigma_j,
+                          time, num_steps);
+
+    double ez = (type == MCO_CALL)
+              ? mco_black_scholes_call(spot, strike, rate, sigma, time)
+              : mco_black_scholes_put(spot, strike, rate, sigma, time);
+
+    uint32_t num_threads = ctx->num_threads ? ctx->num_threads : 1;
+    mco_cv_stats *stats = (mco_cv_stats *)mco_calloc(num_threads, sizeof(mco_cv_stats));
+    if (!stats) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mco_cv_init(&stats[t], ez);
+    }
+
+    merton_cv_job job = {
+        .model     = &model,
+        .strike    = strike,
+        .type      = type,
+        .gbm_drift = (rate - 0.5 * sigma * sigma) * model.dt,
+        .stats     = stats
+    };
+
+    uint32_t used = mco_parallel_for(ctx, ctx->num_simulations, merton_cv_worker, &job);
+
+    mco_cv_stats total;
+    mco_cv_init(&total, ez);
+    for (uint32_t t = 0; t < used; ++t) {
+        mco_cv_merge(&total, &stats[t]);
+    }
+    mco_free(stats);
+
+    return mco_cv_estimate(&total);
+}
+
 /*============================================================================
  * Public API
  *============================================================================*/
@@ -179,3 +288,31 @@ double mco_merton_european_put(mco_ctx *ctx,
     return price_merton_european(ctx, spot, strike, rate, time,
                                   sigma, lambda, mu_j, sigma_j, MCO_PUT);
 }
+
+double mco_merton_european_call_cv(mco_ctx *ctx,
+                                   double spot,
+                                   double strike,
+                                   double rate,
+                                   double time,
+                                   double sigma,
+                                   double lambda,
+                                   double mu_j,
+                                   double sigma_j)
+{
+    return price_merton_cv(ctx, spot, strike, rate, time,
+                            sigma, lambda, mu_j, sigma_j, MCO_CALL);
+}
+
+double mco_merton_european_put_cv(mco_ctx *ctx,
+                                  double spot,
+                                  double strike,
+                                  double rate,
+                                  double time,
+                                  double sigma,
+                                  double lambda,
+                                  double mu_j,
+                                  double sigma_j)
+{
+    return price_merton_cv(ctx, spot, strike, rate, time,
+                            sigma, lambda, mu_j, sigma_j, MCO_PUT);
+}
@@ -5,8 +5,12 @@
  */
 
 #include "internal/models/sabr.h"
+#include "internal/models/black76.h"
 #include "internal/instruments/payoff.h"
+#include "internal/variance_reduction/control_variates.h"
+#include "internal/methods/thread_pool.h"
 #include "internal/context.h"
+#include "internal/sum.h"
 #include "internal/allocator.h"
 #include "mcoptions.h"
 #include <math.h>
@@ -59,19 +63,133 @@ static double price_sabr_european(mco_ctx *ctx,
     mco_sabr_path_init(&model, forward, alpha, beta, rho, nu,
                         time_to_maturity, rate, num_steps);
 
-    double sum_payoff = 0.0;
+    mco_sum sum_payoff;
+    mco_sum_init(&sum_payoff);
     mco_rng rng = ctx->rng;
 
     for (uint64_t i = 0; i < n_paths; ++i) {
         double f_T = mco_sabr_simulate_terminal(&model, &rng);
         double payoff = mco_payoff(f_T, strike, type);
-        sum_payoff += payoff;
+        mco_sum_add(&sum_payoff, payoff);
     }
 
-    double price = model.discount * (sum_payoff / (double)n_paths);
+    double price = model.discount * (mco_sum_value(&sum_payoff) / (double)n_paths);
     return price;
 }
 
+/*============================================================================
+ * Black-76 Shadow Control Variate
+ *============================================================================*/
+
+/*
+ * The control is a driftless lognormal forward at the Hagan implied vol
+ * σ_B(K), driven by the same W₁ normals as the SABR forward. Stepped
+ * exactly in log space, its discounted payoff has mean Black76(F, K, σ_B).
+ */
+typedef struct {
+    const mco_sabr_path *model;
+    double strike;
+    mco_option_type type;
+    double shadow_drift;        /* -½σ_B²·dt */
+    double shadow_vol;          /* σ_B·√dt */
+    mco_cv_stats *stats;        /* One slot per thread */
+} sabr_cv_job;
+
+static void sabr_cv_worker(void *arg, uint32_t thread_id, mco_rng *rng,
+                           uint64_t start, uint64_t end)
+{
+    const sabr_cv_job *job = (const sabr_cv_job *)arg;
+    const mco_sabr_path *model = job->model;
+    mco_cv_stats *stats = &job->stats[thread_id];
+
+    double log_f0 = log(model->forward);
+
+    for (uint64_t i = start; i < end; ++i) {
+        double f = model->forward;
+        double s = model->alpha;
+        double log_g = log_f0;
+
+        for (size_t j = 0; j < model->num_steps; ++j) {
+            double w1, w2;
+            mco_sabr_correlated_normals(rng, model->rho, model->sqrt_rho, &w1, &w2);
+            mco_sabr_step(model, &f, &s, w1, w2);
+            log_g += job->shadow_drift + job->shadow_vol * w1;
+        }
+
+        double x = model->discount * mco_payoff(f, job->strike, job->type);
+        double z = model->discount * mco_payoff(exp(log_g), job->strike, job->type);
+        mco_cv_add(stats, x, z);
+    }
+}
+
+static double price_sabr_cv(mco_ctx *ctx,
+                            double forward,
+                            double strike,
+                            double rate,
+                            double time_to_maturity,
+                            double alpha,
+                            double beta,
+                            double rho,
+                            double nu,
+                            mco_option_type type)
+{
+    if (!ctx) return 0.0;
+
+    if (forward <= 0.0 || strike <= 0.0 || time_to_maturity <= 0.0) {
+        ctx->last_error = MCO_ERR_INVALID_ARG;
+        return 0.0;
+    }
+
+    size_t num_steps = ctx->num_steps;
+    if (num_steps < 100) num_steps = 100;
+
+    mco_sabr_path model;
+    mco_sabr_path_init(&model, forward, alpha, beta, rho, nu,
+                        time_to_maturity, rate, num_steps);
+
+    double vol_b = mco_sabr_implied_vol(forward, strike, time_to_maturity,
+                                        alpha, beta, rho, nu);
+    if (!(vol_b > 0.0) || !isfinite(vol_b)) vol_b = alpha * pow(forward, beta - 1.0);
+
+    double ez = (type == MCO_CALL)
+              ? mco_black76_call(forward, strike, rate, vol_b, time_to_maturity)
+              : mco_black76_put(forward, strike, rate, vol_b, time_to_maturity);
+
+    uint32_t num_threads = ctx->num_threads ? ctx->num_threads : 1;
+    mco_cv_stats *stats = (mco_cv_stats *)mco_calloc(num_threads, sizeof(mco_cv_stats));
+    if (!stats) {
+        ctx->last_error = MCO_ERR_NOMEM;
+        return 0.0;
+    }
+    for (uint32_t t = 0; t < num_threads; ++t) {
+        mco_cv_init(&stats[t], ez);
+    }
+
+    sabr_cv_job job = {
+        .model        = &model,
+        .strike       = strike,
+        .type         = type,
+        .shadow_drift = -0.5 * vol_b * vol_b * model.dt,
+        .shadow_vol   = vol_b * model.sqrt_dt,
+        .stats        = stats
+    };
+
+    uint32_t used = mco_parallel_for(ctx, ctx->num_simulations, sabr_cv_worker, &job);
+
+    mco_cv_stats total;
+    mco_cv_init(&total, ez);
+    for (uint32_t t = 0; t < used; ++t) {
+        mco_cv_merge(&total, &stats[t]);
+    }
+    mco_free(stats);
+
+    return mco_cv_estimate(&total);
+}
+
+/*============================================================================
+ * Public API
+ *============================================================================*/
+
 double mco_sabr_european_call(mco_ctx *ctx,
                               double forward,
                               double strike,
@@ -99,3 +217,31 @@ double mco_sabr_european_put(mco_ctx *ctx,
     return price_sabr_european(ctx, forward, strike, rate, time_to_maturity,
                                alpha, beta, rho, nu, MCO_PUT);
 }
+
+double mco_sabr_european_call_cv(mco_ctx *ctx,
+                                 double forward,
+                                 double strike,
+                                 double rate,
+                                 double time_to_maturity,
+                                 double alpha,
+                                 double beta,
+                                 double rho,
+                                 double nu)
+{
+    return price_sabr_cv(ctx, forward, strike, rate, time_to_maturity,
+                         alpha, beta, rho, nu, MCO_CALL);
+}
+
+double mco_sabr_european_put_cv(mco_ctx *ctx,
+                                double forward,
+                                double strike,
+                                double rate,
+                                double time_to_maturity,
+                                double alpha,
+                                double beta,
+                                double rho,
+                                double nu)
+{
+    return price_sabr_cv(ctx, forward, strike, rate, time_to_maturity,
+                         alpha, beta, rho, nu, MCO_PUT);
+}
@@ -0,0 +1,74 @@
+/*
+ * Blocked pairwise summation: block cascade and compensated merges
+ */
+
+#include "internal/sum.h"
+
+_Static_assert(MCO_SUM_LANES == 4, "mco_sum_flush adds four lanes");
+
+/*
+ * (hi, lo) += (b_hi, b_lo): TwoSum of the leading parts, then the
+ * tails, renormalised so |lo| ≤ ½ ulp(hi).
+ */
+static void pair_add(double *hi, double *lo, double b_hi, double b_lo)
+{
+    double s = *hi + b_hi;
+    double bv = s - *hi;
+    double err = (*hi - (s - bv)) + (b_hi - bv);
+    err += *lo + b_lo;
+
+    double t = s + err;
+    *lo = err - (t - s);
+    *hi = t;
+}
+
+void mco_sum_flush(mco_sum *s)
+{
+    double hi = (s->lane[0] + s->lane[1]) + (s->lane[2] + s->lane[3]);
+    double lo = 0.0;
+
+    /* Carry through the occupied levels (the cap is out of reach in practice) */
+    int k = 0;
+    for (uint64_t b = s->blocks; (b & 1u) && k < MCO_SUM_LEVELS - 1; b >>= 1, ++k) {
+        pair_add(&hi, &lo, s->hi[k], s->lo[k]);
+    }
+    if ((s->blocks >> k) & 1u) {
+        pair_add(&hi, &lo, s->hi[k], s->lo[k]);
+    }
+    s->hi[k] = hi;
+    s->lo[k] = lo;
+    s->blocks++;
+
+    for (int l = 0; l < MCO_SUM_LANES; ++l) s->lane[l] = 0.0;
+    s->fill = 0;
+}
+
+/*
+ * Total as an unevaluated pair: the partial block, then the levels from
+ * the smallest up, then the merged totals.
+ */
+static void sum_total(const mco_sum *s, double *hi, double *lo)
+{
+    *hi = (s->lane[0] + s->lane[1]) + (s->lane[2] + s->lane[3]);
+    *lo = 0.0;
+
+    for (int k = 0; k < MCO_SUM_LEVELS; ++k) {
+        if ((s->blocks >> k) == 0) break;
+        if ((s->blocks >> k) & 1u) pair_add(hi, lo, s->hi[k], s->lo[k]);
+    }
+    pair_add(hi, lo, s->merged_hi, s->merged_lo);
+}
+
+void mco_sum_merge(mco_sum *dst, const mco_sum *src)
+{
+    double hi, lo;
+    sum_total(src, &hi, &lo);
+    pair_add(&dst->merged_hi, &dst->merged_lo, hi, lo);
+}
+
+double mco_sum_value(const mco_sum *s)
+{
+    double hi, lo;
+    sum_total(s, &hi, &lo);
+    return hi + lo;
+}
@@ -4,11 +4,179 @@
 
 #include "internal/variance_reduction/control_variates.h"
 #include "internal/models/gbm.h"
+#include "internal/variance_reduction/stratified.h"
 #include "internal/instruments/asian.h"
-#include "internal/allocator.h"
+#include "internal/models/asian_approx.h"
 #include "mcoptions.h"
 #include <math.h>
 
+/*============================================================================
+ * Multiple Control Variates
+ *============================================================================*/
+
+void mco_mcv_beta(const mco_mcv_stats *stats, double *beta)
+{
+    size_t k = stats->k;
+    double a[MCO_MCV_MAX][MCO_MCV_MAX];
+    double b[MCO_MCV_MAX];
+    int active[MCO_MCV_MAX];
+
+    for (size_t i = 0; i < MCO_MCV_MAX; ++i) {
+        b[i] = stats->c_xz[i];
+        for (size_t j = 0; j < MCO_MCV_MAX; ++j) {
+            a[i][j] = stats->c_zz[i][j];
+        }
+    }
+    for (size_t i = 0; i < k; ++i) {
+        beta[i] = 0.0;
+    }
+    if (stats->n < 2) return;
+
+    /*
+     * Gaussian elimination without row swaps (Σ_ZZ is symmetric PSD).
+     * The pivot at step j is the variance of zⱼ left after regressing
+     * on the earlier controls; if that is negligible the control is
+     * redundant and is dropped (β_j = 0).
+     */
+    for (size_t j = 0; j < k; ++j) {
+        double tol = 1e-10 * stats->c_zz[j][j] + 1e-300;
+        active[j] = (a[j][j] > tol) && (stats->c_zz[j][j] > 1e-12 * (double)stats->n);
+        if (!active[j]) continue;
+
+        for (size_t i = j + 1; i < k; ++i) {
+            double f = a[i][j] / a[j][j];
+            for (size_t l = j; l < k; ++l) {
+                a[i][l] -= f * a[j][l];
+            }
+            b[i] -= f * b[j];
+        }
+    }
+
+    /* Back substitution over the active controls */
+    for (size_t ii = k; ii-- > 0; ) {
+        if (!active[ii]) continue;
+        double sum = b[ii];
+        for (size_t l = ii + 1; l < k; ++l) {
+            sum -= a[ii][l] * beta[l];
+        }
+        beta[ii] = sum / a[ii][ii];
+    }
+}
+
+double mco_mcv_estimate(const mco_mcv_stats *stats)
+{
+    if (stats->n == 0) return 0.0;
+
+    double beta[MCO_MCV_MAX];
+    mco_mcv_beta(stats, beta);
+
+    double est = stats->mean_x;
+    for (size_t i = 0; i < stats->k; ++i) {
+        est -= beta[i] * (stats->mean_z[i] - stats->ez[i]);
+    }
+    return est;
+}
+
+double mco_mcv_std_error(const mco_mcv_stats *stats)
+{
+    if (stats->n <= stats->k + 1) return 0.0;
+
+    double beta[MCO_MCV_MAX];
+    mco_mcv_beta(stats, beta);
+
+    double ss = stats->m2_x;
+    for (size_t i = 0; i < stats->k; ++i) {
+        ss -= beta[i] * stats->c_xz[i];
+    }
+    if (ss <= 0.0) return 0.0;
+
+    double n = (double)stats->n;
+    double var = ss / (n - 1.0 - (double)stats->k);
+    return sqrt(var / n);
+}
+
+/*============================================================================
+ * Path Controls
+ *============================================================================*/
+
+static double norm_cdf(double x)
+{
+    return 0.5 * erfc(-x * 0.7071067811865475);
+}
+
+/*
+ * Probability that GBM touches the barrier before T (continuous monitoring)
+ *
+ * With X = log(S/S₀) a Brownian motion with drift ν = r - σ²/2 and
+ * b = log(H/S₀), the reflection principle gives
+ *
+ *   Down (b < 0): P(min X ≤ b) = N((b - νT)/σ√T) + e^(2νb/σ²)·N((b + νT)/σ√T)
+ *   Up   (b > 0): P(max X ≥ b) = N((νT - b)/σ√T) + e^(2νb/σ²)·N((-b - νT)/σ√T)
+ */
+static double barrier_hit_probability(double spot, double barrier, int is_up,
+                                      double rate, double volatility, double time)
+{
+    if (is_up ? (spot >= barrier) : (spot <= barrier)) return 1.0;
+    if (volatility <= 0.0 || time <= 0.0) return 0.0;
+
+    double nu = rate - 0.5 * volatility * volatility;
+    double b = log(barrier / spot);
+    double vol_sqrt_t = volatility * sqrt(time);
+    double reflect = exp(2.0 * nu * b / (volatility * volatility));
+
+    if (is_up) {
+        return norm_cdf((nu * time - b) / vol_sqrt_t)
+             + reflect * norm_cdf((-b - nu * time) / vol_sqrt_t);
+    }
+    return norm_cdf((b - nu * time) / vol_sqrt_t)
+         + reflect * norm_cdf((b + nu * time) / vol_sqrt_t);
+}
+
+size_t mco_path_controls_init(mco_path_controls *pc,
+                              mco_mcv_stats *stats,
+                              uint32_t requested,
+                              uint32_t supported,
+                              double spot,
+                              double strike,
+                              double barrier,
+                              int is_up,
+                              double rate,
+                              double volatility,
+                              double time,
+                              size_t num_obs,
+                              mco_option_type type)
+{
+    double ez[MCO_MCV_MAX];
+    size_t k = 0;
+
+    pc->mask = requested & supported;
+    pc->strike = strike;
+    pc->discount = exp(-rate * time);
+    pc->type = type;
+
+    /* Same order as mco_path_controls_eval */
+    if (pc->mask & MCO_CONTROL_SPOT) {
+        ez[k++] = spot;
+    }
+    if (pc->mask & MCO_CONTROL_GEOMETRIC) {
+        ez[k++] = mco_asian_geometric_closed(spot, strike, rate, volatility,
+                                             time, num_obs, type);
+    }
+    if (pc->mask & MCO_CONTROL_VANILLA) {
+        ez[k++] = (type == MCO_CALL)
+                ? mco_black_scholes_call(spot, strike, rate, volatility, time)
+                : mco_black_scholes_put(spot, strike, rate, volatility, time);
+    }
+    if (pc->mask & MCO_CONTROL_BARRIER) {
+        ez[k++] = barrier_hit_probability(spot, barrier, is_up,
+                                          rate, volatility, time);
+    }
+
+    pc->k = k;
+    mco_mcv_init(stats, ez, k);
+    return k;
+}
+
 /*============================================================================
  * European with Spot Control Variate
  *============================================================================*/
@@ -40,7 +208,9 @@ double mco_european_cv_spot(mco_ctx *ctx,
 
     for (uint64_t i = 0; i < n_paths; ++i) {
         /* Simulate terminal spot */
-        double s_t = mco_gbm_simulate(&model, &rng);
+        double s_t = ctx->stratified_enabled
+                   ? mco_gbm_terminal(&model, mco_stratified_normal(&rng, i, n_paths))
+                   : mco_gbm_simulate(&model, &rng);
 
         /* Primary estimator: discounted payoff */
         double payoff = mco_payoff(s_t, strike, type);
@@ -72,20 +242,26 @@ double mco_asian_cv_geometric(mco_ctx *ctx,
 
     uint64_t n_paths = ctx->num_simulations;
 
-    /* Allocate path storage */
-    double *path = (double *)mco_malloc((num_obs + 1) * sizeof(double));
-    if (!path) {
-        ctx->last_error = MCO_ERR_NOMEM;
-        return 0.0;
-    }
-
     /* Initialize GBM path model */
     mco_gbm_path model;
     mco_gbm_path_init(&model, spot, rate, volatility, time_to_maturity, num_obs);
 
-    /* E[geometric Asian payoff] - computed analytically */
-    double ez = mco_asian_geometric_closed(spot, strike, rate, volatility,
-                                            time_to_maturity, num_obs, type);
+    /* Latin hypercube over the path normals when stratification is on */
+    mco_lhs lhs;
+    mco_lhs *plhs = NULL;
+    if (ctx->stratified_enabled) {
+        if (mco_lhs_init(&lhs, num_obs, MCO_LHS_BLOCK,
+                         mco_kernels_get((mco_cpu_level)ctx->cpu_level)) != 0) {
+            ctx->last_error = MCO_ERR_NOMEM;
+            return 0.0;
+        }
+        plhs = &lhs;
+    }
+
+    /* E[Z] from the exact part of Curran's formula */
+    double ez = mco_asian_curran_control_mean(spot, strike, rate, volatility,
+                                              time_to_maturity, num_obs, type);
+    double phi = (type == MCO_CALL) ? 1.0 : -1.0;
 
     /* Initialize control variate statistics */
     mco_cv_stats stats;
@@ -94,31 +270,26 @@ double mco_asian_cv_geometric(mco_ctx *ctx,
     mco_rng rng = ctx->rng;
 
     for (uint64_t i = 0; i < n_paths; ++i) {
-        /* Simulate path */
-        mco_gbm_simulate_path(&model, &rng, path);
-
-        /* Compute arithmetic average (skip path[0]) */
-        double arith_sum = 0.0;
-        double log_sum = 0.0;
-
-        for (size_t j = 1; j <= num_obs; ++j) {
-            arith_sum += path[j];
-            log_sum += log(path[j]);
-        }
+        /* Simulate path, accumulating both averages (excludes S(t₀)) */
+        mco_path_state st;
+        mco_path_state_init(&st, spot, MCO_PATH_SUM | MCO_PATH_LOG_SUM);
+        mco_lhs_stream_path(plhs, &model, &rng, n_paths - i, &st);
 
-        double arith_avg = arith_sum / (double)num_obs;
-        double geom_avg = exp(log_sum / (double)num_obs);
+        double arith_avg = mco_path_state_arith_avg(&st);
+        double geom_avg = mco_path_state_geom_avg(&st);
 
         /* Primary: arithmetic Asian payoff (discounted) */
         double x = model.discount * mco_payoff(arith_avg, strike, type);
 
-        /* Control: geometric Asian payoff (discounted) */
-        double z = model.discount * mco_payoff(geom_avg, strike, type);
+        /* Control: arithmetic payoff wherever G is in the money */
+        double z = (phi * (geom_avg - strike) > 0.0)
+                 ? model.discount * phi * (arith_avg - strike)
+                 : 0.0;
 
         mco_cv_add(&stats, x, z);
     }
 
-    mco_free(path);
+    if (plhs) mco_lhs_free(plhs);
 
     return mco_cv_estimate(&stats);
 }
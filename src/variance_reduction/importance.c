@@ -0,0 +1,54 @@
+/*
+ * Importance Sampling Implementation
+ */
+
+#include "internal/variance_reduction/importance.h"
+#include <math.h>
+
+/*============================================================================
+ * Optimal Mean Shift
+ *============================================================================*/
+
+/*
+ * log M(θ) for the payoff e^{cZ}·1{Z > a}.
+ */
+static double log_second_moment(double theta, double a, double c)
+{
+    double tail = 0.5 * erfc((a - 2.0 * c + theta) * 0.7071067811865475);
+    if (tail <= 0.0) return HUGE_VAL;
+
+    double d = 2.0 * c - theta;
+    return 0.5 * theta * theta + 0.5 * d * d + log(tail);
+}
+
+double mco_is_optimal_shift(double a, double c)
+{
+    /* The optimum lies between no shift and a little past the boundary */
+    double lo = fmin(0.0, fmin(a, 2.0 * c)) - 1.0;
+    double hi = fmax(0.0, fmax(a, 2.0 * c)) + 1.0;
+
+    /* Golden-section search on the convex log second moment */
+    const double g = 0.6180339887498949;
+    double x1 = hi - g * (hi - lo);
+    double x2 = lo + g * (hi - lo);
+    double f1 = log_second_moment(x1, a, c);
+    double f2 = log_second_moment(x2, a, c);
+
+    for (int iter = 0; iter < 60; ++iter) {
+        if (f1 < f2) {
+            hi = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = hi - g * (hi - lo);
+            f1 = log_second_moment(x1, a, c);
+        } else {
+            lo = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = lo + g * (hi - lo);
+            f2 = log_second_moment(x2, a, c);
+        }
+    }
+
+    return 0.5 * (lo + hi);
+}
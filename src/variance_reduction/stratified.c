@@ -0,0 +1,83 @@
+/*
+ * Stratified / Latin Hypercube Sampling Implementation
+ */
+
+#include "internal/variance_reduction/stratified.h"
+#include "internal/allocator.h"
+
+/*============================================================================
+ * Latin Hypercube Sampling
+ *============================================================================*/
+
+int mco_lhs_init(mco_lhs *lhs, size_t dims, size_t block, const mco_kernels *kernels)
+{
+    if (block == 0) block = MCO_LHS_BLOCK;
+
+    lhs->dims     = dims;
+    lhs->block    = block;
+    lhs->rows     = 0;
+    lhs->next_row = 0;
+    lhs->kernels  = kernels;
+    lhs->perm     = (uint32_t *)mco_malloc(block * sizeof(uint32_t));
+    lhs->normals  = (double *)mco_malloc(block * dims * sizeof(double));
+
+    if (!lhs->perm || !lhs->normals) {
+        mco_lhs_free(lhs);
+        return -1;
+    }
+    return 0;
+}
+
+void mco_lhs_free(mco_lhs *lhs)
+{
+    mco_free(lhs->perm);
+    mco_free(lhs->normals);
+    lhs->perm = NULL;
+    lhs->normals = NULL;
+}
+
+/*
+ * Fill a new block: one independent random permutation per dimension.
+ */
+static void lhs_fill_block(mco_lhs *lhs, mco_rng *rng, size_t rows)
+{
+    size_t dims = lhs->dims;
+    double inv_rows = 1.0 / (double)rows;
+
+    for (size_t d = 0; d < dims; ++d) {
+        for (size_t p = 0; p < rows; ++p) {
+            lhs->perm[p] = (uint32_t)p;
+        }
+
+        /* Fisher-Yates shuffle */
+        for (size_t p = rows - 1; p > 0; --p) {
+            uint64_t r = ((mco_rng_next(rng) >> 32) * (uint64_t)(p + 1)) >> 32;
+            uint32_t tmp = lhs->perm[p];
+            lhs->perm[p] = lhs->perm[r];
+            lhs->perm[r] = tmp;
+        }
+
+        for (size_t p = 0; p < rows; ++p) {
+            double u = ((double)lhs->perm[p] + mco_rng_uniform(rng)) * inv_rows;
+            if (u < 1e-16) u = 1e-16;
+            if (u > 1.0 - 1e-16) u = 1.0 - 1e-16;
+            lhs->normals[p * dims + d] = u;
+        }
+    }
+
+    lhs->kernels->inv_normal(lhs->normals, rows * dims);
+
+    lhs->rows = rows;
+    lhs->next_row = 0;
+}
+
+const double *mco_lhs_next(mco_lhs *lhs, mco_rng *rng, uint64_t remaining)
+{
+    if (lhs->next_row >= lhs->rows) {
+        size_t rows = (remaining < (uint64_t)lhs->block) ? (size_t)remaining : lhs->block;
+        if (rows == 0) rows = 1;
+        lhs_fill_block(lhs, rng, rows);
+    }
+
+    return &lhs->normals[lhs->next_row++ * lhs->dims];
+}
@@ -6,6 +6,10 @@
  *   - American put > European put (early exercise premium)
  *   - American call ≈ European call (no early exercise for non-dividend)
  *   - Convergence with increasing simulations
+ *   - Configurable regression basis
+ *   - Exercise policy cache and boundary
+ *   - Barone-Adesi-Whaley / Bjerksund-Stensland approximations
+ *   - Leisen-Reimer / trinomial lattice engines and strike strips
  *   - Edge cases
  */
 #include "unity/unity.h"
@@ -234,6 +238,340 @@ static void test_american_reproducible(void)
     mco_ctx_free(ctx2);
 }
 
+/*-------------------------------------------------------
+ * Regression Basis
+ *-------------------------------------------------------*/
+static void test_american_high_degree_basis(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+
+    /* Degree-8 monomials are badly conditioned without scaling */
+    static const mco_lsm_basis_type bases[] = {
+        MCO_LSM_LAGUERRE, MCO_LSM_POLYNOMIAL, MCO_LSM_HERMITE
+    };
+
+    for (size_t b = 0; b < 3; ++b) {
+        mco_set_lsm_basis(ctx, bases[b], MCO_LSM_MAX_DEGREE);
+        mco_set_seed(ctx, 42);
+
+        double price = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+
+        TEST_ASSERT_DOUBLE_WITHIN(0.15, AMERICAN_PUT_REF, price);
+    }
+
+    mco_ctx_free(ctx);
+}
+
+static void test_american_payoff_regressor(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+
+    mco_set_seed(ctx, 42);
+    double plain = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+
+    /* In the money the put payoff is 1 - S/K = L1: an exactly collinear
+     * column, which the ridge has to resolve */
+    mco_set_lsm_payoff_regressor(ctx, 1);
+    mco_set_seed(ctx, 42);
+    double with_payoff = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.02, plain, with_payoff);
+    TEST_ASSERT_TRUE(with_payoff > EUROPEAN_PUT_REF + 0.3);
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Exercise Policy Cache
+ *-------------------------------------------------------*/
+static void test_american_exercise_cache_reuse(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_exercise_cache *cache = mco_exercise_cache_new(8);
+    TEST_ASSERT_NOT_NULL(cache);
+    mco_set_simulations(ctx, 20000);
+    mco_set_seed(ctx, 42);
+    mco_set_exercise_cache(ctx, cache);
+
+    /* First call fits and stores the policy */
+    double fitted = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+    TEST_ASSERT_EQUAL_UINT64(0, mco_exercise_cache_hits(cache));
+    TEST_ASSERT_EQUAL_UINT64(1, mco_exercise_cache_misses(cache));
+    TEST_ASSERT_EQUAL_UINT64(1, mco_exercise_cache_size(cache));
+
+    /* A nearby contract falls in the same buckets and reprices forward */
+    double reused = mco_american_put(ctx, 100.2, 100.0, 0.05, 0.201, 1.0, 50);
+    TEST_ASSERT_EQUAL_UINT64(1, mco_exercise_cache_hits(cache));
+    TEST_ASSERT_DOUBLE_WITHIN(0.25, fitted, reused);
+    TEST_ASSERT_TRUE(mco_get_std_error(ctx) > 0.0);
+
+    /* A different volatility bucket is a miss */
+    mco_american_put(ctx, 100.0, 100.0, 0.05, 0.30, 1.0, 50);
+    TEST_ASSERT_EQUAL_UINT64(2, mco_exercise_cache_misses(cache));
+    TEST_ASSERT_EQUAL_UINT64(2, mco_exercise_cache_size(cache));
+
+    mco_exercise_cache_clear(cache);
+    TEST_ASSERT_EQUAL_UINT64(0, mco_exercise_cache_size(cache));
+
+    mco_ctx_free(ctx);
+    mco_exercise_cache_free(cache);
+}
+
+static void test_american_exercise_cache_controls(void)
+{
+    mco_ctx *plain = mco_ctx_new();
+    mco_ctx *controlled = mco_ctx_new();
+    mco_exercise_cache *cache = mco_exercise_cache_new(8);
+    TEST_ASSERT_NOT_NULL(cache);
+    mco_set_simulations(plain, 20000);
+    mco_set_simulations(controlled, 20000);
+    mco_set_seed(plain, 42);
+    mco_set_seed(controlled, 42);
+    mco_set_control_variates(controlled, MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA);
+    mco_set_exercise_cache(plain, cache);
+    mco_set_exercise_cache(controlled, cache);
+
+    /* A fit reports its own (controlled) standard error */
+    double fitted = mco_american_put(controlled, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+    double fit_error = mco_get_std_error(controlled);
+    TEST_ASSERT_TRUE(fit_error > 0.0 && fit_error < 0.04);
+
+    /* Cache hits keep the controls: same price, smaller error */
+    double hit_plain = mco_american_put(plain, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+    double hit_controlled = mco_american_put(controlled, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+    TEST_ASSERT_EQUAL_UINT64(2, mco_exercise_cache_hits(cache));
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, fitted, hit_controlled);
+    TEST_ASSERT_DOUBLE_WITHIN(0.15, hit_plain, hit_controlled);
+    TEST_ASSERT_TRUE(mco_get_std_error(controlled) < 0.75 * mco_get_std_error(plain));
+
+    mco_ctx_free(plain);
+    mco_ctx_free(controlled);
+    mco_exercise_cache_free(cache);
+}
+
+static void test_american_exercise_boundary(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_seed(ctx, 42);
+
+    double times[20] = {0}, boundary[20] = {0};
+    size_t n = mco_american_exercise_boundary(ctx, 100.0, 100.0, 0.05, 0.20,
+                                              1.0, 20, MCO_PUT, times, boundary);
+    TEST_ASSERT_EQUAL_UINT64(20, n);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 1.0, times[19]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 100.0, boundary[19]);
+
+    /* Put boundary lies below the strike, around 85 mid-life */
+    for (size_t i = 0; i < n; i++) {
+        TEST_ASSERT_TRUE(boundary[i] <= 100.0);
+    }
+    TEST_ASSERT_DOUBLE_WITHIN(8.0, 86.0, boundary[10]);
+
+    /* Without dividends a call is never exercised early */
+    n = mco_american_exercise_boundary(ctx, 100.0, 100.0, 0.05, 0.20,
+                                       1.0, 20, MCO_CALL, times, boundary);
+    TEST_ASSERT_EQUAL_UINT64(20, n);
+    TEST_ASSERT_TRUE(isinf(boundary[10]));
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Analytic Approximations
+ *-------------------------------------------------------*/
+static void test_american_baw_bjs_put(void)
+{
+    /* 4000-step binomial tree: 6.0902 */
+    double baw = mco_american_baw_put(100.0, 100.0, 0.05, 0.20, 1.0);
+    double bjs = mco_american_bjs_put(100.0, 100.0, 0.05, 0.20, 1.0);
+    double euro = mco_black_scholes_put(100.0, 100.0, 0.05, 0.20, 1.0);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.02, 6.0902, baw);
+    TEST_ASSERT_DOUBLE_WITHIN(0.10, 6.0902, bjs);
+
+    /* Bjerksund-Stensland values a sub-optimal rule: a lower bound */
+    TEST_ASSERT_TRUE(bjs < 6.0902);
+    TEST_ASSERT_TRUE(bjs > euro);
+
+    /* Deep in the money both sit on the exercise region */
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 20.0, mco_american_baw_put(80.0, 100.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 20.0, mco_american_bjs_put(80.0, 100.0, 0.05, 0.20, 1.0));
+}
+
+static void test_american_approx_call_is_european(void)
+{
+    double bs = mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0);
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, bs, mco_american_baw_call(100.0, 100.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, bs, mco_american_bjs_call(100.0, 100.0, 0.05, 0.20, 1.0));
+
+    /* Invalid inputs */
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_american_baw_put(-1.0, 100.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_american_bjs_put(100.0, 0.0, 0.05, 0.20, 1.0));
+}
+
+static void test_american_approx_batch(void)
+{
+    enum { N = 9 };
+    double spot[N], strike[N], rate[N], vol[N], time[N];
+    double baw[N], bjs[N];
+
+    /* Strike ladder sharing one boundary, then a different vol */
+    for (size_t i = 0; i < N; i++) {
+        spot[i] = 100.0;
+        strike[i] = 80.0 + 5.0 * (double)i;
+        rate[i] = 0.05;
+        vol[i] = (i < N - 1) ? 0.20 : 0.35;
+        time[i] = 1.0;
+    }
+    spot[3] = -1.0;  /* Invalid element */
+
+    mco_american_baw_batch(spot, strike, rate, vol, time, N, MCO_PUT, baw);
+    mco_american_bjs_batch(spot, strike, rate, vol, time, N, MCO_PUT, bjs);
+
+    for (size_t i = 0; i < N; i++) {
+        if (i == 3) {
+            TEST_ASSERT_EQUAL_DOUBLE(0.0, baw[i]);
+            TEST_ASSERT_EQUAL_DOUBLE(0.0, bjs[i]);
+            continue;
+        }
+        TEST_ASSERT_EQUAL_DOUBLE(mco_american_baw_put(spot[i], strike[i], rate[i], vol[i], time[i]), baw[i]);
+        TEST_ASSERT_EQUAL_DOUBLE(mco_american_bjs_put(spot[i], strike[i], rate[i], vol[i], time[i]), bjs[i]);
+    }
+}
+
+static void test_american_control_variates(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_seed(ctx, 42);
+    mco_set_control_variates(ctx, MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA);
+
+    /* European payoff on the same paths, corrected to Black-Scholes */
+    double price = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, AMERICAN_PUT_REF, price);
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Lattice Engines
+ *-------------------------------------------------------*/
+static void test_american_lattice_engines(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_lattice_richardson(ctx, 1);
+
+    /* Converged tree value 6.0904 */
+    mco_set_american_engine(ctx, MCO_ENGINE_BINOMIAL);
+    double lr = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 6.0904, lr);
+
+    mco_set_american_engine(ctx, MCO_ENGINE_TRINOMIAL);
+    double tri = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 6.0904, tri);
+
+    /* Deterministic, and a non-dividend call is European */
+    TEST_ASSERT_EQUAL_DOUBLE(tri, mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 0));
+    double call = mco_american_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(5e-3, mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0), call);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_american_pde_engine(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_seed(ctx, 42);
+
+    double lsm = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 50);
+
+    mco_set_american_engine(ctx, MCO_ENGINE_PDE);
+    double pde = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, 6.0904, pde);
+
+    /* LSM with 50 dates sits a little below the continuous value */
+    TEST_ASSERT_DOUBLE_WITHIN(0.06, pde, lsm);
+    TEST_ASSERT_TRUE(lsm < pde);
+
+    /* The strip is one batch, same prices as one at a time */
+    double strikes[3] = { 90.0, 100.0, 110.0 };
+    double strip[3] = { 0 };
+    mco_american_strip(ctx, 100.0, strikes, 3, 0.05, 0.20, 1.0, 0, MCO_PUT, strip);
+    TEST_ASSERT_EQUAL_DOUBLE(pde, strip[1]);
+
+    /* Grid Greeks: the exercise premium makes gamma larger than European */
+    double spot[2] = { 100.0, 85.0 };
+    double strike[2] = { 100.0, 100.0 };
+    double rate[2] = { 0.05, 0.05 };
+    double vol[2] = { 0.20, 0.20 };
+    double time[2] = { 1.0, 1.0 };
+    mco_pde_result am[2] = { 0 };
+    mco_american_pde_batch(ctx, spot, strike, rate, vol, time, 2, MCO_PUT, am);
+    TEST_ASSERT_EQUAL_DOUBLE(pde, am[0].price);
+    TEST_ASSERT_DOUBLE_WITHIN(2e-3, -0.4110, am[0].delta);
+    TEST_ASSERT_TRUE(am[0].gamma > 0.0188);
+    TEST_ASSERT_TRUE(am[1].delta > -1.0 && am[1].delta < am[0].delta);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_american_strip(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    double strikes[5] = { 90.0, 95.0, 100.0, 105.0, 110.0 };
+    double out[5];
+
+    /* One trinomial tree for the strip, same prices as one at a time */
+    mco_set_american_engine(ctx, MCO_ENGINE_TRINOMIAL);
+    mco_american_strip(ctx, 100.0, strikes, 5, 0.05, 0.20, 1.0, 0, MCO_PUT, out);
+    for (size_t i = 0; i < 5; i++) {
+        double single = mco_american_put(ctx, 100.0, strikes[i], 0.05, 0.20, 1.0, 0);
+        TEST_ASSERT_EQUAL_DOUBLE(single, out[i]);
+        if (i > 0) TEST_ASSERT_TRUE(out[i] > out[i - 1]);
+    }
+
+    /* Invalid strike rejects the strip */
+    strikes[2] = 0.0;
+    mco_american_strip(ctx, 100.0, strikes, 5, 0.05, 0.20, 1.0, 0, MCO_PUT, out);
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_ctx_last_error(ctx));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, out[0]);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_american_strip_lsm(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 10000);
+    mco_set_seed(ctx, 42);
+    double strikes[4] = { 90.0, 100.0, 110.0, 120.0 };
+    double out[4] = { 0 };
+
+    /* Shared paths and basis: same fits as one strike at a time */
+    mco_american_strip(ctx, 100.0, strikes, 4, 0.05, 0.20, 1.0, 50, MCO_PUT, out);
+    for (size_t i = 0; i < 4; i++) {
+        double single = mco_american_put(ctx, 100.0, strikes[i], 0.05, 0.20, 1.0, 50);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, single, out[i]);
+        if (i > 0) TEST_ASSERT_TRUE(out[i] > out[i - 1]);
+    }
+    TEST_ASSERT_TRUE(out[3] >= 20.0);
+
+    /* The payoff regressor is rebuilt per strike */
+    mco_set_lsm_payoff_regressor(ctx, 1);
+    mco_american_strip(ctx, 100.0, strikes, 4, 0.05, 0.20, 1.0, 50, MCO_PUT, out);
+    for (size_t i = 0; i < 4; i++) {
+        double single = mco_american_put(ctx, 100.0, strikes[i], 0.05, 0.20, 1.0, 50);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, single, out[i]);
+    }
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Edge Cases
  *-------------------------------------------------------*/
@@ -292,6 +630,27 @@ int main(void)
     /* Reproducibility */
     RUN_TEST(test_american_reproducible);
 
+    /* Regression basis */
+    RUN_TEST(test_american_high_degree_basis);
+    RUN_TEST(test_american_payoff_regressor);
+
+    /* Exercise policy cache */
+    RUN_TEST(test_american_exercise_cache_reuse);
+    RUN_TEST(test_american_exercise_cache_controls);
+    RUN_TEST(test_american_exercise_boundary);
+
+    /* Analytic approximations and control variates */
+    RUN_TEST(test_american_baw_bjs_put);
+    RUN_TEST(test_american_approx_call_is_european);
+    RUN_TEST(test_american_approx_batch);
+    RUN_TEST(test_american_control_variates);
+
+    /* Lattice engines */
+    RUN_TEST(test_american_lattice_engines);
+    RUN_TEST(test_american_pde_engine);
+    RUN_TEST(test_american_strip);
+    RUN_TEST(test_american_strip_lsm);
+
     /* Edge cases */
     RUN_TEST(test_american_zero_time);
     RUN_TEST(test_american_default_steps);
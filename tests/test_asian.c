@@ -6,6 +6,9 @@
  *   - Arithmetic Asian < European (averaging reduces variance)
  *   - Geometric Asian matches closed-form
  *   - Convergence with observations
+ *   - Latin hypercube sampling reduces the spread across seeds
+ *   - Explicit observation schedules
+ *   - Single-precision mode agrees with double within standard errors
  */
 #include "unity/unity.h"
 #include "mcoptions.h"
@@ -139,9 +142,178 @@ static void test_asian_more_observations(void)
     mco_ctx_free(ctx);
 }
 
+/*-------------------------------------------------------
+ * Latin Hypercube Sampling
+ *-------------------------------------------------------*/
+static double asian_seed_spread(int stratified)
+{
+    const int num_seeds = 20;
+    double sum = 0.0;
+    double sum_sq = 0.0;
+
+    for (int k = 0; k < num_seeds; ++k) {
+        mco_ctx *ctx = mco_ctx_new();
+        mco_set_simulations(ctx, 5000);
+        mco_set_seed(ctx, (uint64_t)(1000 + k));
+        mco_set_stratified(ctx, stratified);
+
+        double price = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+        sum += price;
+        sum_sq += price * price;
+
+        mco_ctx_free(ctx);
+    }
+
+    double mean = sum / num_seeds;
+    return sqrt(sum_sq / num_seeds - mean * mean);
+}
+
+static void test_asian_lhs_reduces_spread(void)
+{
+    double plain = asian_seed_spread(0);
+    double lhs = asian_seed_spread(1);
+
+    TEST_ASSERT_TRUE(lhs < plain);
+}
+
+/*-------------------------------------------------------
+ * Observation Schedules
+ *-------------------------------------------------------*/
+static void test_asian_schedule_matches_uniform(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+
+    double times[12];
+    for (size_t i = 0; i < 12; ++i) {
+        times[i] = (double)(i + 1) / 12.0;
+    }
+
+    mco_set_seed(ctx, 42);
+    double uniform = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+
+    mco_set_seed(ctx, 42);
+    double scheduled = mco_asian_schedule_call(ctx, 100.0, 100.0, 0.05, 0.20, times, 12);
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, uniform, scheduled);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_asian_schedule_invalid(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    const double times[3] = {0.25, 0.75, 0.5};
+    double price = mco_asian_schedule_call(ctx, 100.0, 100.0, 0.05, 0.20, times, 3);
+
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, price);
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_ctx_last_error(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Analytic Approximations
+ *-------------------------------------------------------*/
+static void test_asian_approx_accuracy(void)
+{
+    /* One fixing: the average is S(T), every method is Black-Scholes */
+    double bs = mco_black_scholes_call(100.0, 95.0, 0.05, 0.30, 0.5);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, bs, mco_asian_approx_call(MCO_ASIAN_TURNBULL_WAKEMAN,
+                                                               100.0, 95.0, 0.05, 0.30, 0.5, 1));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, bs, mco_asian_approx_call(MCO_ASIAN_CURRAN,
+                                                               100.0, 95.0, 0.05, 0.30, 0.5, 1));
+
+    /* Monthly fixings, 2M-path control-variate references */
+    double curran = mco_asian_approx_call(MCO_ASIAN_CURRAN, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    double tw = mco_asian_approx_call(MCO_ASIAN_TURNBULL_WAKEMAN, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    TEST_ASSERT_DOUBLE_WITHIN(2e-3, 6.1560, curran);
+    TEST_ASSERT_DOUBLE_WITHIN(0.03, 6.1560, tw);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, 13.1221,
+                              mco_asian_approx_call(MCO_ASIAN_CURRAN, 100.0, 100.0, 0.05, 0.50,
+                                                    1.0, 12));
+
+    /* Parity on the exact mean of the average */
+    double put = mco_asian_approx_put(MCO_ASIAN_CURRAN, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    double g = exp(0.05 / 12.0);
+    double mean = 100.0 * g * (pow(g, 12.0) - 1.0) / (g - 1.0) / 12.0;
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, curran - exp(-0.05) * (mean - 100.0), put);
+
+    /* Levy is the continuous limit: no dependence on the fixings */
+    double levy = mco_asian_approx_call(MCO_ASIAN_LEVY, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    TEST_ASSERT_EQUAL_DOUBLE(levy, mco_asian_approx_call(MCO_ASIAN_LEVY, 100.0, 100.0,
+                                                         0.05, 0.20, 1.0, 252));
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, levy,
+                              mco_asian_approx_call(MCO_ASIAN_TURNBULL_WAKEMAN, 100.0, 100.0,
+                                                    0.05, 0.20, 1.0, 5000));
+
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_asian_approx_call(MCO_ASIAN_CURRAN, 100.0, 100.0,
+                                                        0.05, 0.20, 1.0, 0));
+}
+
+static void test_asian_approx_batch(void)
+{
+    double spot[4] = { 100.0, 100.0, 100.0, 100.0 };
+    double strike[4] = { 90.0, 100.0, 110.0, -1.0 };
+    double rate[4] = { 0.05, 0.05, 0.03, 0.05 };
+    double vol[4] = { 0.25, 0.25, 0.25, 0.25 };
+    double time[4] = { 1.0, 1.0, 1.0, 1.0 };
+    double out[4] = { 0 };
+
+    mco_asian_approx_batch(MCO_ASIAN_CURRAN, spot, strike, rate, vol, time, 4, 52,
+                           MCO_PUT, out);
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_DOUBLE(mco_asian_approx_put(MCO_ASIAN_CURRAN, spot[i], strike[i],
+                                                      rate[i], vol[i], time[i], 52),
+                                 out[i]);
+    }
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, out[3]);
+    TEST_ASSERT_TRUE(out[1] > out[0]);
+}
+
 /*-------------------------------------------------------
  * Reproducibility
  *-------------------------------------------------------*/
+static void test_asian_fast_precision(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+
+    double arith = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 20);
+    double floating = mco_price_asian(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 20,
+                                      MCO_ASIAN_GEOMETRIC, MCO_ASIAN_FLOATING_STRIKE,
+                                      MCO_PUT);
+
+    mco_set_precision(ctx, MCO_PRECISION_FAST);
+    double fast_arith = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 20);
+    double arith_se = mco_get_std_error(ctx);
+    double fast_floating = mco_price_asian(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 20,
+                                           MCO_ASIAN_GEOMETRIC, MCO_ASIAN_FLOATING_STRIKE,
+                                           MCO_PUT);
+    double floating_se = mco_get_std_error(ctx);
+    double fast_geom = mco_asian_geometric_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 20);
+    double geom_se = mco_get_std_error(ctx);
+
+    /* Plain sampling in both modes: combined error √2 × the fast one */
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sqrt(2.0) * arith_se + 1e-4 * arith, arith, fast_arith);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sqrt(2.0) * floating_se + 1e-4 * floating,
+                              floating, fast_floating);
+
+    double geom_ref = mco_asian_geometric_closed(100.0, 100.0, 0.05, 0.20, 1.0, 20, MCO_CALL);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * geom_se + 1e-4 * geom_ref, geom_ref, fast_geom);
+
+    /* σ = 0: the average of S·e^(r·tᵢ) exactly, up to the float bias */
+    double avg = 0.0;
+    for (int i = 1; i <= 20; i++) avg += 100.0 * exp(0.05 * (double)i / 20.0);
+    double expected = exp(-0.05) * (avg / 20.0 - 90.0);
+    double zero_vol = mco_asian_call(ctx, 100.0, 90.0, 0.05, 0.0, 1.0, 20);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4 * expected, expected, zero_vol);
+
+    mco_ctx_free(ctx);
+}
+
 static void test_asian_reproducible(void)
 {
     mco_ctx *ctx1 = mco_ctx_new();
@@ -174,7 +346,13 @@ int main(void)
     RUN_TEST(test_asian_geometric_call);
     RUN_TEST(test_asian_geometric_put);
     RUN_TEST(test_asian_more_observations);
+    RUN_TEST(test_asian_lhs_reduces_spread);
+    RUN_TEST(test_asian_schedule_matches_uniform);
+    RUN_TEST(test_asian_schedule_invalid);
+    RUN_TEST(test_asian_approx_accuracy);
+    RUN_TEST(test_asian_approx_batch);
     RUN_TEST(test_asian_reproducible);
+    RUN_TEST(test_asian_fast_precision);
 
     return UnityEnd();
 }
@@ -15,7 +15,7 @@ static void test_barrier_down_out_call_no_hit(void)
     mco_set_seed(ctx, 42);
 
     /* Barrier far below spot - unlikely to hit */
-    double price = mco_barrier_call(ctx, 100.0, 100.0, 60.0, 0.05, 0.20, 1.0, 252,
+    double price = mco_barrier_call(ctx, 100.0, 100.0, 60.0, 0.0, 0.05, 0.20, 1.0, 252,
                                      MCO_BARRIER_DOWN_OUT);
 
     /* Should be close to vanilla call */
@@ -32,7 +32,7 @@ static void test_barrier_down_out_call_near_barrier(void)
     mco_set_seed(ctx, 42);
 
     /* Barrier close to spot - higher chance of knock-out */
-    double price = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 0.05, 0.20, 1.0, 252,
+    double price = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0, 252,
                                      MCO_BARRIER_DOWN_OUT);
 
     /* Should be less than vanilla due to knock-out risk */
@@ -49,7 +49,7 @@ static void test_barrier_up_out_call(void)
     mco_set_simulations(ctx, 50000);
     mco_set_seed(ctx, 42);
 
-    double price = mco_barrier_call(ctx, 100.0, 100.0, 120.0, 0.05, 0.20, 1.0, 252,
+    double price = mco_barrier_call(ctx, 100.0, 100.0, 120.0, 0.0, 0.05, 0.20, 1.0, 252,
                                      MCO_BARRIER_UP_OUT);
 
     /* Up-and-out call: knocked out if price rises too much */
@@ -66,11 +66,11 @@ static void test_barrier_knock_in_out_parity(void)
 
     /* Knock-in + Knock-out = Vanilla (approximately) */
     mco_set_seed(ctx, 42);
-    double down_out = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.05, 0.20, 1.0, 252,
+    double down_out = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 252,
                                         MCO_BARRIER_DOWN_OUT);
 
     mco_set_seed(ctx, 42);
-    double down_in = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.05, 0.20, 1.0, 252,
+    double down_in = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 252,
                                        MCO_BARRIER_DOWN_IN);
 
     double vanilla = mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0);
@@ -86,16 +86,540 @@ static void test_barrier_analytical_vs_mc(void)
     mco_set_simulations(ctx, 100000);
     mco_set_seed(ctx, 42);
 
-    double mc_price = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.05, 0.20, 1.0, 252,
+    double mc_price = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 252,
                                         MCO_BARRIER_DOWN_OUT);
 
-    double anal_price = mco_barrier_down_out_call(100.0, 100.0, 80.0, 0.05, 0.20, 1.0);
+    double anal_price = mco_barrier_down_out_call(100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0);
 
     TEST_ASSERT_DOUBLE_WITHIN(1.0, anal_price, mc_price);
 
     mco_ctx_free(ctx);
 }
 
+static void test_barrier_importance_down_in_call(void)
+{
+    /* Must fall 30% and then finish above the strike */
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 400000);
+    mco_set_seed(ctx, 42);
+
+    double plain = mco_barrier_call(ctx, 100.0, 100.0, 70.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                    MCO_BARRIER_DOWN_IN);
+    double plain_se = mco_get_std_error(ctx);
+
+    mco_set_simulations(ctx, 50000);
+    mco_set_importance_sampling(ctx, 1);
+    double is = mco_barrier_call(ctx, 100.0, 100.0, 70.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                 MCO_BARRIER_DOWN_IN);
+    double is_se = mco_get_std_error(ctx);
+
+    /* Same estimate with an eighth of the paths and a smaller error */
+    double tol = 4.0 * sqrt(plain_se * plain_se + is_se * is_se);
+    TEST_ASSERT_DOUBLE_WITHIN(tol, plain, is);
+    TEST_ASSERT_TRUE(is_se < plain_se);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_importance_up_in_put(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 200000);
+    mco_set_seed(ctx, 7);
+
+    double plain = mco_barrier_put(ctx, 100.0, 100.0, 130.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                   MCO_BARRIER_UP_IN);
+    double plain_se = mco_get_std_error(ctx);
+
+    mco_set_importance_sampling(ctx, 1);
+    double is = mco_barrier_put(ctx, 100.0, 100.0, 130.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                MCO_BARRIER_UP_IN);
+    double is_se = mco_get_std_error(ctx);
+
+    double tol = 4.0 * sqrt(plain_se * plain_se + is_se * is_se);
+    TEST_ASSERT_DOUBLE_WITHIN(tol, plain, is);
+    TEST_ASSERT_TRUE(is_se < plain_se);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_knock_out_rebate(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+
+    /* Paths stop at the knock-out; the rebate must still be paid */
+    mco_set_seed(ctx, 42);
+    double with_rebate = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 5.0, 0.05, 0.20, 1.0, 252,
+                                          MCO_BARRIER_DOWN_OUT);
+    mco_set_seed(ctx, 42);
+    double without = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0, 252,
+                                      MCO_BARRIER_DOWN_OUT);
+
+    /* Continuous hit probability of the 90 barrier */
+    double vol_sqrt_t = 0.20;
+    double nu = 0.05 - 0.5 * 0.20 * 0.20;
+    double b = log(90.0 / 100.0);
+    double p_hit = 0.5 * erfc(-((b - nu) / vol_sqrt_t) * 0.7071067811865475)
+                 + pow(0.9, 2.0 * nu / (0.20 * 0.20))
+                   * 0.5 * erfc(-((b + nu) / vol_sqrt_t) * 0.7071067811865475);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 5.0 * exp(-0.05) * p_hit, with_rebate - without);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_fast_precision(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+
+    double out = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 5.0, 0.05, 0.20, 1.0, 50,
+                                  MCO_BARRIER_DOWN_OUT);
+    double out_se = mco_get_std_error(ctx);
+    double in = mco_barrier_put(ctx, 100.0, 100.0, 110.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                MCO_BARRIER_UP_IN);
+    double in_se = mco_get_std_error(ctx);
+
+    mco_set_precision(ctx, MCO_PRECISION_FAST);
+    double fast_out = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 5.0, 0.05, 0.20, 1.0, 50,
+                                       MCO_BARRIER_DOWN_OUT);
+    double fast_out_se = mco_get_std_error(ctx);
+    double fast_in = mco_barrier_put(ctx, 100.0, 100.0, 110.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                     MCO_BARRIER_UP_IN);
+    double fast_in_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * hypot(out_se, fast_out_se) + 1e-4 * out, out, fast_out);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * hypot(in_se, fast_in_se) + 1e-4 * in, in, fast_in);
+
+    /* σ = 0: S·e^(rt) stays above 90 (vanilla) and crosses 103 (rebate) */
+    double vanilla = 100.0 - 90.0 * exp(-0.05);
+    double no_hit = mco_barrier_call(ctx, 100.0, 90.0, 90.0, 3.0, 0.05, 0.0, 1.0, 50,
+                                     MCO_BARRIER_DOWN_OUT);
+    double hit = mco_barrier_call(ctx, 100.0, 90.0, 103.0, 2.0, 0.05, 0.0, 1.0, 50,
+                                  MCO_BARRIER_UP_OUT);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4 * vanilla, vanilla, no_hit);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4 * 2.0, 2.0 * exp(-0.05), hit);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_bridge_log_matches_spot(void)
+{
+    /* The log-space bridge probability must agree with the spot form */
+    const double s[][2] = { {100.0, 97.0}, {92.0, 91.0}, {110.0, 125.0}, {89.0, 95.0} };
+    double vol = 0.25;
+    double dt = 1.0 / 52.0;
+    double inv_var = 1.0 / (vol * vol * dt);
+
+    for (size_t i = 0; i < sizeof(s) / sizeof(s[0]); ++i) {
+        double down = mco_barrier_bridge_hit_prob(s[i][0], s[i][1], 90.0, vol, dt, 0);
+        double down_log = mco_barrier_bridge_hit_prob_log(log(s[i][0]), log(s[i][1]),
+                                                          log(90.0), inv_var, 0);
+        double up = mco_barrier_bridge_hit_prob(s[i][0], s[i][1], 120.0, vol, dt, 1);
+        double up_log = mco_barrier_bridge_hit_prob_log(log(s[i][0]), log(s[i][1]),
+                                                        log(120.0), inv_var, 1);
+
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, down, down_log);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-12, up, up_log);
+    }
+}
+
+static void test_barrier_conditional_survival(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+
+    /* Coarse grid: the bridge does the monitoring between dates */
+    double sampled = mco_barrier_call(ctx, 100.0, 100.0, 95.0, 0.0, 0.05, 0.20, 1.0, 4,
+                                      MCO_BARRIER_DOWN_IN);
+    double sampled_se = mco_get_std_error(ctx);
+
+    mco_set_conditional_mc(ctx, 1);
+    double weighted = mco_barrier_call(ctx, 100.0, 100.0, 95.0, 0.0, 0.05, 0.20, 1.0, 4,
+                                       MCO_BARRIER_DOWN_IN);
+    double weighted_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sampled_se, sampled, weighted);
+    TEST_ASSERT_TRUE(weighted_se < 0.9 * sampled_se);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_conditional_grid_independent(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+    mco_set_conditional_mc(ctx, 1);
+
+    /* Bridge survival is exact for GBM, so a coarse grid is unbiased */
+    double coarse = mco_barrier_call(ctx, 100.0, 100.0, 120.0, 2.0, 0.05, 0.20, 1.0, 4,
+                                     MCO_BARRIER_UP_OUT);
+    double fine = mco_barrier_call(ctx, 100.0, 100.0, 120.0, 2.0, 0.05, 0.20, 1.0, 128,
+                                   MCO_BARRIER_UP_OUT);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, fine, coarse);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_discrete_parity(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+
+    /* Month-end monitoring: in + out = vanilla on the same dates */
+    double times[12];
+    for (size_t i = 0; i < 12; ++i) {
+        times[i] = (double)(i + 1) / 12.0;
+    }
+
+    mco_set_seed(ctx, 42);
+    double down_out = mco_barrier_discrete_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20,
+                                                times, 12, MCO_BARRIER_DOWN_OUT);
+    mco_set_seed(ctx, 42);
+    double down_in = mco_barrier_discrete_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20,
+                                               times, 12, MCO_BARRIER_DOWN_IN);
+
+    double vanilla = mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0);
+
+    TEST_ASSERT_TRUE(down_out > 0.0);
+    TEST_ASSERT_TRUE(down_in > 0.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.5, vanilla, down_out + down_in);
+
+    /* Sparser monitoring knocks out less often than the bridged continuous barrier */
+    mco_set_seed(ctx, 42);
+    double continuous = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0, 12,
+                                         MCO_BARRIER_DOWN_OUT);
+    TEST_ASSERT_TRUE(down_out > continuous);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_analytic_all_styles(void)
+{
+    /* Reiner-Rubinstein references, strike on both sides of the barrier */
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 8.66547, mco_barrier_down_out_call(100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 1.78511, mco_barrier_down_in_call(100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 3.33286, mco_barrier_up_out_call(100.0, 100.0, 130.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 7.11773, mco_barrier_up_in_call(100.0, 100.0, 130.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 0.24375, mco_barrier_down_out_put(100.0, 110.0, 95.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 10.43157, mco_barrier_down_in_put(100.0, 110.0, 95.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 1.28811, mco_barrier_up_out_put(100.0, 90.0, 105.0, 0.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, 1.02199, mco_barrier_up_in_put(100.0, 90.0, 105.0, 0.0, 0.05, 0.20, 1.0));
+
+    /* In + out = vanilla for every style, strike and type */
+    double strikes[2] = { 90.0, 110.0 };
+    double barriers[2] = { 95.0, 105.0 };
+    mco_barrier_style ins[2] = { MCO_BARRIER_DOWN_IN, MCO_BARRIER_UP_IN };
+    mco_barrier_style outs[2] = { MCO_BARRIER_DOWN_OUT, MCO_BARRIER_UP_OUT };
+    for (size_t k = 0; k < 2; ++k) {
+        double call = mco_black_scholes_call(100.0, strikes[k], 0.05, 0.20, 1.0);
+        double put = mco_black_scholes_put(100.0, strikes[k], 0.05, 0.20, 1.0);
+        for (size_t d = 0; d < 2; ++d) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-10, call,
+                mco_barrier_analytic_call(100.0, strikes[k], barriers[d], 0.0, 0.05, 0.20, 1.0, 0, ins[d])
+                + mco_barrier_analytic_call(100.0, strikes[k], barriers[d], 0.0, 0.05, 0.20, 1.0, 0, outs[d]));
+            TEST_ASSERT_DOUBLE_WITHIN(1e-10, put,
+                mco_barrier_analytic_put(100.0, strikes[k], barriers[d], 0.0, 0.05, 0.20, 1.0, 0, ins[d])
+                + mco_barrier_analytic_put(100.0, strikes[k], barriers[d], 0.0, 0.05, 0.20, 1.0, 0, outs[d]));
+        }
+    }
+
+    /* Knock-out rebate at maturity against the bridged Monte Carlo */
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 200000);
+    mco_set_seed(ctx, 42);
+    double mc = mco_barrier_put(ctx, 100.0, 100.0, 110.0, 5.0, 0.05, 0.25, 1.0, 100,
+                                MCO_BARRIER_UP_OUT);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, mco_barrier_up_out_put(100.0, 100.0, 110.0, 5.0, 0.05, 0.25, 1.0), mc);
+
+    /* Already knocked: rebate or the vanilla */
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 3.0 * exp(-0.05),
+                              mco_barrier_down_out_put(85.0, 100.0, 90.0, 3.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_black_scholes_put(85.0, 100.0, 0.05, 0.20, 1.0),
+                              mco_barrier_down_in_put(85.0, 100.0, 90.0, 3.0, 0.05, 0.20, 1.0));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_bgk_discrete(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 200000);
+    mco_set_seed(ctx, 42);
+
+    double times[50];
+    for (size_t i = 0; i < 50; ++i) {
+        times[i] = (double)(i + 1) / 50.0;
+    }
+
+    /* The shift closes the gap between continuous and weekly monitoring */
+    double mc = mco_barrier_discrete_call(ctx, 100.0, 100.0, 95.0, 0.0, 0.05, 0.20,
+                                          times, 50, MCO_BARRIER_DOWN_OUT);
+    double bgk = mco_barrier_analytic_call(100.0, 100.0, 95.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                           MCO_BARRIER_DOWN_OUT);
+    double continuous = mco_barrier_down_out_call(100.0, 100.0, 95.0, 0.0, 0.05, 0.20, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, mc, bgk);
+    TEST_ASSERT_TRUE(mc - continuous > 1.0);
+
+    mc = mco_barrier_discrete_put(ctx, 100.0, 100.0, 110.0, 0.0, 0.05, 0.20,
+                                  times, 50, MCO_BARRIER_UP_IN);
+    bgk = mco_barrier_analytic_put(100.0, 100.0, 110.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                   MCO_BARRIER_UP_IN);
+    TEST_ASSERT_DOUBLE_WITHIN(0.03, mc, bgk);
+
+    /* Batch matches the scalar entry point, rebates optional */
+    double spot[3] = { 100.0, 100.0, 120.0 };
+    double strike[3] = { 90.0, 100.0, 110.0 };
+    double barrier[3] = { 120.0, 115.0, 125.0 };
+    double rebate[3] = { 0.0, 2.0, 1.0 };
+    double rate[3] = { 0.05, 0.05, 0.03 };
+    double vol[3] = { 0.20, 0.30, 0.25 };
+    double time[3] = { 1.0, 0.5, 2.0 };
+    double out[3] = { 0.0, 0.0, 0.0 };
+    double bare[3] = { 0.0, 0.0, 0.0 };
+    mco_barrier_analytic_batch(spot, strike, barrier, rebate, rate, vol, time, 3, 12,
+                               MCO_BARRIER_UP_OUT, MCO_PUT, out);
+    mco_barrier_analytic_batch(spot, strike, barrier, NULL, rate, vol, time, 3, 12,
+                               MCO_BARRIER_UP_OUT, MCO_PUT, bare);
+    for (size_t i = 0; i < 3; ++i) {
+        TEST_ASSERT_EQUAL_DOUBLE(mco_barrier_analytic_put(spot[i], strike[i], barrier[i], rebate[i],
+                                                          rate[i], vol[i], time[i], 12,
+                                                          MCO_BARRIER_UP_OUT), out[i]);
+        TEST_ASSERT_EQUAL_DOUBLE(mco_barrier_analytic_put(spot[i], strike[i], barrier[i], 0.0,
+                                                          rate[i], vol[i], time[i], 12,
+                                                          MCO_BARRIER_UP_OUT), bare[i]);
+    }
+
+    mco_ctx_free(ctx);
+}
+
+/*
+ * BGK coverage: test_barrier_bgk_discrete checks a regular knock-out
+ * (down-and-out call) and a knock-in (up-and-in put). Here the reverse
+ * knock-outs (up-and-out call, down-and-out put), whose payoff is in the
+ * money at the barrier: fine with the barrier far from the strike, an
+ * upward bias with it near (mcoptions.h).
+ */
+static void test_barrier_bgk_reverse_knock_out(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 200000);
+    mco_set_seed(ctx, 42);
+
+    double times[50];
+    for (size_t i = 0; i < 50; ++i) {
+        times[i] = (double)(i + 1) / 50.0;
+    }
+
+    /* Barrier 30% from the strike: within 2% */
+    double mc = mco_barrier_discrete_call(ctx, 100.0, 100.0, 130.0, 0.0, 0.05, 0.20,
+                                          times, 50, MCO_BARRIER_UP_OUT);
+    double bgk = mco_barrier_analytic_call(100.0, 100.0, 130.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                           MCO_BARRIER_UP_OUT);
+    TEST_ASSERT_DOUBLE_WITHIN(0.02 * mc, mc, bgk);
+
+    mc = mco_barrier_discrete_put(ctx, 100.0, 100.0, 70.0, 0.0, 0.05, 0.20,
+                                  times, 50, MCO_BARRIER_DOWN_OUT);
+    bgk = mco_barrier_analytic_put(100.0, 100.0, 70.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                   MCO_BARRIER_DOWN_OUT);
+    TEST_ASSERT_DOUBLE_WITHIN(0.02 * mc, mc, bgk);
+
+    /* Barrier 10% from the strike: the shift overprices, well past the noise */
+    mc = mco_barrier_discrete_call(ctx, 100.0, 100.0, 110.0, 0.0, 0.05, 0.20,
+                                   times, 50, MCO_BARRIER_UP_OUT);
+    double se = mco_get_std_error(ctx);
+    bgk = mco_barrier_analytic_call(100.0, 100.0, 110.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                    MCO_BARRIER_UP_OUT);
+    TEST_ASSERT_TRUE(bgk - mc > 3.0 * se);
+    TEST_ASSERT_TRUE(bgk - mc < 0.1 * mc);
+
+    mc = mco_barrier_discrete_put(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20,
+                                  times, 50, MCO_BARRIER_DOWN_OUT);
+    se = mco_get_std_error(ctx);
+    bgk = mco_barrier_analytic_put(100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                   MCO_BARRIER_DOWN_OUT);
+    TEST_ASSERT_TRUE(bgk - mc > 3.0 * se);
+    TEST_ASSERT_TRUE(bgk - mc < 0.1 * mc);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_discrete_bgk_control(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+
+    double times[12];
+    for (size_t i = 0; i < 12; ++i) {
+        times[i] = (double)(i + 1) / 12.0;
+    }
+
+    mco_set_seed(ctx, 42);
+    double plain = mco_barrier_discrete_call(ctx, 100.0, 100.0, 95.0, 3.0, 0.05, 0.20,
+                                             times, 12, MCO_BARRIER_DOWN_OUT);
+    double plain_se = mco_get_std_error(ctx);
+
+    mco_set_control_variates(ctx, MCO_CONTROL_BARRIER);
+    mco_set_seed(ctx, 42);
+    double cv = mco_barrier_discrete_call(ctx, 100.0, 100.0, 95.0, 3.0, 0.05, 0.20,
+                                          times, 12, MCO_BARRIER_DOWN_OUT);
+    double cv_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_TRUE(cv_se > 0.0);
+    TEST_ASSERT_TRUE(cv_se < 0.3 * plain_se);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * plain_se, plain, cv);
+
+    /* Knock-in put, with the other controls alongside */
+    mco_set_control_variates(ctx, MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA | MCO_CONTROL_BARRIER);
+    mco_set_seed(ctx, 42);
+    cv = mco_barrier_discrete_put(ctx, 100.0, 100.0, 110.0, 0.0, 0.05, 0.20,
+                                  times, 12, MCO_BARRIER_UP_IN);
+    cv_se = mco_get_std_error(ctx);
+
+    mco_set_control_variates(ctx, MCO_CONTROL_NONE);
+    mco_set_seed(ctx, 42);
+    plain = mco_barrier_discrete_put(ctx, 100.0, 100.0, 110.0, 0.0, 0.05, 0.20,
+                                     times, 12, MCO_BARRIER_UP_IN);
+    plain_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_TRUE(cv_se < 0.5 * plain_se);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * plain_se, plain, cv);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_analytic_values(void)
+{
+    /* Spot ladder across the barrier, a vol bump and a no-diffusion contract */
+    double spot[6] = { 85.0, 95.0, 100.0, 105.0, 100.0, 100.0 };
+    double strike[6] = { 100.0, 100.0, 90.0, 110.0, 100.0, 100.0 };
+    double barrier[6] = { 100.0, 100.0, 100.0, 100.0, 90.0, 0.0 };
+    double rebate[6] = { 1.0, 1.0, 2.0, 0.0, 3.0, 0.0 };
+    double rate[6] = { 0.05, 0.05, 0.05, 0.05, 0.05, 0.05 };
+    double vol[6] = { 0.20, 0.20, 0.20, 0.20, 0.0, 0.20 };
+    double time[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+    mco_barrier_values out[6];
+    mco_barrier_style styles[4] = { MCO_BARRIER_DOWN_IN, MCO_BARRIER_DOWN_OUT,
+                                    MCO_BARRIER_UP_IN, MCO_BARRIER_UP_OUT };
+
+    for (size_t dates = 0; dates <= 12; dates += 12) {
+        mco_barrier_analytic_values(spot, strike, barrier, rebate, rate, vol, time, 6,
+                                    dates, out);
+        for (size_t i = 0; i < 5; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_barrier_analytic_call(spot[i], strike[i], barrier[i],
+                                          rebate[i], rate[i], vol[i], time[i], dates, styles[j]),
+                                          out[i].call[styles[j]]);
+                TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_barrier_analytic_put(spot[i], strike[i], barrier[i],
+                                          rebate[i], rate[i], vol[i], time[i], dates, styles[j]),
+                                          out[i].put[styles[j]]);
+            }
+            TEST_ASSERT_TRUE(out[i].parity < 1e-10);
+        }
+
+        /* Invalid barrier: all zeros */
+        for (size_t j = 0; j < 4; ++j) {
+            TEST_ASSERT_EQUAL_DOUBLE(0.0, out[5].call[j]);
+            TEST_ASSERT_EQUAL_DOUBLE(0.0, out[5].put[j]);
+        }
+    }
+}
+
+static void test_barrier_pde(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    double spot[2] = { 100.0, 100.0 };
+    double strike[2] = { 100.0, 100.0 };
+    double barrier[2] = { 90.0, 130.0 };
+    double rate[2] = { 0.05, 0.05 };
+    double vol[2] = { 0.20, 0.20 };
+    double time[2] = { 1.0, 1.0 };
+    mco_pde_result ko[2] = { 0 };
+    mco_pde_result ki[2] = { 0 };
+
+    /* Continuous-monitoring references (Reiner-Rubinstein, no rebate) */
+    mco_barrier_pde_batch(ctx, spot, strike, barrier, NULL, rate, vol, time, 1,
+                          MCO_BARRIER_DOWN_OUT, MCO_CALL, ko);
+    mco_barrier_pde_batch(ctx, spot, strike, barrier, NULL, rate, vol, time, 1,
+                          MCO_BARRIER_DOWN_IN, MCO_CALL, ki);
+    TEST_ASSERT_DOUBLE_WITHIN(2e-3, 8.66547, ko[0].price);
+    TEST_ASSERT_DOUBLE_WITHIN(2e-3, 1.78511, ki[0].price);
+
+    mco_barrier_pde_batch(ctx, spot + 1, strike + 1, barrier + 1, NULL, rate, vol, time, 1,
+                          MCO_BARRIER_UP_OUT, MCO_CALL, ko + 1);
+    mco_barrier_pde_batch(ctx, spot + 1, strike + 1, barrier + 1, NULL, rate, vol, time, 1,
+                          MCO_BARRIER_UP_IN, MCO_CALL, ki + 1);
+    TEST_ASSERT_DOUBLE_WITHIN(2e-3, 3.33286, ko[1].price);
+    TEST_ASSERT_DOUBLE_WITHIN(2e-3, 7.11773, ki[1].price);
+
+    /* In + out = vanilla, delta included */
+    double bs = mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0);
+    double d1 = (0.05 + 0.5 * 0.20 * 0.20) / 0.20;
+    double delta = 0.5 * erfc(-d1 / sqrt(2.0));
+    for (size_t i = 0; i < 2; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, bs, ko[i].price + ki[i].price);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, delta, ko[i].delta + ki[i].delta);
+    }
+
+    /* Already through the barrier: rebate or the vanilla */
+    double rebate[1] = { 3.0 };
+    double knocked[1] = { 85.0 };
+    mco_barrier_pde_batch(ctx, knocked, strike, barrier, rebate, rate, vol, time, 1,
+                          MCO_BARRIER_DOWN_OUT, MCO_CALL, ko);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 3.0 * exp(-0.05), ko[0].price);
+    mco_barrier_pde_batch(ctx, knocked, strike, barrier, rebate, rate, vol, time, 1,
+                          MCO_BARRIER_DOWN_IN, MCO_CALL, ki);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_black_scholes_call(85.0, 100.0, 0.05, 0.20, 1.0),
+                              ki[0].price);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_lhs_std_error(void)
+{
+    /* The reported LHS error must match the spread of prices across seeds */
+    enum { SEEDS = 16 };
+    double price[SEEDS];
+    double se = 0.0;
+    double mean = 0.0;
+
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 8192);
+    mco_set_stratified(ctx, 1);
+
+    for (int i = 0; i < SEEDS; i++) {
+        mco_set_seed(ctx, 1000u + (uint64_t)i);
+        price[i] = mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 50,
+                                    MCO_BARRIER_DOWN_OUT);
+        se += mco_get_std_error(ctx) / SEEDS;
+        mean += price[i] / SEEDS;
+    }
+
+    double var = 0.0;
+    for (int i = 0; i < SEEDS; i++) {
+        var += (price[i] - mean) * (price[i] - mean) / (SEEDS - 1);
+    }
+    double spread = sqrt(var);
+
+    TEST_ASSERT_TRUE(se > 0.0);
+    TEST_ASSERT_TRUE(spread < 2.0 * se);
+    TEST_ASSERT_TRUE(spread > 0.5 * se);
+
+    /* LHS only ever removes variance: below the i.i.d. error */
+    mco_set_stratified(ctx, 0);
+    mco_set_seed(ctx, 1000);
+    mco_barrier_call(ctx, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 50,
+                     MCO_BARRIER_DOWN_OUT);
+    TEST_ASSERT_TRUE(se < mco_get_std_error(ctx));
+
+    mco_ctx_free(ctx);
+}
+
 static void test_barrier_reproducible(void)
 {
     mco_ctx *ctx1 = mco_ctx_new();
@@ -106,9 +630,9 @@ static void test_barrier_reproducible(void)
     mco_set_seed(ctx1, 12345);
     mco_set_seed(ctx2, 12345);
 
-    double p1 = mco_barrier_call(ctx1, 100.0, 100.0, 80.0, 0.05, 0.20, 1.0, 100,
+    double p1 = mco_barrier_call(ctx1, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 100,
                                   MCO_BARRIER_DOWN_OUT);
-    double p2 = mco_barrier_call(ctx2, 100.0, 100.0, 80.0, 0.05, 0.20, 1.0, 100,
+    double p2 = mco_barrier_call(ctx2, 100.0, 100.0, 80.0, 0.0, 0.05, 0.20, 1.0, 100,
                                   MCO_BARRIER_DOWN_OUT);
 
     TEST_ASSERT_EQUAL_DOUBLE(p1, p2);
@@ -126,7 +650,22 @@ int main(void)
     RUN_TEST(test_barrier_up_out_call);
     RUN_TEST(test_barrier_knock_in_out_parity);
     RUN_TEST(test_barrier_analytical_vs_mc);
+    RUN_TEST(test_barrier_importance_down_in_call);
+    RUN_TEST(test_barrier_importance_up_in_put);
+    RUN_TEST(test_barrier_knock_out_rebate);
+    RUN_TEST(test_barrier_bridge_log_matches_spot);
+    RUN_TEST(test_barrier_conditional_survival);
+    RUN_TEST(test_barrier_conditional_grid_independent);
+    RUN_TEST(test_barrier_fast_precision);
+    RUN_TEST(test_barrier_discrete_parity);
     RUN_TEST(test_barrier_reproducible);
+    RUN_TEST(test_barrier_lhs_std_error);
+    RUN_TEST(test_barrier_pde);
+    RUN_TEST(test_barrier_analytic_all_styles);
+    RUN_TEST(test_barrier_bgk_discrete);
+    RUN_TEST(test_barrier_bgk_reverse_knock_out);
+    RUN_TEST(test_barrier_discrete_bgk_control);
+    RUN_TEST(test_barrier_analytic_values);
 
     return UnityEnd();
 }
@@ -163,6 +163,63 @@ static void test_bermudan_reproducible(void)
     mco_ctx_free(ctx2);
 }
 
+/*-------------------------------------------------------
+ * Lattice Engine
+ *-------------------------------------------------------*/
+static void test_bermudan_lattice_engine(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_seed(ctx, 42);
+
+    double lsm = mco_bermudan_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 4);
+
+    /* Same exercise dates on the tree */
+    mco_set_american_engine(ctx, MCO_ENGINE_BINOMIAL);
+    double tree = mco_bermudan_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 4);
+    double american = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 0);
+    double european = mco_black_scholes_put(100.0, 100.0, 0.05, 0.20, 1.0);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, lsm, tree);
+    TEST_ASSERT_TRUE(tree > european);
+    TEST_ASSERT_TRUE(tree < american);
+
+    mco_set_american_engine(ctx, MCO_ENGINE_PDE);
+    double pde = mco_bermudan_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 4);
+    TEST_ASSERT_DOUBLE_WITHIN(5e-3, tree, pde);
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Exercise Policy Cache
+ *-------------------------------------------------------*/
+static void test_bermudan_cache_shared_with_american(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_exercise_cache *cache = mco_exercise_cache_new(4);
+    mco_set_simulations(ctx, 10000);
+    mco_set_seed(ctx, 42);
+    mco_set_exercise_cache(ctx, cache);
+
+    /* Same dates, same key: the Bermudan reuses the American policy */
+    double american = mco_american_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    double bermudan = mco_bermudan_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    TEST_ASSERT_EQUAL_UINT64(1, mco_exercise_cache_hits(cache));
+    TEST_ASSERT_DOUBLE_WITHIN(0.3, american, bermudan);
+
+    double times[4] = {0}, boundary[4] = {0};
+    size_t n = mco_bermudan_exercise_boundary(ctx, 100.0, 100.0, 0.05, 0.20,
+                                              1.0, 4, MCO_PUT, times, boundary);
+    TEST_ASSERT_EQUAL_UINT64(4, n);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.25, times[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 100.0, boundary[3]);
+    TEST_ASSERT_TRUE(boundary[1] < 100.0);
+
+    mco_ctx_free(ctx);
+    mco_exercise_cache_free(cache);
+}
+
 /*-------------------------------------------------------
  * Test Runner
  *-------------------------------------------------------*/
@@ -177,6 +234,8 @@ int main(void)
     RUN_TEST(test_bermudan_converges_to_american);
     RUN_TEST(test_bermudan_put_itm);
     RUN_TEST(test_bermudan_reproducible);
+    RUN_TEST(test_bermudan_lattice_engine);
+    RUN_TEST(test_bermudan_cache_shared_with_american);
 
     return UnityEnd();
 }
@@ -10,6 +10,10 @@
  */
 #include "unity/unity.h"
 #include "mcoptions.h"
+#include "internal/cpu.h"
+#include "internal/methods/kernels.h"
+#include "internal/methods/sobol.h"
+#include <string.h>
 
 /*-------------------------------------------------------
  * Lifecycle Tests
@@ -59,6 +63,28 @@ static void test_context_default_antithetic(void)
     mco_ctx_free(ctx);
 }
 
+static void test_context_default_stratified(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_EQUAL_INT(0, mco_get_stratified(ctx));
+    mco_ctx_free(ctx);
+}
+
+static void test_context_default_importance_sampling(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_EQUAL_INT(0, mco_get_importance_sampling(ctx));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_get_std_error(ctx));
+    mco_ctx_free(ctx);
+}
+
+static void test_context_default_conditional_mc(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_EQUAL_INT(0, mco_get_conditional_mc(ctx));
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Setter/Getter Tests
  *-------------------------------------------------------*/
@@ -139,9 +165,324 @@ static void test_context_set_antithetic(void)
     mco_ctx_free(ctx);
 }
 
+static void test_context_set_stratified(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    mco_set_stratified(ctx, 1);
+    TEST_ASSERT_EQUAL_INT(1, mco_get_stratified(ctx));
+
+    mco_set_stratified(ctx, 0);
+    TEST_ASSERT_EQUAL_INT(0, mco_get_stratified(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_importance_sampling(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    mco_set_importance_sampling(ctx, 1);
+    TEST_ASSERT_EQUAL_INT(1, mco_get_importance_sampling(ctx));
+
+    mco_set_importance_sampling(ctx, 0);
+    TEST_ASSERT_EQUAL_INT(0, mco_get_importance_sampling(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_conditional_mc(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    mco_set_conditional_mc(ctx, 1);
+    TEST_ASSERT_EQUAL_INT(1, mco_get_conditional_mc(ctx));
+
+    mco_set_conditional_mc(ctx, 0);
+    TEST_ASSERT_EQUAL_INT(0, mco_get_conditional_mc(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_bridge_extremum(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    TEST_ASSERT_EQUAL_INT(0, mco_get_bridge_extremum(ctx));
+
+    mco_set_bridge_extremum(ctx, 1);
+    TEST_ASSERT_EQUAL_INT(1, mco_get_bridge_extremum(ctx));
+
+    mco_set_bridge_extremum(ctx, 0);
+    TEST_ASSERT_EQUAL_INT(0, mco_get_bridge_extremum(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_lsm_basis(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    TEST_ASSERT_EQUAL_INT(MCO_LSM_LAGUERRE, mco_get_lsm_basis(ctx));
+    TEST_ASSERT_EQUAL_UINT(2, mco_get_lsm_degree(ctx));
+    TEST_ASSERT_EQUAL_INT(0, mco_get_lsm_payoff_regressor(ctx));
+
+    mco_set_lsm_basis(ctx, MCO_LSM_HERMITE, 6);
+    TEST_ASSERT_EQUAL_INT(MCO_LSM_HERMITE, mco_get_lsm_basis(ctx));
+    TEST_ASSERT_EQUAL_UINT(6, mco_get_lsm_degree(ctx));
+
+    /* Out-of-range degree is ignored */
+    mco_set_lsm_basis(ctx, MCO_LSM_POLYNOMIAL, MCO_LSM_MAX_DEGREE + 1);
+    mco_set_lsm_basis(ctx, MCO_LSM_POLYNOMIAL, 0);
+    TEST_ASSERT_EQUAL_INT(MCO_LSM_HERMITE, mco_get_lsm_basis(ctx));
+    TEST_ASSERT_EQUAL_UINT(6, mco_get_lsm_degree(ctx));
+
+    mco_set_lsm_payoff_regressor(ctx, 1);
+    TEST_ASSERT_EQUAL_INT(1, mco_get_lsm_payoff_regressor(ctx));
+
+    /* Negative ridge is ignored */
+    mco_set_lsm_ridge(ctx, 1e-6);
+    mco_set_lsm_ridge(ctx, -1.0);
+    TEST_ASSERT_EQUAL_DOUBLE(1e-6, mco_get_lsm_ridge(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_american_engine(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    TEST_ASSERT_EQUAL_INT(MCO_ENGINE_LSM, mco_get_american_engine(ctx));
+    TEST_ASSERT_EQUAL_UINT(500, mco_get_lattice_steps(ctx));
+    TEST_ASSERT_EQUAL_INT(0, mco_get_lattice_richardson(ctx));
+
+    mco_set_american_engine(ctx, MCO_ENGINE_TRINOMIAL);
+    TEST_ASSERT_EQUAL_INT(MCO_ENGINE_TRINOMIAL, mco_get_american_engine(ctx));
+
+    /* Unknown engines and out-of-range depths are ignored */
+    mco_set_american_engine(ctx, (mco_american_engine)7);
+    TEST_ASSERT_EQUAL_INT(MCO_ENGINE_TRINOMIAL, mco_get_american_engine(ctx));
+
+    mco_set_lattice_steps(ctx, 1001);
+    mco_set_lattice_steps(ctx, 0);
+    mco_set_lattice_steps(ctx, MCO_LATTICE_MAX_STEPS + 1);
+    TEST_ASSERT_EQUAL_UINT(1001, mco_get_lattice_steps(ctx));
+
+    mco_set_lattice_richardson(ctx, 5);
+    TEST_ASSERT_EQUAL_INT(1, mco_get_lattice_richardson(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_pde_grid(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    TEST_ASSERT_EQUAL_UINT(400, mco_get_pde_space_nodes(ctx));
+    TEST_ASSERT_EQUAL_UINT(200, mco_get_pde_time_steps(ctx));
+
+    mco_set_pde_grid(ctx, 800, 100);
+    TEST_ASSERT_EQUAL_UINT(800, mco_get_pde_space_nodes(ctx));
+    TEST_ASSERT_EQUAL_UINT(100, mco_get_pde_time_steps(ctx));
+
+    /* Out-of-range grids are ignored as a whole */
+    mco_set_pde_grid(ctx, MCO_PDE_MIN_NODES - 1, 50);
+    mco_set_pde_grid(ctx, 1000, 0);
+    mco_set_pde_grid(ctx, 1000, MCO_PDE_MAX_STEPS + 1);
+    TEST_ASSERT_EQUAL_UINT(800, mco_get_pde_space_nodes(ctx));
+    TEST_ASSERT_EQUAL_UINT(100, mco_get_pde_time_steps(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_set_control_variates(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+
+    TEST_ASSERT_EQUAL_UINT(MCO_CONTROL_NONE, mco_get_control_variates(ctx));
+
+    mco_set_control_variates(ctx, MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA);
+    TEST_ASSERT_EQUAL_UINT(MCO_CONTROL_SPOT | MCO_CONTROL_VANILLA,
+                             mco_get_control_variates(ctx));
+
+    mco_set_control_variates(ctx, MCO_CONTROL_NONE);
+    TEST_ASSERT_EQUAL_UINT(MCO_CONTROL_NONE, mco_get_control_variates(ctx));
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Null Safety Tests
  *-------------------------------------------------------*/
+static void test_context_cpu_level(void)
+{
+    static const double strikes[5] = { 90.0, 95.0, 100.0, 105.0, 110.0 };
+    static const double spot[17] = {
+        80.0, 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0, 120.0,
+        82.0, 88.0, 94.0, 99.0, 104.0, 108.0, 113.0, 118.0
+    };
+    double strike[17], rate[17], vol[17], time[17];
+    for (int i = 0; i < 17; ++i) {
+        strike[i] = 100.0;
+        rate[i] = 0.05;
+        vol[i] = 0.2 + 0.01 * (double)i;
+        time[i] = 1.0;
+    }
+
+    mco_ctx *ctx = mco_ctx_new();
+    mco_cpu_level host = mco_get_cpu_level(ctx);
+    mco_set_lattice_steps(ctx, 201);
+    mco_set_pde_grid(ctx, 200, 50);
+
+    TEST_ASSERT_EQUAL_STRING("generic", mco_cpu_level_string(MCO_CPU_GENERIC));
+    TEST_ASSERT_EQUAL_STRING("avx512", mco_cpu_level_string(MCO_CPU_AVX512));
+
+    /* Reference at the baseline level */
+    double binomial_ref[5], trinomial_ref[5];
+    mco_pde_result pde_ref[17];
+    mco_set_cpu_level(ctx, MCO_CPU_GENERIC);
+    TEST_ASSERT_EQUAL_INT(MCO_CPU_GENERIC, mco_get_cpu_level(ctx));
+    mco_set_american_engine(ctx, MCO_ENGINE_BINOMIAL);
+    mco_american_strip(ctx, 100.0, strikes, 5, 0.05, 0.25, 1.0, 0, MCO_PUT, binomial_ref);
+    mco_set_american_engine(ctx, MCO_ENGINE_TRINOMIAL);
+    mco_american_strip(ctx, 100.0, strikes, 5, 0.05, 0.25, 1.0, 0, MCO_PUT, trinomial_ref);
+    mco_american_pde_batch(ctx, spot, strike, rate, vol, time, 17, MCO_PUT, pde_ref);
+
+    /* Every level the host runs gives the same bits; higher ones clamp */
+    for (int level = MCO_CPU_SSE42; level <= MCO_CPU_AVX512; ++level) {
+        mco_set_cpu_level(ctx, (mco_cpu_level)level);
+        TEST_ASSERT_EQUAL_INT(level < (int)host ? level : (int)host, mco_get_cpu_level(ctx));
+
+        double binomial[5], trinomial[5];
+        mco_pde_result pde[17];
+        mco_set_american_engine(ctx, MCO_ENGINE_BINOMIAL);
+        mco_american_strip(ctx, 100.0, strikes, 5, 0.05, 0.25, 1.0, 0, MCO_PUT, binomial);
+        mco_set_american_engine(ctx, MCO_ENGINE_TRINOMIAL);
+        mco_american_strip(ctx, 100.0, strikes, 5, 0.05, 0.25, 1.0, 0, MCO_PUT, trinomial);
+        mco_american_pde_batch(ctx, spot, strike, rate, vol, time, 17, MCO_PUT, pde);
+
+        TEST_ASSERT_EQUAL_MEMORY(binomial_ref, binomial, sizeof binomial);
+        TEST_ASSERT_EQUAL_MEMORY(trinomial_ref, trinomial, sizeof trinomial);
+        TEST_ASSERT_EQUAL_MEMORY(pde_ref, pde, sizeof pde);
+    }
+
+    /* Out-of-range levels are ignored */
+    mco_set_cpu_level(ctx, MCO_CPU_GENERIC);
+    mco_set_cpu_level(ctx, (mco_cpu_level)7);
+    TEST_ASSERT_EQUAL_INT(MCO_CPU_GENERIC, mco_get_cpu_level(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_cpu_level_sampling(void)
+{
+    /* Uniforms through both Moro branches and the clamps */
+    double u[300], z_ref[300], z[300];
+    for (int i = 0; i < 300; ++i) {
+        u[i] = (i + 0.5) / 300.0;
+        z_ref[i] = mco_sobol_inv_normal(u[i]);
+    }
+    u[0] = 1e-16;
+    u[299] = 1.0 - 1e-16;
+    z_ref[0] = mco_sobol_inv_normal(u[0]);
+    z_ref[299] = mco_sobol_inv_normal(u[299]);
+
+    /* Barrier batch over both directions, knocked spots and an invalid row */
+    double spot[12], strike[12], barrier[12], rebate[12], rate[12], vol[12], time[12];
+    for (int i = 0; i < 12; ++i) {
+        spot[i] = 70.0 + 5.0 * (double)i;
+        strike[i] = 100.0;
+        barrier[i] = (i % 2) ? 120.0 : 80.0;
+        rebate[i] = 1.0;
+        rate[i] = 0.05;
+        vol[i] = (i < 6) ? 0.2 : 0.3;
+        time[i] = 1.0;
+    }
+    strike[5] = -1.0;
+    mco_barrier_values values_ref[12], values[12];
+    mco_kernels_generic.barrier_values(spot, strike, barrier, rebate, rate, vol, time, 12, 50,
+                                       values_ref);
+
+    mco_sobol sobol;
+    double point_ref[16][8];
+    TEST_ASSERT_EQUAL_INT(0, mco_sobol_init(&sobol, 8));
+    for (int i = 0; i < 16; ++i) mco_sobol_next(&sobol, point_ref[i]);
+
+    /* LHS normals go through the context's kernels */
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 3000);
+    mco_set_stratified(ctx, 1);
+    mco_set_cpu_level(ctx, MCO_CPU_GENERIC);
+    mco_set_seed(ctx, 42);
+    double asian_ref = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.2, 1.0, 12);
+
+    for (int level = MCO_CPU_GENERIC; level <= (int)mco_cpu_host_level(); ++level) {
+        const mco_kernels *kernels = mco_kernels_get((mco_cpu_level)level);
+
+        memcpy(z, u, sizeof z);
+        kernels->inv_normal(z, 300);
+        TEST_ASSERT_EQUAL_MEMORY(z_ref, z, sizeof z);
+
+        kernels->barrier_values(spot, strike, barrier, rebate, rate, vol, time, 12, 50,
+                                values);
+        TEST_ASSERT_EQUAL_MEMORY(values_ref, values, sizeof values);
+
+        uint32_t x[8] = { 0 };
+        double point[8];
+        mco_sobol_reset(&sobol);
+        for (int i = 0; i < 16; ++i) {
+            int c = 0;
+            while ((sobol.count >> c) & 1u) c++;
+            kernels->sobol_next(8, &sobol.v[0][0], c, x, point);
+            sobol.count++;
+            TEST_ASSERT_EQUAL_MEMORY(point_ref[i], point, sizeof point);
+        }
+
+        mco_set_cpu_level(ctx, (mco_cpu_level)level);
+        mco_set_seed(ctx, 42);
+        double asian = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.2, 1.0, 12);
+        TEST_ASSERT_EQUAL_MEMORY(&asian_ref, &asian, sizeof asian);
+    }
+
+    mco_ctx_free(ctx);
+}
+
+static void test_context_precision(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_steps(ctx, 20);
+
+    TEST_ASSERT_EQUAL_INT(MCO_PRECISION_DOUBLE, mco_get_precision(ctx));
+    mco_set_precision(ctx, MCO_PRECISION_FAST);
+    TEST_ASSERT_EQUAL_INT(MCO_PRECISION_FAST, mco_get_precision(ctx));
+
+    /* Float lanes give the same bits at every kernel level and per seed */
+    mco_set_cpu_level(ctx, MCO_CPU_GENERIC);
+    mco_set_seed(ctx, 42);
+    double european_ref = mco_european_call(ctx, 100.0, 100.0, 0.05, 0.2, 1.0);
+    double asian_ref = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.2, 1.0, 20);
+
+    for (int level = MCO_CPU_SSE42; level <= MCO_CPU_AVX512; ++level) {
+        mco_set_cpu_level(ctx, (mco_cpu_level)level);
+        mco_set_seed(ctx, 42);
+        double european = mco_european_call(ctx, 100.0, 100.0, 0.05, 0.2, 1.0);
+        double asian = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.2, 1.0, 20);
+        TEST_ASSERT_EQUAL_MEMORY(&european_ref, &european, sizeof european);
+        TEST_ASSERT_EQUAL_MEMORY(&asian_ref, &asian, sizeof asian);
+    }
+
+    /* Out-of-range values are ignored */
+    mco_set_precision(ctx, (mco_precision)2);
+    TEST_ASSERT_EQUAL_INT(MCO_PRECISION_FAST, mco_get_precision(ctx));
+    mco_set_precision(ctx, MCO_PRECISION_DOUBLE);
+    TEST_ASSERT_EQUAL_INT(MCO_PRECISION_DOUBLE, mco_get_precision(ctx));
+    TEST_ASSERT_EQUAL_INT(MCO_PRECISION_DOUBLE, mco_get_precision(NULL));
+    mco_set_precision(NULL, MCO_PRECISION_FAST);
+
+    mco_ctx_free(ctx);
+}
+
 static void test_context_getters_null_safe(void)
 {
     TEST_ASSERT_EQUAL_UINT64(0, mco_get_simulations(NULL));
@@ -149,6 +490,15 @@ static void test_context_getters_null_safe(void)
     TEST_ASSERT_EQUAL_UINT64(0, mco_get_seed(NULL));
     TEST_ASSERT_EQUAL_UINT(0, mco_get_threads(NULL));
     TEST_ASSERT_EQUAL_INT(0, mco_get_antithetic(NULL));
+    TEST_ASSERT_EQUAL_INT(0, mco_get_stratified(NULL));
+    TEST_ASSERT_EQUAL_INT(0, mco_get_importance_sampling(NULL));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_get_std_error(NULL));
+    TEST_ASSERT_EQUAL_INT(0, mco_get_conditional_mc(NULL));
+    TEST_ASSERT_EQUAL_INT(0, mco_get_bridge_extremum(NULL));
+    TEST_ASSERT_EQUAL_UINT(0, mco_get_control_variates(NULL));
+    TEST_ASSERT_EQUAL_UINT(0, mco_get_lattice_steps(NULL));
+    TEST_ASSERT_EQUAL_UINT(0, mco_get_pde_space_nodes(NULL));
+    TEST_ASSERT_EQUAL_UINT(0, mco_get_pde_time_steps(NULL));
 }
 
 static void test_context_setters_null_safe(void)
@@ -159,6 +509,18 @@ static void test_context_setters_null_safe(void)
     mco_set_seed(NULL, 100);
     mco_set_threads(NULL, 4);
     mco_set_antithetic(NULL, 1);
+    mco_set_stratified(NULL, 1);
+    mco_set_importance_sampling(NULL, 1);
+    mco_set_conditional_mc(NULL, 1);
+    mco_set_bridge_extremum(NULL, 1);
+    mco_set_control_variates(NULL, MCO_CONTROL_SPOT);
+    mco_set_exercise_cache(NULL, NULL);
+    mco_set_american_engine(NULL, MCO_ENGINE_BINOMIAL);
+    mco_set_lattice_steps(NULL, 100);
+    mco_set_lattice_richardson(NULL, 1);
+    mco_set_pde_grid(NULL, 100, 100);
+    mco_exercise_cache_free(NULL);
+    mco_exercise_cache_clear(NULL);
     TEST_ASSERT_TRUE(1);
 }
 
@@ -218,6 +580,9 @@ int main(void)
     RUN_TEST(test_context_default_steps);
     RUN_TEST(test_context_default_threads);
     RUN_TEST(test_context_default_antithetic);
+    RUN_TEST(test_context_default_stratified);
+    RUN_TEST(test_context_default_importance_sampling);
+    RUN_TEST(test_context_default_conditional_mc);
 
     /* Setters/Getters */
     RUN_TEST(test_context_set_simulations);
@@ -226,6 +591,17 @@ int main(void)
     RUN_TEST(test_context_set_threads_zero_becomes_one);
     RUN_TEST(test_context_set_seed);
     RUN_TEST(test_context_set_antithetic);
+    RUN_TEST(test_context_set_stratified);
+    RUN_TEST(test_context_set_importance_sampling);
+    RUN_TEST(test_context_set_conditional_mc);
+    RUN_TEST(test_context_set_bridge_extremum);
+    RUN_TEST(test_context_set_lsm_basis);
+    RUN_TEST(test_context_set_american_engine);
+    RUN_TEST(test_context_set_pde_grid);
+    RUN_TEST(test_context_set_control_variates);
+    RUN_TEST(test_context_cpu_level);
+    RUN_TEST(test_context_cpu_level_sampling);
+    RUN_TEST(test_context_precision);
 
     /* Null safety */
     RUN_TEST(test_context_getters_null_safe);
@@ -6,6 +6,8 @@
  *   - CV prices match standard MC prices (within tolerance)
  *   - CV reduces variance (tighter confidence interval)
  *   - Geometric Asian CV for arithmetic Asian
+ *   - Shadow-path controls for Heston, SABR and Merton
+ *   - Multiple controls registered through the context
  */
 #include "unity/unity.h"
 #include "mcoptions.h"
@@ -199,6 +201,289 @@ static void test_asian_cv_reduces_variance(void)
     mco_ctx_free(ctx);
 }
 
+static void test_asian_cv_curran_control(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 10000);
+
+    /* The conditioned control leaves seed-to-seed noise near 1e-3 */
+    double prices[8];
+    double mean = 0.0;
+    for (int i = 0; i < 8; ++i) {
+        mco_set_seed(ctx, (uint64_t)(300 + i));
+        prices[i] = mco_asian_put_cv(ctx, 100.0, 105.0, 0.05, 0.30, 1.0, 12);
+        mean += prices[i] / 8.0;
+    }
+    for (int i = 0; i < 8; ++i) {
+        TEST_ASSERT_DOUBLE_WITHIN(0.01, mean, prices[i]);
+    }
+
+    /* And agrees with Curran's approximation */
+    double curran = mco_asian_approx_put(MCO_ASIAN_CURRAN, 100.0, 105.0, 0.05, 0.30, 1.0, 12);
+    TEST_ASSERT_DOUBLE_WITHIN(0.01, curran, mean);
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Accumulator Merge
+ *-------------------------------------------------------*/
+static void test_cv_merge_matches_sequential(void)
+{
+    mco_cv_stats all, a, b;
+    mco_cv_init(&all, 1.0);
+    mco_cv_init(&a, 1.0);
+    mco_cv_init(&b, 1.0);
+
+    for (int i = 0; i < 100; ++i) {
+        double z = 0.5 + 0.01 * i;
+        double x = 2.0 * z + 0.1 * sin((double)i);
+        mco_cv_add(&all, x, z);
+        mco_cv_add(i < 37 ? &a : &b, x, z);
+    }
+
+    mco_cv_merge(&a, &b);
+
+    TEST_ASSERT_EQUAL_UINT64(all.n, a.n);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_cv_beta(&all), mco_cv_beta(&a));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_cv_estimate(&all), mco_cv_estimate(&a));
+}
+
+/*-------------------------------------------------------
+ * Model-Based Shadow Controls
+ *-------------------------------------------------------*/
+static void test_heston_cv_matches_standard(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+    mco_set_steps(ctx, 100);
+    mco_set_seed(ctx, 42);
+
+    double std_price = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                0.04, 2.0, 0.04, 0.3, -0.7);
+
+    mco_set_simulations(ctx, 10000);
+    double cv_price = mco_heston_european_call_cv(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                  0.04, 2.0, 0.04, 0.3, -0.7);
+
+    TEST_ASSERT_DOUBLE_WITHIN(CV_TOLERANCE, std_price, cv_price);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_heston_cv_reduces_variance(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 2000);
+    mco_set_steps(ctx, 50);
+
+    double prices_std[10];
+    double prices_cv[10];
+
+    for (int i = 0; i < 10; ++i) {
+        mco_set_seed(ctx, (uint64_t)(400 + i));
+        prices_std[i] = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                 0.04, 2.0, 0.04, 0.3, -0.7);
+
+        mco_set_seed(ctx, (uint64_t)(400 + i));
+        prices_cv[i] = mco_heston_european_call_cv(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                   0.04, 2.0, 0.04, 0.3, -0.7);
+    }
+
+    double mean_std = 0, mean_cv = 0;
+    for (int i = 0; i < 10; ++i) {
+        mean_std += prices_std[i];
+        mean_cv += prices_cv[i];
+    }
+    mean_std /= 10;
+    mean_cv /= 10;
+
+    double var_std = 0, var_cv = 0;
+    for (int i = 0; i < 10; ++i) {
+        var_std += (prices_std[i] - mean_std) * (prices_std[i] - mean_std);
+        var_cv += (prices_cv[i] - mean_cv) * (prices_cv[i] - mean_cv);
+    }
+
+    /* Same W1 drives both paths, so correlation is high */
+    TEST_ASSERT_TRUE(var_cv < var_std * 0.5);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_sabr_cv_near_hagan(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_steps(ctx, 100);
+    mco_set_seed(ctx, 42);
+
+    /* Lognormal SABR with mild vol of vol: Hagan is accurate here */
+    double price = mco_sabr_european_call_cv(ctx, 100.0, 100.0, 0.05, 1.0,
+                                             0.20, 1.0, -0.3, 0.2);
+
+    double vol = mco_sabr_implied_vol(100.0, 100.0, 1.0, 0.20, 1.0, -0.3, 0.2);
+    double ref = mco_black76_call(100.0, 100.0, 0.05, vol, 1.0);
+
+    TEST_ASSERT_DOUBLE_WITHIN(CV_TOLERANCE, ref, price);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_merton_cv_threaded_near_series(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_threads(ctx, 4);
+    mco_set_seed(ctx, 42);
+
+    double call = mco_merton_european_call_cv(ctx, 100.0, 100.0, 0.05, 1.0,
+                                              0.2, 0.5, -0.1, 0.1);
+    double put = mco_merton_european_put_cv(ctx, 100.0, 100.0, 0.05, 1.0,
+                                            0.2, 0.5, -0.1, 0.1);
+
+    double ref_call = mco_merton_call(100.0, 100.0, 0.05, 1.0, 0.2, 0.5, -0.1, 0.1);
+    double ref_put = mco_merton_put(100.0, 100.0, 0.05, 1.0, 0.2, 0.5, -0.1, 0.1);
+
+    TEST_ASSERT_DOUBLE_WITHIN(CV_TOLERANCE, ref_call, call);
+    TEST_ASSERT_DOUBLE_WITHIN(CV_TOLERANCE, ref_put, put);
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Multiple Controls
+ *-------------------------------------------------------*/
+static void test_mcv_merge_matches_sequential(void)
+{
+    double ez[2] = { 1.0, 0.5 };
+    mco_mcv_stats all, a, b;
+    mco_mcv_init(&all, ez, 2);
+    mco_mcv_init(&a, ez, 2);
+    mco_mcv_init(&b, ez, 2);
+
+    for (int i = 0; i < 200; ++i) {
+        double z[2] = { 0.5 + 0.01 * i, cos(0.1 * i) };
+        double x = 2.0 * z[0] - 0.5 * z[1] + 0.05 * sin(1.7 * i);
+        mco_mcv_add(&all, x, z);
+        mco_mcv_add(i < 80 ? &a : &b, x, z);
+    }
+
+    mco_mcv_merge(&a, &b);
+
+    double beta_all[2], beta_merged[2];
+    mco_mcv_beta(&all, beta_all);
+    mco_mcv_beta(&a, beta_merged);
+
+    TEST_ASSERT_EQUAL_UINT64(all.n, a.n);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, beta_all[0], beta_merged[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, beta_all[1], beta_merged[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, mco_mcv_estimate(&all), mco_mcv_estimate(&a));
+
+    /* Regression recovers the coefficients used to build x */
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, 2.0, beta_all[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(0.05, -0.5, beta_all[1]);
+}
+
+static void test_mcv_redundant_control_dropped(void)
+{
+    double ez1[1] = { 1.0 };
+    double ez2[2] = { 1.0, 2.0 };
+    mco_cv_stats single;
+    mco_mcv_stats multi;
+    mco_cv_init(&single, ez1[0]);
+    mco_mcv_init(&multi, ez2, 2);
+
+    for (int i = 0; i < 100; ++i) {
+        double z = 0.8 + 0.004 * i;
+        double x = 3.0 * z + 0.1 * sin((double)i);
+        double zz[2] = { z, 2.0 * z };   /* Second control is collinear */
+        mco_cv_add(&single, x, z);
+        mco_mcv_add(&multi, x, zz);
+    }
+
+    double beta[2];
+    mco_mcv_beta(&multi, beta);
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-12, 0.0, beta[1]);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, mco_cv_estimate(&single), mco_mcv_estimate(&multi));
+}
+
+static void test_asian_registered_controls_reduce_variance(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 5000);
+
+    double prices_std[10];
+    double prices_cv[10];
+
+    for (int i = 0; i < 10; ++i) {
+        mco_set_control_variates(ctx, MCO_CONTROL_NONE);
+        mco_set_seed(ctx, (uint64_t)(500 + i));
+        prices_std[i] = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+
+        mco_set_control_variates(ctx, MCO_CONTROL_SPOT | MCO_CONTROL_GEOMETRIC
+                                      | MCO_CONTROL_VANILLA);
+        mco_set_seed(ctx, (uint64_t)(500 + i));
+        prices_cv[i] = mco_asian_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 12);
+    }
+
+    double mean_std = 0, mean_cv = 0;
+    for (int i = 0; i < 10; ++i) {
+        mean_std += prices_std[i];
+        mean_cv += prices_cv[i];
+    }
+    mean_std /= 10;
+    mean_cv /= 10;
+
+    double var_std = 0, var_cv = 0;
+    for (int i = 0; i < 10; ++i) {
+        var_std += (prices_std[i] - mean_std) * (prices_std[i] - mean_std);
+        var_cv += (prices_cv[i] - mean_cv) * (prices_cv[i] - mean_cv);
+    }
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.3, mean_std, mean_cv);
+    TEST_ASSERT_TRUE(var_cv < var_std * 0.1);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_barrier_registered_controls(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+    mco_set_seed(ctx, 42);
+
+    double plain = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0,
+                                    50, MCO_BARRIER_DOWN_OUT);
+
+    /* Unsupported bits are ignored by other pricers; all four apply here */
+    mco_set_control_variates(ctx, MCO_CONTROL_SPOT | MCO_CONTROL_GEOMETRIC
+                                  | MCO_CONTROL_VANILLA | MCO_CONTROL_BARRIER);
+    double cv = mco_barrier_call(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0,
+                                 50, MCO_BARRIER_DOWN_OUT);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.3, plain, cv);
+    TEST_ASSERT_EQUAL_INT(MCO_OK, mco_ctx_last_error(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+static void test_european_registered_spot_threaded(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_threads(ctx, 4);
+    mco_set_seed(ctx, 42);
+    mco_set_control_variates(ctx, MCO_CONTROL_SPOT | MCO_CONTROL_BARRIER);
+
+    double price = mco_european_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    double bs = mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.15, bs, price);
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Reproducibility
  *-------------------------------------------------------*/
@@ -238,6 +523,23 @@ int main(void)
     RUN_TEST(test_asian_cv_put_atm);
     RUN_TEST(test_asian_cv_vs_geometric_closed);
     RUN_TEST(test_asian_cv_reduces_variance);
+    RUN_TEST(test_asian_cv_curran_control);
+
+    /* Accumulator merge */
+    RUN_TEST(test_cv_merge_matches_sequential);
+
+    /* Model-based shadow controls */
+    RUN_TEST(test_heston_cv_matches_standard);
+    RUN_TEST(test_heston_cv_reduces_variance);
+    RUN_TEST(test_sabr_cv_near_hagan);
+    RUN_TEST(test_merton_cv_threaded_near_series);
+
+    /* Multiple controls */
+    RUN_TEST(test_mcv_merge_matches_sequential);
+    RUN_TEST(test_mcv_redundant_control_dropped);
+    RUN_TEST(test_asian_registered_controls_reduce_variance);
+    RUN_TEST(test_barrier_registered_controls);
+    RUN_TEST(test_european_registered_spot_threaded);
 
     /* Reproducibility */
     RUN_TEST(test_cv_reproducible);
@@ -4,6 +4,7 @@
 #include "unity/unity.h"
 #include "mcoptions.h"
 #include "internal/instruments/digital.h"
+#include "internal/variance_reduction/importance.h"
 #include <math.h>
 
 #define DIGITAL_TOL 0.30
@@ -64,6 +65,74 @@ static void test_digital_mc_vs_analytical(void)
     mco_ctx_free(ctx);
 }
 
+static void test_digital_mc_stratified(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+    mco_set_stratified(ctx, 1);
+
+    double mc = mco_digital_call(ctx, 100.0, 100.0, 1.0, 0.05, 0.20, 1.0, 1);
+    double anal = mco_digital_cash_call(100.0, 100.0, 1.0, 0.05, 0.20, 1.0);
+
+    /* Indicator is monotone in Z - stratification removes almost all noise */
+    TEST_ASSERT_DOUBLE_WITHIN(0.001, anal, mc);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_digital_importance_deep_otm(void)
+{
+    /* K = 180: about 0.25% of plain paths finish in the money */
+    double anal = mco_digital_cash_call(100.0, 180.0, 1.0, 0.05, 0.20, 1.0);
+
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+    mco_set_seed(ctx, 42);
+
+    mco_digital_call(ctx, 100.0, 180.0, 1.0, 0.05, 0.20, 1.0, 1);
+    double plain_se = mco_get_std_error(ctx);
+
+    mco_set_importance_sampling(ctx, 1);
+    double is = mco_digital_call(ctx, 100.0, 180.0, 1.0, 0.05, 0.20, 1.0, 1);
+    double is_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * is_se, anal, is);
+    TEST_ASSERT_TRUE(is_se * 5.0 < plain_se);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_digital_importance_asset_put(void)
+{
+    double anal = mco_digital_asset_put(100.0, 60.0, 0.05, 0.20, 1.0);
+
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+    mco_set_seed(ctx, 42);
+    mco_set_importance_sampling(ctx, 1);
+
+    double is = mco_digital_put(ctx, 100.0, 60.0, 1.0, 0.05, 0.20, 1.0, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * mco_get_std_error(ctx), anal, is);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_digital_is_std_error_cancellation(void)
+{
+    /* Mean 1e6 above a spread of ±0.5: Σx² - n·mean² keeps no digits */
+    mco_is_stats stats;
+    mco_is_init(&stats);
+    for (int i = 0; i < 100000; i++) {
+        mco_is_add(&stats, 1e6 + ((i & 1) ? 0.5 : -0.5));
+    }
+
+    /* Variance 0.25·n/(n - 1) */
+    double expected = sqrt(0.25 / 99999.0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6 * expected, expected, mco_is_std_error(&stats));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 1e6, mco_is_mean(&stats));
+}
+
 static void test_digital_itm(void)
 {
     /* Deep ITM: should be significantly higher than ATM */
@@ -103,6 +172,67 @@ static void test_digital_reproducible(void)
     mco_ctx_free(ctx2);
 }
 
+static void test_digital_fast_precision(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 200000);
+    mco_set_seed(ctx, 42);
+
+    double cash = mco_digital_call(ctx, 100.0, 100.0, 10.0, 0.05, 0.20, 1.0, 1);
+    double cash_se = mco_get_std_error(ctx);
+    double asset = mco_digital_put(ctx, 100.0, 100.0, 0.0, 0.05, 0.20, 1.0, 0);
+    double asset_se = mco_get_std_error(ctx);
+
+    mco_set_precision(ctx, MCO_PRECISION_FAST);
+    double fast_cash = mco_digital_call(ctx, 100.0, 100.0, 10.0, 0.05, 0.20, 1.0, 1);
+    double fast_cash_se = mco_get_std_error(ctx);
+    double fast_asset = mco_digital_put(ctx, 100.0, 100.0, 0.0, 0.05, 0.20, 1.0, 0);
+    double fast_asset_se = mco_get_std_error(ctx);
+
+    /* Same estimator variance as double; agreement within the combined error */
+    double cash_ref = mco_digital_cash_call(100.0, 100.0, 10.0, 0.05, 0.20, 1.0);
+    double asset_ref = mco_digital_asset_put(100.0, 100.0, 0.05, 0.20, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(0.1 * cash_se, cash_se, fast_cash_se);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * hypot(cash_se, fast_cash_se) + 1e-4 * cash_ref,
+                              cash, fast_cash);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * hypot(asset_se, fast_asset_se) + 1e-4 * asset_ref,
+                              asset, fast_asset);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * fast_cash_se + 1e-4 * cash_ref, cash_ref, fast_cash);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_digital_pde_batch(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    double spot[3] = { 80.0, 100.0, 120.0 };
+    double strike[3] = { 100.0, 100.0, 100.0 };
+    double payout[3] = { 1.0, 1.0, 1.0 };
+    double rate[3] = { 0.05, 0.05, 0.05 };
+    double vol[3] = { 0.20, 0.20, 0.20 };
+    double time[3] = { 1.0, 1.0, 1.0 };
+    mco_pde_result cash[3] = { 0 };
+    mco_pde_result asset[3] = { 0 };
+
+    mco_digital_pde_batch(ctx, spot, strike, payout, rate, vol, time, 3, 1, MCO_CALL, cash);
+    mco_digital_pde_batch(ctx, spot, strike, NULL, rate, vol, time, 3, 0, MCO_PUT, asset);
+
+    for (size_t i = 0; i < 3; i++) {
+        double c = mco_digital_cash_call(spot[i], 100.0, 1.0, 0.05, 0.20, 1.0);
+        double a = mco_digital_asset_put(spot[i], 100.0, 0.05, 0.20, 1.0);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, c, cash[i].price);
+        /* The asset payoff jumps by the strike, not by one */
+        TEST_ASSERT_DOUBLE_WITHIN(0.05, a, asset[i].price);
+        TEST_ASSERT_TRUE(cash[i].delta > 0.0);
+    }
+
+    /* Rannacher start-up keeps gamma smooth across the strike */
+    TEST_ASSERT_TRUE(cash[0].gamma > 0.0);
+    TEST_ASSERT_TRUE(cash[2].gamma < 0.0);
+
+    mco_ctx_free(ctx);
+}
+
 int main(void)
 {
     UnityBegin("test_digital.c");
@@ -113,9 +243,15 @@ int main(void)
     RUN_TEST(test_digital_asset_call_atm);
     RUN_TEST(test_digital_asset_put_atm);
     RUN_TEST(test_digital_mc_vs_analytical);
+    RUN_TEST(test_digital_mc_stratified);
+    RUN_TEST(test_digital_importance_deep_otm);
+    RUN_TEST(test_digital_importance_asset_put);
+    RUN_TEST(test_digital_is_std_error_cancellation);
     RUN_TEST(test_digital_itm);
     RUN_TEST(test_digital_otm);
     RUN_TEST(test_digital_reproducible);
+    RUN_TEST(test_digital_fast_precision);
+    RUN_TEST(test_digital_pde_batch);
 
     return UnityEnd();
 }
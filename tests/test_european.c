@@ -5,8 +5,10 @@
  * Verifies:
  *   - MC prices converge to Black-Scholes analytical values
  *   - Antithetic variates reduce variance
+ *   - Stratified sampling converges tightly, single and multi-threaded
  *   - Multi-threading produces correct results
  *   - Put-call parity holds
+ *   - Single-precision mode agrees with double within standard errors
  */
 #include "unity/unity.h"
 #include "mcoptions.h"
@@ -16,6 +18,7 @@
 /* Test tolerance - MC has inherent variance */
 #define MC_TOLERANCE 1.00  /* $1.00 for 100K sims without variance reduction */
 #define MC_TOLERANCE_TIGHT 0.30  /* Tighter for antithetic */
+#define MC_TOLERANCE_STRAT 0.02  /* Stratified terminal normal */
 
 /*-------------------------------------------------------
  * Helper: Black-Scholes reference prices
@@ -122,6 +125,41 @@ static void test_european_put_antithetic(void)
     mco_ctx_free(ctx);
 }
 
+/*-------------------------------------------------------
+ * Stratified Sampling Tests
+ *-------------------------------------------------------*/
+static void test_european_call_stratified(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_NOT_NULL(ctx);
+
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+    mco_set_stratified(ctx, 1);
+
+    double price = mco_european_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(MC_TOLERANCE_STRAT, ATM_CALL_BS, price);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_european_put_stratified_multithreaded(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_NOT_NULL(ctx);
+
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+    mco_set_threads(ctx, 4);
+    mco_set_stratified(ctx, 1);
+
+    /* Threads split the strata, so the union still covers each once */
+    double price = mco_european_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(MC_TOLERANCE_STRAT, ATM_PUT_BS, price);
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Multi-Threading Tests
  *-------------------------------------------------------*/
@@ -233,6 +271,37 @@ static void test_put_call_parity(void)
     mco_ctx_free(ctx);
 }
 
+/*-------------------------------------------------------
+ * Single-Precision Screening Mode
+ *-------------------------------------------------------*/
+static void test_european_fast_precision(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 200000);
+
+    /* Against double on another stream: within combined standard errors */
+    mco_set_seed(ctx, 42);
+    double call = mco_european_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    double put = mco_european_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    mco_set_precision(ctx, MCO_PRECISION_FAST);
+    double fast_call = mco_european_call(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    double call_se = mco_get_std_error(ctx);
+    double fast_put = mco_european_put(ctx, 100.0, 100.0, 0.05, 0.20, 1.0);
+    double put_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_TRUE(call_se > 0.0 && call_se < 0.05);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sqrt(2.0) * call_se + 1e-4 * ATM_CALL_BS, call, fast_call);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sqrt(2.0) * put_se + 1e-4 * ATM_PUT_BS, put, fast_put);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * call_se + 1e-4 * ATM_CALL_BS, ATM_CALL_BS, fast_call);
+
+    /* No sampling error at σ = 0: only the float bias is left */
+    double expected = 100.0 - 90.0 * exp(-0.05);
+    double zero_vol = mco_european_call(ctx, 100.0, 90.0, 0.05, 0.0, 1.0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4 * expected, expected, zero_vol);
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Black-Scholes Analytical Tests
  *-------------------------------------------------------*/
@@ -278,6 +347,51 @@ static void test_european_zero_time(void)
     mco_ctx_free(ctx);
 }
 
+/*-------------------------------------------------------
+ * Finite Differences
+ *-------------------------------------------------------*/
+static void test_european_pde_batch(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    double spot[4] = { 80.0, 100.0, 120.0, 100.0 };
+    double strike[4] = { 100.0, 100.0, 100.0, 90.0 };
+    double rate[4] = { 0.05, 0.05, 0.05, 0.02 };
+    double vol[4] = { 0.20, 0.20, 0.20, 0.35 };
+    double time[4] = { 1.0, 1.0, 1.0, 0.5 };
+    mco_pde_result out[4] = { 0 };
+
+    mco_european_pde_batch(ctx, spot, strike, rate, vol, time, 4, MCO_CALL, out);
+    TEST_ASSERT_EQUAL_INT(MCO_OK, mco_ctx_last_error(ctx));
+
+    for (size_t i = 0; i < 4; i++) {
+        double sqrt_t = sqrt(time[i]);
+        double d1 = (log(spot[i] / strike[i]) + (rate[i] + 0.5 * vol[i] * vol[i]) * time[i])
+                  / (vol[i] * sqrt_t);
+        double d2 = d1 - vol[i] * sqrt_t;
+        double pdf = 0.3989422804014327 * exp(-0.5 * d1 * d1);
+        double n1 = 0.5 * erfc(-d1 / sqrt(2.0));
+        double n2 = 0.5 * erfc(-d2 / sqrt(2.0));
+        double theta = -spot[i] * pdf * vol[i] / (2.0 * sqrt_t)
+                     - rate[i] * strike[i] * exp(-rate[i] * time[i]) * n2;
+
+        double bs = mco_black_scholes_call(spot[i], strike[i], rate[i], vol[i], time[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, bs, out[i].price);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, n1, out[i].delta);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-4, pdf / (spot[i] * vol[i] * sqrt_t), out[i].gamma);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-2, theta, out[i].theta);
+    }
+
+    /* Invalid elements are zeroed, the rest still priced */
+    vol[1] = 0.0;
+    mco_european_pde_batch(ctx, spot, strike, rate, vol, time, 4, MCO_PUT, out);
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_ctx_last_error(ctx));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, out[1].price);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, mco_black_scholes_put(80.0, 100.0, 0.05, 0.20, 1.0),
+                              out[0].price);
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Test Runner
  *-------------------------------------------------------*/
@@ -295,6 +409,10 @@ int main(void)
     RUN_TEST(test_european_call_antithetic);
     RUN_TEST(test_european_put_antithetic);
 
+    /* Stratified sampling */
+    RUN_TEST(test_european_call_stratified);
+    RUN_TEST(test_european_put_stratified_multithreaded);
+
     /* Multi-threading */
     RUN_TEST(test_european_call_multithreaded);
     RUN_TEST(test_european_call_multithreaded_antithetic);
@@ -303,6 +421,9 @@ int main(void)
     RUN_TEST(test_european_reproducible_single_thread);
     RUN_TEST(test_european_reproducible_multithreaded);
 
+    /* Single-precision lanes */
+    RUN_TEST(test_european_fast_precision);
+
     /* Put-call parity */
     RUN_TEST(test_put_call_parity);
 
@@ -314,5 +435,8 @@ int main(void)
     RUN_TEST(test_european_zero_volatility);
     RUN_TEST(test_european_zero_time);
 
+    /* Finite differences */
+    RUN_TEST(test_european_pde_batch);
+
     return UnityEnd();
 }
@@ -7,6 +7,7 @@
  *   - Reasonable prices
  *   - Skew with negative correlation
  *   - Reproducibility
+ *   - Conditional MC agreement and variance reduction
  */
 #include "unity/unity.h"
 #include "mcoptions.h"
@@ -195,6 +196,98 @@ static void test_heston_reproducible(void)
     mco_ctx_free(ctx2);
 }
 
+/*-------------------------------------------------------
+ * Conditional Monte Carlo
+ *-------------------------------------------------------*/
+static void test_heston_conditional_matches_standard(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 50000);
+    mco_set_steps(ctx, 100);
+
+    mco_set_seed(ctx, 42);
+    double standard = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                TEST_V0, TEST_KAPPA, TEST_THETA,
+                                                TEST_SIGMA, TEST_RHO);
+
+    mco_set_conditional_mc(ctx, 1);
+    mco_set_simulations(ctx, 10000);
+    mco_set_seed(ctx, 42);
+    double conditional = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                   TEST_V0, TEST_KAPPA, TEST_THETA,
+                                                   TEST_SIGMA, TEST_RHO);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.5, standard, conditional);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_heston_conditional_put_call_parity(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 20000);
+    mco_set_steps(ctx, 100);
+    mco_set_conditional_mc(ctx, 1);
+
+    mco_set_seed(ctx, 7);
+    double call = mco_heston_european_call(ctx, 100.0, 95.0, 0.05, 1.0,
+                                            TEST_V0, TEST_KAPPA, TEST_THETA,
+                                            TEST_SIGMA, TEST_RHO);
+    mco_set_seed(ctx, 7);
+    double put = mco_heston_european_put(ctx, 100.0, 95.0, 0.05, 1.0,
+                                          TEST_V0, TEST_KAPPA, TEST_THETA,
+                                          TEST_SIGMA, TEST_RHO);
+
+    /* C - P = S - K·e^(-rT), path by path up to the S_eff martingale error */
+    double parity = 100.0 - 95.0 * exp(-0.05);
+    TEST_ASSERT_DOUBLE_WITHIN(0.2, parity, call - put);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_heston_conditional_reduces_variance(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 2000);
+    mco_set_steps(ctx, 50);
+
+    double prices_std[8];
+    double prices_cond[8];
+
+    for (int i = 0; i < 8; ++i) {
+        mco_set_conditional_mc(ctx, 0);
+        mco_set_seed(ctx, (uint64_t)(300 + i));
+        prices_std[i] = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                  TEST_V0, TEST_KAPPA, TEST_THETA,
+                                                  TEST_SIGMA, TEST_RHO);
+
+        mco_set_conditional_mc(ctx, 1);
+        mco_set_seed(ctx, (uint64_t)(300 + i));
+        prices_cond[i] = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                                   TEST_V0, TEST_KAPPA, TEST_THETA,
+                                                   TEST_SIGMA, TEST_RHO);
+    }
+
+    double mean_std = 0, mean_cond = 0;
+    for (int i = 0; i < 8; ++i) {
+        mean_std += prices_std[i];
+        mean_cond += prices_cond[i];
+    }
+    mean_std /= 8;
+    mean_cond /= 8;
+
+    double var_std = 0, var_cond = 0;
+    for (int i = 0; i < 8; ++i) {
+        var_std += (prices_std[i] - mean_std) * (prices_std[i] - mean_std);
+        var_cond += (prices_cond[i] - mean_cond) * (prices_cond[i] - mean_cond);
+    }
+
+    /* Integrating out the spot noise removes most of the variance */
+    TEST_ASSERT_TRUE(var_cond < var_std * 0.5);
+
+    mco_ctx_free(ctx);
+}
+
 /*-------------------------------------------------------
  * Test Runner
  *-------------------------------------------------------*/
@@ -220,5 +313,10 @@ int main(void)
     /* Reproducibility */
     RUN_TEST(test_heston_reproducible);
 
+    /* Conditional Monte Carlo */
+    RUN_TEST(test_heston_conditional_matches_standard);
+    RUN_TEST(test_heston_conditional_put_call_parity);
+    RUN_TEST(test_heston_conditional_reduces_variance);
+
     return UnityEnd();
 }
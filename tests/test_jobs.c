@@ -0,0 +1,334 @@
+/*
+ * Asynchronous Job Tests
+ *
+ * Tests:
+ * 1. Invalid descriptors are rejected
+ * 2. A job matches the synchronous one-thread price and standard error
+ * 3. Every job kind matches its synchronous pricer
+ * 4. Hundreds of jobs in flight on a small pool
+ * 5. Callbacks run once per job, with the result already available
+ * 6. Jobs freed by their callbacks; freeing the context drains the queue
+ * 7. Jobs price a snapshot and leave the context state alone
+ * 8. Pricer errors are reported on the job
+ */
+#include "unity/unity.h"
+#include "mcoptions.h"
+#include <math.h>
+#include <pthread.h>
+
+#define JOB_SIMS 20000
+
+static mco_ctx *make_ctx(uint32_t threads)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_NOT_NULL(ctx);
+    mco_set_seed(ctx, 42);
+    mco_set_simulations(ctx, JOB_SIMS);
+    mco_set_threads(ctx, threads);
+    return ctx;
+}
+
+static mco_job_desc make_desc(mco_job_kind kind, mco_option_type type)
+{
+    mco_job_desc desc = {
+        .kind             = kind,
+        .type             = type,
+        .spot             = 100.0,
+        .strike           = 100.0,
+        .rate             = 0.05,
+        .volatility       = 0.20,
+        .time_to_maturity = 1.0,
+        .num_steps        = 20,
+        .barrier          = 120.0,
+        .rebate           = 0.0,
+        .barrier_style    = MCO_BARRIER_UP_OUT,
+        .floating_strike  = 1,
+        .payout           = 10.0,
+        .cash_or_nothing  = 1
+    };
+    return desc;
+}
+
+/* Synchronous price of a descriptor on ctx */
+static double sync_price(mco_ctx *ctx, const mco_job_desc *d)
+{
+    int call = d->type == MCO_CALL;
+    switch (d->kind) {
+        case MCO_JOB_EUROPEAN:
+            return call ? mco_european_call(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity)
+                        : mco_european_put(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity);
+        case MCO_JOB_AMERICAN:
+            return call ? mco_american_call(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps)
+                        : mco_american_put(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps);
+        case MCO_JOB_BERMUDAN:
+            return call ? mco_bermudan_call(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps)
+                        : mco_bermudan_put(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps);
+        case MCO_JOB_ASIAN:
+            return call ? mco_asian_call(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps)
+                        : mco_asian_put(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps);
+        case MCO_JOB_ASIAN_GEOMETRIC:
+            return call ? mco_asian_geometric_call(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps)
+                        : mco_asian_geometric_put(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity, d->num_steps);
+        case MCO_JOB_BARRIER:
+            return call ? mco_barrier_call(ctx, d->spot, d->strike, d->barrier, d->rebate, d->rate, d->volatility,
+                                           d->time_to_maturity, d->num_steps, d->barrier_style)
+                        : mco_barrier_put(ctx, d->spot, d->strike, d->barrier, d->rebate, d->rate, d->volatility,
+                                          d->time_to_maturity, d->num_steps, d->barrier_style);
+        case MCO_JOB_LOOKBACK:
+            return call ? mco_lookback_call(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity,
+                                            d->num_steps, d->floating_strike)
+                        : mco_lookback_put(ctx, d->spot, d->strike, d->rate, d->volatility, d->time_to_maturity,
+                                           d->num_steps, d->floating_strike);
+        case MCO_JOB_DIGITAL:
+            return call ? mco_digital_call(ctx, d->spot, d->strike, d->payout, d->rate, d->volatility,
+                                           d->time_to_maturity, d->cash_or_nothing)
+                        : mco_digital_put(ctx, d->spot, d->strike, d->payout, d->rate, d->volatility,
+                                          d->time_to_maturity, d->cash_or_nothing);
+        default:
+            return 0.0;
+    }
+}
+
+/*-------------------------------------------------------
+ * Submission
+ *-------------------------------------------------------*/
+static void test_jobs_invalid_desc(void)
+{
+    mco_ctx *ctx = make_ctx(2);
+
+    TEST_ASSERT_NULL(mco_submit(ctx, NULL));
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_ctx_last_error(ctx));
+
+    mco_job_desc desc = make_desc(MCO_JOB_EUROPEAN, MCO_CALL);
+    desc.kind = (mco_job_kind)99;
+    TEST_ASSERT_NULL(mco_submit(ctx, &desc));
+
+    desc = make_desc(MCO_JOB_EUROPEAN, (mco_option_type)7);
+    TEST_ASSERT_NULL(mco_submit(ctx, &desc));
+
+    TEST_ASSERT_NULL(mco_submit(NULL, &desc));
+    TEST_ASSERT_EQUAL_INT(0, mco_job_poll(NULL));
+    mco_job_free(NULL);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_jobs_match_sync(void)
+{
+    mco_ctx *ctx = make_ctx(4);
+    mco_job_desc desc = make_desc(MCO_JOB_BARRIER, MCO_CALL);
+
+    mco_job *job = mco_submit(ctx, &desc);
+    TEST_ASSERT_NOT_NULL(job);
+    double price = mco_job_wait(job);
+
+    TEST_ASSERT_EQUAL_INT(1, mco_job_poll(job));
+    TEST_ASSERT_EQUAL_INT(MCO_OK, mco_job_error(job));
+
+    /* Same settings on one thread */
+    mco_set_threads(ctx, 1);
+    double expected = sync_price(ctx, &desc);
+
+    TEST_ASSERT_EQUAL_DOUBLE(expected, price);
+    TEST_ASSERT_EQUAL_DOUBLE(mco_get_std_error(ctx), mco_job_std_error(job));
+    TEST_ASSERT_TRUE(mco_job_std_error(job) > 0.0);
+
+    mco_job_free(job);
+    mco_ctx_free(ctx);
+}
+
+static void test_jobs_all_kinds(void)
+{
+    mco_ctx *ctx = make_ctx(3);
+    mco_ctx *ref = make_ctx(1);
+
+    mco_job *jobs[16];
+    mco_job_desc descs[16];
+    for (int k = 0; k < 8; k++) {
+        for (int t = 0; t < 2; t++) {
+            descs[2 * k + t] = make_desc((mco_job_kind)k, t ? MCO_PUT : MCO_CALL);
+            jobs[2 * k + t] = mco_submit(ctx, &descs[2 * k + t]);
+            TEST_ASSERT_NOT_NULL(jobs[2 * k + t]);
+        }
+    }
+
+    /* Reseeded per call: the European pricer advances the context RNG */
+    for (int i = 0; i < 16; i++) {
+        mco_set_seed(ref, 42);
+        double expected = sync_price(ref, &descs[i]);
+        TEST_ASSERT_TRUE(expected > 0.0);
+        TEST_ASSERT_EQUAL_DOUBLE(expected, mco_job_wait(jobs[i]));
+        mco_job_free(jobs[i]);
+    }
+
+    mco_ctx_free(ref);
+    mco_ctx_free(ctx);
+}
+
+static void test_jobs_many_in_flight(void)
+{
+    mco_ctx *ctx = make_ctx(4);
+    mco_set_simulations(ctx, 2000);
+
+    /* A strike ladder, every job from the same RNG state */
+    enum { N = 300 };
+    static mco_job *jobs[N];
+    for (int i = 0; i < N; i++) {
+        mco_job_desc desc = make_desc(MCO_JOB_EUROPEAN, MCO_CALL);
+        desc.strike = 80.0 + (double)(i % 30) * 2.0;
+        jobs[i] = mco_submit(ctx, &desc);
+        TEST_ASSERT_NOT_NULL(jobs[i]);
+    }
+
+    mco_set_threads(ctx, 1);
+    for (int i = 0; i < N; i++) {
+        double strike = 80.0 + (double)(i % 30) * 2.0;
+        mco_set_seed(ctx, 42);
+        double expected = mco_european_call(ctx, 100.0, strike, 0.05, 0.20, 1.0);
+        TEST_ASSERT_EQUAL_DOUBLE(expected, mco_job_wait(jobs[i]));
+        mco_job_free(jobs[i]);
+    }
+
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Callbacks
+ *-------------------------------------------------------*/
+typedef struct {
+    pthread_mutex_t lock;
+    int calls;
+    int ready;              /* Result visible inside the callback */
+    double sum;
+    int free_self;
+} callback_log;
+
+static void on_done(mco_job *job, void *user_data)
+{
+    callback_log *log = (callback_log *)user_data;
+    int ready = mco_job_poll(job);
+    double price = mco_job_wait(job);
+
+    pthread_mutex_lock(&log->lock);
+    log->calls++;
+    log->ready += ready;
+    log->sum += price;
+    pthread_mutex_unlock(&log->lock);
+
+    if (log->free_self) mco_job_free(job);
+}
+
+static void test_jobs_callback(void)
+{
+    mco_ctx *ctx = make_ctx(2);
+    callback_log log = { .calls = 0, .ready = 0, .sum = 0.0, .free_self = 0 };
+    pthread_mutex_init(&log.lock, NULL);
+
+    mco_job *jobs[20];
+    double total = 0.0;
+    for (int i = 0; i < 20; i++) {
+        mco_job_desc desc = make_desc(MCO_JOB_EUROPEAN, MCO_PUT);
+        desc.callback = on_done;
+        desc.user_data = &log;
+        jobs[i] = mco_submit(ctx, &desc);
+        TEST_ASSERT_NOT_NULL(jobs[i]);
+    }
+    for (int i = 0; i < 20; i++) {
+        total += mco_job_wait(jobs[i]);
+        mco_job_free(jobs[i]);      /* Waits for the callback */
+    }
+
+    TEST_ASSERT_EQUAL_INT(20, log.calls);
+    TEST_ASSERT_EQUAL_INT(20, log.ready);
+    TEST_ASSERT_EQUAL_DOUBLE(total, log.sum);
+
+    pthread_mutex_destroy(&log.lock);
+    mco_ctx_free(ctx);
+}
+
+static void test_jobs_callback_free_and_drain(void)
+{
+    mco_ctx *ctx = make_ctx(3);
+    callback_log log = { .calls = 0, .ready = 0, .sum = 0.0, .free_self = 1 };
+    pthread_mutex_init(&log.lock, NULL);
+
+    /* Fire and forget: the callbacks free the jobs */
+    for (int i = 0; i < 50; i++) {
+        mco_job_desc desc = make_desc(MCO_JOB_DIGITAL, MCO_CALL);
+        desc.callback = on_done;
+        desc.user_data = &log;
+        TEST_ASSERT_NOT_NULL(mco_submit(ctx, &desc));
+    }
+
+    /* Returns once every queued job has run */
+    mco_ctx_free(ctx);
+
+    TEST_ASSERT_EQUAL_INT(50, log.calls);
+    TEST_ASSERT_EQUAL_INT(50, log.ready);
+
+    pthread_mutex_destroy(&log.lock);
+}
+
+/*-------------------------------------------------------
+ * Context State
+ *-------------------------------------------------------*/
+static void test_jobs_snapshot(void)
+{
+    mco_ctx *ctx = make_ctx(2);
+    mco_job_desc desc = make_desc(MCO_JOB_ASIAN, MCO_CALL);
+
+    mco_job *job = mco_submit(ctx, &desc);
+    TEST_ASSERT_NOT_NULL(job);
+
+    /* Settings changed after submission do not reach the job */
+    mco_set_seed(ctx, 7);
+    mco_set_simulations(ctx, 100);
+    double price = mco_job_wait(job);
+
+    TEST_ASSERT_EQUAL_INT(MCO_OK, mco_ctx_last_error(ctx));
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_get_std_error(ctx));
+
+    mco_set_seed(ctx, 42);
+    mco_set_simulations(ctx, JOB_SIMS);
+    mco_set_threads(ctx, 1);
+    TEST_ASSERT_EQUAL_DOUBLE(sync_price(ctx, &desc), price);
+
+    mco_job_free(job);
+    mco_ctx_free(ctx);
+}
+
+static void test_jobs_pricer_error(void)
+{
+    mco_ctx *ctx = make_ctx(2);
+    mco_job_desc desc = make_desc(MCO_JOB_AMERICAN, MCO_PUT);
+    desc.spot = -1.0;
+
+    mco_job *job = mco_submit(ctx, &desc);
+    TEST_ASSERT_NOT_NULL(job);
+
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, mco_job_wait(job));
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_job_error(job));
+    TEST_ASSERT_EQUAL_INT(MCO_OK, mco_ctx_last_error(ctx));
+
+    mco_job_free(job);
+    mco_ctx_free(ctx);
+}
+
+/*-------------------------------------------------------
+ * Test Runner
+ *-------------------------------------------------------*/
+int main(void)
+{
+    UnityBegin("test_jobs.c");
+
+    RUN_TEST(test_jobs_invalid_desc);
+    RUN_TEST(test_jobs_match_sync);
+    RUN_TEST(test_jobs_all_kinds);
+    RUN_TEST(test_jobs_many_in_flight);
+    RUN_TEST(test_jobs_callback);
+    RUN_TEST(test_jobs_callback_free_and_drain);
+    RUN_TEST(test_jobs_snapshot);
+    RUN_TEST(test_jobs_pricer_error);
+
+    return UnityEnd();
+}
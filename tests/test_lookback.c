@@ -86,6 +86,70 @@ static void test_lookback_more_obs_higher_price(void)
     mco_ctx_free(ctx);
 }
 
+static void test_lookback_analytical_continuous(void)
+{
+    /* Goldman-Sosin-Gatto floating call reference: 17.217 */
+    TEST_ASSERT_DOUBLE_WITHIN(0.001, 17.217, mco_lookback_floating_call(100.0, 0.05, 0.20, 1.0));
+
+    /* At-the-money fixed strikes reduce to the floating ones */
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, mco_lookback_floating_put(100.0, 0.05, 0.20, 1.0),
+                              mco_lookback_fixed_call(100.0, 100.0, 0.05, 0.20, 1.0));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-10, mco_lookback_floating_call(100.0, 0.05, 0.20, 1.0),
+                              mco_lookback_fixed_put(100.0, 100.0, 0.05, 0.20, 1.0));
+
+    /* r = 0 uses the limit of the σ²/2r terms */
+    TEST_ASSERT_DOUBLE_WITHIN(1e-3, mco_lookback_floating_call(100.0, 1e-6, 0.20, 1.0),
+                              mco_lookback_floating_call(100.0, 0.0, 0.20, 1.0));
+}
+
+static void test_lookback_bridge_coarse_grid(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+    mco_set_bridge_extremum(ctx, 1);
+
+    /* Continuous monitoring from 16 steps */
+    double float_call = mco_lookback_call(ctx, 100.0, 0.0, 0.05, 0.20, 1.0, 16, 1);
+    double float_put = mco_lookback_put(ctx, 100.0, 0.0, 0.05, 0.20, 1.0, 16, 1);
+    double fixed_call = mco_lookback_call(ctx, 100.0, 110.0, 0.05, 0.20, 1.0, 16, 0);
+    double fixed_put = mco_lookback_put(ctx, 100.0, 90.0, 0.05, 0.20, 1.0, 16, 0);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.15, mco_lookback_floating_call(100.0, 0.05, 0.20, 1.0), float_call);
+    TEST_ASSERT_DOUBLE_WITHIN(0.15, mco_lookback_floating_put(100.0, 0.05, 0.20, 1.0), float_put);
+    TEST_ASSERT_DOUBLE_WITHIN(0.15, mco_lookback_fixed_call(100.0, 110.0, 0.05, 0.20, 1.0), fixed_call);
+    TEST_ASSERT_DOUBLE_WITHIN(0.10, mco_lookback_fixed_put(100.0, 90.0, 0.05, 0.20, 1.0), fixed_put);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_lookback_fast_precision(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    mco_set_simulations(ctx, 100000);
+    mco_set_seed(ctx, 42);
+
+    double floating = mco_lookback_call(ctx, 100.0, 0.0, 0.05, 0.20, 1.0, 50, 1);
+    double fixed = mco_lookback_put(ctx, 100.0, 90.0, 0.05, 0.20, 1.0, 50, 0);
+
+    mco_set_precision(ctx, MCO_PRECISION_FAST);
+    double fast_floating = mco_lookback_call(ctx, 100.0, 0.0, 0.05, 0.20, 1.0, 50, 1);
+    double floating_se = mco_get_std_error(ctx);
+    double fast_fixed = mco_lookback_put(ctx, 100.0, 90.0, 0.05, 0.20, 1.0, 50, 0);
+    double fixed_se = mco_get_std_error(ctx);
+
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sqrt(2.0) * floating_se + 1e-4 * floating,
+                              floating, fast_floating);
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * sqrt(2.0) * fixed_se + 1e-4 * fixed, fixed, fast_fixed);
+
+    /* σ = 0, r > 0: the maximum is S·e^(rT) */
+    double expected = 100.0 - 90.0 * exp(-0.05);
+    double zero_vol = mco_lookback_call(ctx, 100.0, 90.0, 0.05, 0.0, 1.0, 50, 0);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4 * expected, expected, zero_vol);
+
+    mco_ctx_free(ctx);
+}
+
 static void test_lookback_reproducible(void)
 {
     mco_ctx *ctx1 = mco_ctx_new();
@@ -114,7 +178,10 @@ int main(void)
     RUN_TEST(test_lookback_fixed_call);
     RUN_TEST(test_lookback_fixed_put);
     RUN_TEST(test_lookback_more_obs_higher_price);
+    RUN_TEST(test_lookback_analytical_continuous);
+    RUN_TEST(test_lookback_bridge_coarse_grid);
     RUN_TEST(test_lookback_reproducible);
+    RUN_TEST(test_lookback_fast_precision);
 
     return UnityEnd();
 }
@@ -0,0 +1,177 @@
+/*
+ * Multilevel Monte Carlo Tests
+ *
+ * Tests:
+ * 1. Invalid target RMSE is rejected
+ * 2. Asian call converges to the continuous-average price
+ * 3. Floating lookback call matches the continuous analytical price
+ * 4. Barrier in-out parity against Black-Scholes
+ * 5. Heston European agrees with the single-level pricer
+ * 6. Standard error is reported and within the target
+ * 7. Same seed gives the same price
+ * 8. Invalid contract inputs are rejected
+ */
+#include "unity/unity.h"
+#include "mcoptions.h"
+#include <math.h>
+
+#define MLMC_RMSE 0.05
+
+static mco_ctx *make_ctx(void)
+{
+    mco_ctx *ctx = mco_ctx_new();
+    TEST_ASSERT_NOT_NULL(ctx);
+    mco_set_seed(ctx, 42);
+    return ctx;
+}
+
+static void test_mlmc_invalid_rmse(void)
+{
+    mco_ctx *ctx = make_ctx();
+
+    double price = mco_mlmc_asian(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, MCO_CALL, 0.0);
+
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, price);
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_ctx_last_error(ctx));
+
+    mco_ctx_free(ctx);
+}
+
+/* Price must be 0 with MCO_ERR_INVALID_ARG on a fresh context */
+static void assert_rejected(double price, mco_ctx *ctx)
+{
+    TEST_ASSERT_EQUAL_DOUBLE(0.0, price);
+    TEST_ASSERT_EQUAL_INT(MCO_ERR_INVALID_ARG, mco_ctx_last_error(ctx));
+    mco_ctx_free(ctx);
+}
+
+static void test_mlmc_invalid_inputs(void)
+{
+    mco_ctx *ctx;
+
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_asian(ctx, 0.0, 100.0, 0.05, 0.20, 1.0, MCO_CALL, MLMC_RMSE), ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_asian(ctx, 100.0, 0.0, 0.05, 0.20, 1.0, MCO_CALL, MLMC_RMSE), ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_asian(ctx, 100.0, 100.0, 0.05, -0.20, 1.0, MCO_CALL, MLMC_RMSE),
+                    ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_lookback(ctx, -1.0, 100.0, 0.05, 0.20, 1.0, 1, MCO_CALL,
+                                      MLMC_RMSE), ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_lookback(ctx, 100.0, 0.0, 0.05, 0.20, 1.0, 0, MCO_CALL,
+                                      MLMC_RMSE), ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_barrier(ctx, 100.0, 100.0, 0.0, 0.0, 0.05, 0.20, 1.0,
+                                     MCO_BARRIER_DOWN_OUT, MCO_CALL, MLMC_RMSE), ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_barrier(ctx, 100.0, -5.0, 80.0, 0.0, 0.05, 0.20, 1.0,
+                                     MCO_BARRIER_DOWN_OUT, MCO_CALL, MLMC_RMSE), ctx);
+    ctx = make_ctx();
+    assert_rejected(mco_mlmc_heston_european(ctx, 100.0, 100.0, 0.05, 1.0, -0.04, 2.0,
+                                             0.04, 0.3, -0.7, MCO_CALL, MLMC_RMSE), ctx);
+}
+
+static void test_mlmc_asian_call(void)
+{
+    mco_ctx *ctx = make_ctx();
+
+    /* Daily-monitored reference (252 steps, 2M paths): ≈ 5.78 */
+    double price = mco_mlmc_asian(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, MCO_CALL, MLMC_RMSE);
+
+    TEST_ASSERT_DOUBLE_WITHIN(4.0 * MLMC_RMSE, 5.78, price);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_mlmc_lookback_floating(void)
+{
+    mco_ctx *ctx = make_ctx();
+
+    /* Goldman-Sosin-Gatto continuous floating call: 17.217 */
+    double price = mco_mlmc_lookback(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, 1,
+                                     MCO_CALL, MLMC_RMSE);
+
+    TEST_ASSERT_DOUBLE_WITHIN(3.0 * MLMC_RMSE, 17.217, price);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_mlmc_barrier_parity(void)
+{
+    mco_ctx *ctx = make_ctx();
+
+    double out = mco_mlmc_barrier(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0,
+                                  MCO_BARRIER_DOWN_OUT, MCO_CALL, MLMC_RMSE);
+    double in = mco_mlmc_barrier(ctx, 100.0, 100.0, 90.0, 0.0, 0.05, 0.20, 1.0,
+                                 MCO_BARRIER_DOWN_IN, MCO_CALL, MLMC_RMSE);
+    double vanilla = mco_black_scholes_call(100.0, 100.0, 0.05, 0.20, 1.0);
+
+    TEST_ASSERT_TRUE(out > 0.0);
+    TEST_ASSERT_TRUE(in > 0.0);
+    TEST_ASSERT_DOUBLE_WITHIN(6.0 * MLMC_RMSE, vanilla, out + in);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_mlmc_heston_european(void)
+{
+    mco_ctx *ctx = make_ctx();
+    mco_set_simulations(ctx, 200000);
+    mco_set_steps(ctx, 100);
+
+    double mlmc = mco_mlmc_heston_european(ctx, 100.0, 100.0, 0.05, 1.0,
+                                           0.04, 2.0, 0.04, 0.3, -0.7,
+                                           MCO_CALL, MLMC_RMSE);
+    double mc = mco_heston_european_call(ctx, 100.0, 100.0, 0.05, 1.0,
+                                         0.04, 2.0, 0.04, 0.3, -0.7);
+
+    TEST_ASSERT_DOUBLE_WITHIN(0.25, mc, mlmc);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_mlmc_std_error(void)
+{
+    mco_ctx *ctx = make_ctx();
+
+    mco_mlmc_asian(ctx, 100.0, 100.0, 0.05, 0.20, 1.0, MCO_PUT, MLMC_RMSE);
+    double se = mco_get_std_error(ctx);
+
+    /* Sampling error gets ε²/2 of the mean-square budget */
+    TEST_ASSERT_TRUE(se > 0.0);
+    TEST_ASSERT_TRUE(se <= MLMC_RMSE / sqrt(2.0) * 1.05);
+
+    mco_ctx_free(ctx);
+}
+
+static void test_mlmc_reproducible(void)
+{
+    mco_ctx *ctx1 = make_ctx();
+    mco_ctx *ctx2 = make_ctx();
+
+    double p1 = mco_mlmc_lookback(ctx1, 100.0, 100.0, 0.05, 0.20, 1.0, 0, MCO_CALL, 0.1);
+    double p2 = mco_mlmc_lookback(ctx2, 100.0, 100.0, 0.05, 0.20, 1.0, 0, MCO_CALL, 0.1);
+
+    TEST_ASSERT_EQUAL_DOUBLE(p1, p2);
+
+    mco_ctx_free(ctx1);
+    mco_ctx_free(ctx2);
+}
+
+int main(void)
+{
+    UnityBegin("test_mlmc.c");
+
+    RUN_TEST(test_mlmc_invalid_rmse);
+    RUN_TEST(test_mlmc_asian_call);
+    RUN_TEST(test_mlmc_lookback_floating);
+    RUN_TEST(test_mlmc_barrier_parity);
+    RUN_TEST(test_mlmc_heston_european);
+    RUN_TEST(test_mlmc_std_error);
+    RUN_TEST(test_mlmc_reproducible);
+    RUN_TEST(test_mlmc_invalid_inputs);
+
+    return UnityEnd();
+}
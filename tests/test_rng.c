@@ -7,9 +7,13 @@
  *   - Uniform distribution in [0, 1)
  *   - Normal distribution has correct mean/variance
  *   - Jump produces independent streams
+ *   - Single-precision lanes: streams, sampler and exp/log within their
+ *     documented bounds of the double results
  */
 #include "unity/unity.h"
 #include "internal/rng.h"
+#include "internal/methods/fast_mc.h"
+#include "internal/methods/sobol.h"
 #include <math.h>
 
 /*-------------------------------------------------------
@@ -155,6 +159,66 @@ static void test_rng_jump_reproducible(void)
     }
 }
 
+/*-------------------------------------------------------
+ * Single-Precision Lanes
+ *-------------------------------------------------------*/
+static void test_rng_fast_lanes_match_scalar(void)
+{
+    mco_rng base, seeds;
+    mco_rng_seed(&base, 42);
+    seeds = base;
+
+    mco_fast_rng lanes;
+    mco_fast_rng_init(&lanes, &base);
+
+    /* Lane l is the scalar generator seeded from draw l */
+    mco_rng scalar[MCO_FAST_LANES];
+    for (int l = 0; l < MCO_FAST_LANES; l++) {
+        mco_rng_seed(&scalar[l], mco_rng_next(&seeds));
+    }
+
+    uint64_t draw[MCO_FAST_LANES];
+    for (int i = 0; i < 100; i++) {
+        mco_fast_rng_next(&lanes, draw);
+        for (int l = 0; l < MCO_FAST_LANES; l++) {
+            TEST_ASSERT_EQUAL_HEX64(mco_rng_next(&scalar[l]), draw[l]);
+        }
+    }
+}
+
+static void test_rng_fast_normal_accuracy(void)
+{
+    /* Every 7th point of the 2²³ sampler grid against Φ⁻¹ in double */
+    double max_err = 0.0, max_z = 0.0;
+    for (uint32_t k = 0; k < (1u << 23); k += 7) {
+        double z = (double)mco_fast_normal((uint64_t)k << 41);
+        double ref = mco_sobol_inv_normal(((double)k + 0.5) / 8388608.0);
+        max_err = fmax(max_err, fabs(z - ref));
+        max_z = fmax(max_z, fabs(z));
+    }
+    double last = (double)mco_fast_normal(~(uint64_t)0);
+
+    TEST_ASSERT_TRUE(max_err < 1.5e-6);
+    TEST_ASSERT_TRUE(max_z < 5.3);
+    TEST_ASSERT_DOUBLE_WITHIN(1.5e-6, mco_sobol_inv_normal(1.0 - 0.5 / 8388608.0), last);
+}
+
+static void test_rng_fast_exp_log_accuracy(void)
+{
+    double exp_err = 0.0, log_err = 0.0;
+    for (float x = -80.0f; x < 80.0f; x += 0.01f) {
+        double ref = exp((double)x);
+        exp_err = fmax(exp_err, fabs((double)mco_fast_expf(x) - ref) / ref);
+    }
+    for (float x = 1e-30f; x < 1e30f; x *= 1.001f) {
+        double ref = log((double)x);
+        log_err = fmax(log_err, fabs((double)mco_fast_logf(x) - ref) / fmax(fabs(ref), 1.0));
+    }
+
+    TEST_ASSERT_TRUE(exp_err < 3e-7);
+    TEST_ASSERT_TRUE(log_err < 1.5e-7);
+}
+
 /*-------------------------------------------------------
  * Test Runner
  *-------------------------------------------------------*/
@@ -170,6 +234,9 @@ int main(void)
     RUN_TEST(test_rng_normal_variance);
     RUN_TEST(test_rng_jump_different_streams);
     RUN_TEST(test_rng_jump_reproducible);
+    RUN_TEST(test_rng_fast_lanes_match_scalar);
+    RUN_TEST(test_rng_fast_normal_accuracy);
+    RUN_TEST(test_rng_fast_exp_log_accuracy);
 
     return UnityEnd();
 }
@@ -0,0 +1,107 @@
+/*
+ * Summation Tests
+ *
+ * Tests for the blocked pairwise sum used by the estimators.
+ * Verifies:
+ *   - Accuracy against a compensated long double reference, in one
+ *     pass and merged from uneven thread slices
+ *   - add and add_n agree bitwise
+ */
+#include "unity/unity.h"
+#include "internal/rng.h"
+#include "internal/sum.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * Neumaier-compensated sum in long double: exact enough to serve as
+ * the reference for a double sum
+ */
+static double reference_sum(const double *x, size_t n)
+{
+    long double s = 0.0L, c = 0.0L;
+    for (size_t i = 0; i < n; i++) {
+        long double t = s + (long double)x[i];
+        c += (fabsl(s) >= fabsl((long double)x[i])) ? (s - t) + (long double)x[i]
+                                                    : ((long double)x[i] - t) + s;
+        s = t;
+    }
+    return (double)(s + c);
+}
+
+static void test_sum_accuracy(void)
+{
+    /* Payoff-like values: mostly zero, the rest spread over decades */
+    size_t n = (size_t)1 << 22;
+    double *x = (double *)malloc(n * sizeof(double));
+    TEST_ASSERT_NOT_NULL(x);
+
+    mco_rng rng;
+    mco_rng_seed(&rng, 2024);
+    for (size_t i = 0; i < n; i++) {
+        double u = mco_rng_uniform(&rng);
+        x[i] = (u < 0.4) ? 0.0 : exp(8.0 * u) * 1e-3;
+    }
+
+    mco_sum one, threads, part[3];
+    mco_sum_init(&one);
+    mco_sum_init(&threads);
+    for (size_t i = 0; i < n; i++) {
+        mco_sum_add(&one, x[i]);
+    }
+
+    /* Uneven thread slices, merged in order */
+    size_t cut[4] = { 0, n / 3 + 17, n / 2 + 5, n };
+    for (int t = 0; t < 3; t++) {
+        mco_sum_init(&part[t]);
+        mco_sum_add_n(&part[t], x + cut[t], cut[t + 1] - cut[t]);
+        mco_sum_merge(&threads, &part[t]);
+    }
+
+    double ref = reference_sum(x, n);
+    double bound = 64.0 * DBL_EPSILON * ref;
+    free(x);
+
+    TEST_ASSERT_DOUBLE_WITHIN(bound, ref, mco_sum_value(&one));
+    TEST_ASSERT_DOUBLE_WITHIN(bound, ref, mco_sum_value(&threads));
+}
+
+static void test_sum_add_n_matches_add(void)
+{
+    double x[1000];
+    mco_rng rng;
+    mco_rng_seed(&rng, 7);
+    for (int i = 0; i < 1000; i++) {
+        x[i] = mco_rng_normal(&rng);
+    }
+
+    /* Ten passes, so blocks fill and carry; add_n in ragged chunks */
+    mco_sum a, b;
+    mco_sum_init(&a);
+    mco_sum_init(&b);
+    for (int pass = 0; pass < 10; pass++) {
+        for (int i = 0; i < 1000; i++) {
+            mco_sum_add(&a, x[i]);
+        }
+        for (size_t i = 0, len = 1; i < 1000; i += len, len = len % 13 + 2) {
+            mco_sum_add_n(&b, x + i, (i + len <= 1000) ? len : 1000 - i);
+        }
+    }
+
+    double va = mco_sum_value(&a), vb = mco_sum_value(&b);
+    TEST_ASSERT_EQUAL_MEMORY(&va, &vb, sizeof va);
+}
+
+/*-------------------------------------------------------
+ * Test Runner
+ *-------------------------------------------------------*/
+int main(void)
+{
+    UnityBegin("test_sum.c");
+
+    RUN_TEST(test_sum_accuracy);
+    RUN_TEST(test_sum_add_n_matches_add);
+
+    return UnityEnd();
+}